@@ -62,11 +62,9 @@ public:
 		// 带  .
 		g_Threading->Flush(true);
 
-		// 忡  ε ½ũ ߰Ѵ.
-		g_Threading->AddTask([world, file_path]()
-		{
-			world->LoadFromFile(file_path);
-		});
+		// 带  ƼƼ    忡 ؾ ϹǷ ½ũ ѱ ʴ´.
+		// ҽ ۾ 忡 ö ƼƼ  Ʈ鿡 Ƿ ʹ  ʴ´.
+		world->LoadFromFileAsync(file_path);
 	}
 
 	void SaveWorld(const std::string& file_path) const
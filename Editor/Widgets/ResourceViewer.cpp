@@ -37,8 +37,14 @@ void ResourceViewer::UpdateVisible()
 
 	//   ҽ , ޸ 뷮 
 	ImGui::Text("Resource count: %d, Memory usage cpu: %d Mb, Memory usage gpu: %d Mb", static_cast<uint32_t>(resources.size()), static_cast<uint32_t>(memory_usage_cpu), static_cast<uint32_t>(memory_usage_gpu));
+
+	// ޸     ҽ  
+	const sResourceResidency residency = resource_cache->GetResidency();
+	ImGui::Text("Budget cpu: %d Mb, Budget gpu: %d Mb, Evicted: %d", static_cast<uint32_t>(residency.budget_cpu / 1000 / 1000), static_cast<uint32_t>(residency.budget_gpu / 1000 / 1000), residency.evicted_count);
 	ImGui::Separator();
 
+	const uint64_t frame = resource_cache->GetFrame();
+
 	static ImGuiTableFlags flags =
 		ImGuiTableFlags_Borders |
 		ImGuiTableFlags_RowBg |
@@ -50,7 +56,7 @@ void ResourceViewer::UpdateVisible()
 	static ImVec2 size = ImVec2(-1.0f);
 
 	// ̺ 
-	if (ImGui::BeginTable("##Widget_ResourceCache", 7, flags, size))
+	if (ImGui::BeginTable("##Widget_ResourceCache", 8, flags, size))
 	{
 		ImGui::TableSetupColumn("Type");
 		ImGui::TableSetupColumn("ID");
@@ -59,6 +65,7 @@ void ResourceViewer::UpdateVisible()
 		ImGui::TableSetupColumn("Path (native)");
 		ImGui::TableSetupColumn("Size CPU");
 		ImGui::TableSetupColumn("Size GPU");
+		ImGui::TableSetupColumn("Last used");
 		ImGui::TableHeadersRow();
 
 		for (const shared_ptr<IResource>& resource : resources)
@@ -95,6 +102,10 @@ void ResourceViewer::UpdateVisible()
 				// GPU ޸ 뷮
 				ImGui::TableSetColumnIndex(6);
 				PrintMemory(object->GetObjectSizeGPU());
+
+				//  ȸ    
+				ImGui::TableSetColumnIndex(7);
+				ImGui::Text("%d frames ago", static_cast<uint32_t>(frame - min(frame, resource->GetLastUsedFrame())));
 			}
 		}
 
@@ -7,6 +7,7 @@
 
 #include "../Core/EventSystem.h"
 #include "../Core/Context.h"
+#include "../Core/FrameStages.h"
 #include "../Core/SubModule.h"
 #include "../Core/Engine.h"
 #include "../Core/Settings.h"
@@ -103,6 +104,35 @@ namespace PlayGround
 	}
 
 	void Audio::Update(double delta_time)
+	{
+		// ʸ ȭ  FMOD ƮѴ.
+		SyncListener();
+		UpdateSystem();
+	}
+
+	bool Audio::RegisterFrameStages(FrameGraph& graph, ETickType tick_group)
+	{
+		//  Ʈ  忡 ̸ صд.
+		graph.AddStage(FrameStages::AUDIO_LISTENER_SYNC, tick_group, [this](double) { SyncListener(); });
+		// FMOD Ʈ   ϹǷ ٸ  ļ Ŀ 忡 Ѵ.
+		graph.AddStage(FrameStages::AUDIO_UPDATE, tick_group, [this](double) { UpdateSystem(); });
+
+		return true;
+	}
+
+	void Audio::SyncListener()
+	{
+		m_HasListener = m_Listener != nullptr;
+
+		if (!m_HasListener)
+			return;
+
+		m_ListenerPosition = m_Listener->GetPosition();
+		m_ListenerForward = m_Listener->GetForward();
+		m_ListenerUp = m_Listener->GetUp();
+	}
+
+	void Audio::UpdateSystem()
 	{
 		//   ÷ 尡 ƴ϶ ׳ ȯ
 		if (!m_Context->m_Engine->IsEngineModeSet(GameMode))
@@ -121,19 +151,16 @@ namespace PlayGround
 
 
 		// ʸ Ʈ Ѵ.
-		if (m_Listener)
+		if (m_HasListener)
 		{
-			auto position = m_Listener->GetPosition();
 			auto velocity = Math::Vector3::Zero;
-			auto forward = m_Listener->GetForward();
-			auto up = m_Listener->GetUp();
 
 			m_FmodResult = m_FmodSystem->set3DListenerAttributes(
 				0,
-				reinterpret_cast<FMOD_VECTOR*>(&position),
+				reinterpret_cast<FMOD_VECTOR*>(&m_ListenerPosition),
 				reinterpret_cast<FMOD_VECTOR*>(&velocity),
-				reinterpret_cast<FMOD_VECTOR*>(&forward),
-				reinterpret_cast<FMOD_VECTOR*>(&up)
+				reinterpret_cast<FMOD_VECTOR*>(&m_ListenerForward),
+				reinterpret_cast<FMOD_VECTOR*>(&m_ListenerUp)
 			);
 
 			if (m_FmodResult != FMOD_OK)
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "../Core/SubModule.h"
+#include "../Math/Vector3.h"
 
 namespace FMOD
 {
@@ -23,6 +24,7 @@ namespace PlayGround
 		//   Ŭ   ޼ 
 		void OnInit() override;
 		void Update(double delta_time) override;
+		bool RegisterFrameStages(FrameGraph& graph, ETickType tick_group) override;
 
 		inline FMOD::System* GetSystemFMOD() const { return m_FmodSystem; }
 
@@ -30,6 +32,11 @@ namespace PlayGround
 		void SetListenerTransform(Transform* transform);
 
 	private:
+		//  Ʈ صд.
+		void SyncListener();
+		// FMOD ý Ʈ
+		void UpdateSystem();
+
 		// α Լ
 		void LogErrorFmod(uint32_t error) const;
 
@@ -37,6 +44,11 @@ namespace PlayGround
 		uint32_t m_MaxChannels = 32;
 		float m_Distance_entity = 1.0f;
 		Transform* m_Listener = nullptr;
+		//  ȭ  
+		bool m_HasListener = false;
+		Math::Vector3 m_ListenerPosition = Math::Vector3::Zero;
+		Math::Vector3 m_ListenerForward = Math::Vector3::Forward;
+		Math::Vector3 m_ListenerUp = Math::Vector3::Up;
 		Profiler* m_Profiler = nullptr;
 		FMOD::System* m_FmodSystem = nullptr;
 	};
@@ -136,6 +136,9 @@ namespace PlayGround
 			}
 		}
 
+		// ϵ   ȯ
+		inline const std::vector<sSubModule>& GetSubModules() const { return m_vecSubModules; }
+
 		Engine* m_Engine = nullptr;
 
 	private:
@@ -5,6 +5,7 @@
 #include "Settings.h"
 #include "Timer.h"
 #include "EventSystem.h"
+#include "FrameGraph.h"
 #include "../Audio/Audio.h"
 #include "../Input/Input.h"
 #include "../Physics/Physics.h"
@@ -44,6 +45,10 @@ namespace PlayGround
 		m_Context->OnInit();
 
 		m_Context->OnPostInit();
+
+		//  ׷ ̸ ΰ FrameGraphMode϶ Ѵ.
+		m_FrameGraph = make_unique<FrameGraph>(m_Context.get());
+		m_FrameGraph->Build();
 	}
 
 	Engine::~Engine()
@@ -57,8 +62,16 @@ namespace PlayGround
 	{
 		m_Context->PrevUpdate();
 
-		m_Context->Update(ETickType::Variable, m_Context->GetSubModule<Timer>()->GetDeltaTimeSec());
-		m_Context->Update(ETickType::Smoothed, m_Context->GetSubModule<Timer>()->GetDeltaTimeSmoothedSec());
+		if (IsEngineModeSet(FrameGraphMode))
+		{
+			//     ķ ƮѴ.
+			m_FrameGraph->Execute(m_Context->GetSubModule<Timer>()->GetDeltaTimeSec(), m_Context->GetSubModule<Timer>()->GetDeltaTimeSmoothedSec());
+		}
+		else
+		{
+			m_Context->Update(ETickType::Variable, m_Context->GetSubModule<Timer>()->GetDeltaTimeSec());
+			m_Context->Update(ETickType::Smoothed, m_Context->GetSubModule<Timer>()->GetDeltaTimeSmoothedSec());
+		}
 
 		m_Context->PostUpdate();
 	}
@@ -12,13 +12,15 @@ namespace PlayGround
 	//  ؽƮ Ÿ̸Ӹ  ִ´.
 	class Context;
 	class Timer;
+	class FrameGraph;
 
 	//   Ʈ 
 	enum EEngine_Mode : uint32_t
 	{
 		PhysicsMode = 1 << 0,
 		GameMode = 1 << 1,
-		PauseMode = 1 << 2
+		PauseMode = 1 << 2,
+		FrameGraphMode = 1 << 3		//   ׷  Ʈ
 	};
 
 	class Engine
@@ -77,5 +79,6 @@ namespace PlayGround
 	private:
 		uint32_t m_Flags = 0;
 		std::shared_ptr<Context> m_Context;
+		std::unique_ptr<FrameGraph> m_FrameGraph;
 	};
 }
\ No newline at end of file
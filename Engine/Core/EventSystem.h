@@ -33,6 +33,9 @@ enum class EventType
     WorldClear,                //  Ŭ
     WorldResolve,              //  翬
     WorldResolved,             //  翬 
+    EntityRenderStateChanged,  // ƼƼ Ʈ , Ȱȭ, Ƽ  (Entity*)
+    EntityRemoved,             // ƼƼ 忡 Ǳ  (Entity*)
+    MaterialTransparencyChanged, // Ƽ ,    (void* = Material*)
     EventSDL,                  // SDL ̺Ʈ
     WindowOnFullScreenToggled
 };
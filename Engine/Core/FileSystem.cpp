@@ -2,12 +2,16 @@
 #include "FileSystem.h"
 #include <filesystem>
 #include <regex>
-#include <Windows.h>
-#include <shellapi.h>
 #include "../Log/Logger.h"
 #include <fstream>
 
+//  API ڿ ȯ Ž ⿡ . (ٸ ÷ ׽Ʈ  ý۸ Ѵ.)
+#if defined(_WIN32)
+#include <Windows.h>
+#include <shellapi.h>
+
 #pragma comment (lib, "Shell32")
+#endif
 
 
 using namespace std;
@@ -137,6 +141,7 @@ namespace PlayGround
 
 	wstring FileSystem::StringToWstring(const string& str)
 	{
+#if defined(_WIN32)
 		//  ڿ ̸ Ѵ. null
 		int length = static_cast<int>(str.length()) + 1;
 		// ũ⸦ Ѵ.
@@ -150,12 +155,19 @@ namespace PlayGround
 		SAFE_DELETE_ARRAY(buffer);
 
 		return result;
+#else
+		return filesystem::path(str).wstring();
+#endif
 	}
 
 	void FileSystem::OpenDirectoryWindow(const string& directory)
 	{
+#if defined(_WIN32)
 		//  Ž 
 		ShellExecute(nullptr, nullptr, StringToWstring(directory).c_str(), nullptr, nullptr, SW_SHOW);
+#else
+		LOG_WARNING("Opening \"%s\" in a file browser is only supported on Windows", directory.c_str());
+#endif
 	}
 
 	bool FileSystem::CreateDirectory_(const string& path)
@@ -509,6 +521,11 @@ namespace PlayGround
 		return GetExtensionFromFilePath(path) == EXTENSION_SHADER;
 	}
 
+	bool FileSystem::IsEngineAnimationFile(const string& path)
+	{
+		return GetExtensionFromFilePath(path) == EXTENSION_ANIMATION;
+	}
+
 	bool FileSystem::IsEngineFile(const string& path)
 	{
 		return  IsEngineScriptFile(path) ||
@@ -519,7 +536,8 @@ namespace PlayGround
 			IsEngineSceneFile(path) ||
 			IsEngineTextureFile(path) ||
 			IsEngineAudioFile(path) ||
-			IsEngineShaderFile(path);
+			IsEngineShaderFile(path) ||
+			IsEngineAnimationFile(path);
 	}
 
 	vector<string> FileSystem::GetSupportedFilesInDirectory(const string& path)
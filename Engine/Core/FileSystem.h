@@ -92,6 +92,7 @@ namespace PlayGround
         static bool IsEngineTextureFile(const std::string& path);
         static bool IsEngineAudioFile(const std::string& path);
         static bool IsEngineShaderFile(const std::string& path);
+        static bool IsEngineAnimationFile(const std::string& path);
         static bool IsEngineFile(const std::string& path);
 
         static std::vector<std::string> GetSupportedFilesInDirectory(const std::string& path);
@@ -113,6 +114,7 @@ namespace PlayGround
     static const char* EXTENSION_TEXTURE = ".texture";
     static const char* EXTENSION_MESH = ".mesh";
     static const char* EXTENSION_AUDIO = ".audio";
+    static const char* EXTENSION_ANIMATION = ".animation";
     static const char* EXTENSION_SCRIPT = ".cs";
 
     static const std::vector<std::string> supported_formats_image
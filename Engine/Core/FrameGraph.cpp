@@ -0,0 +1,190 @@
+#include "Common.h"
+#include "FrameGraph.h"
+#include "FrameStages.h"
+#include "../Threading/Threading.h"
+
+using namespace std;
+
+namespace PlayGround
+{
+	FrameGraph::FrameGraph(Context* context)
+	{
+		m_Context = context;
+		m_Threading = context->GetSubModule<Threading>();
+	}
+
+	void FrameGraph::Build()
+	{
+		m_vecStages.clear();
+		m_Dirty = true;
+
+		// Ʈ ֱ  ߰ؼ  Ʈ  Ѵ.
+		for (const ETickType tick_group : { ETickType::Variable, ETickType::Smoothed })
+		{
+			for (const auto& submodule : m_Context->GetSubModules())
+			{
+				if (submodule.tick_group != tick_group)
+					continue;
+
+				//    ߴٸ Ѿ.
+				if (submodule.ptr->RegisterFrameStages(*this, tick_group))
+					continue;
+
+				SubModule* ptr = submodule.ptr.get();
+				const sFrameStageDesc& desc = FrameStages::SUBMODULE_UPDATE;
+				AddStage(typeid(*ptr).name(), tick_group, desc.reads, desc.writes, desc.main_thread, [ptr](double delta_time) { ptr->Update(delta_time); });
+			}
+		}
+	}
+
+	void FrameGraph::AddStage(const string& name, ETickType tick_group, uint32_t reads, uint32_t writes, bool main_thread, function<void(double)>&& function)
+	{
+		sFrameStage stage;
+		stage.name = name;
+		stage.tick_group = tick_group;
+		stage.reads = reads;
+		stage.writes = writes;
+		stage.main_thread = main_thread;
+		stage.function = move(function);
+
+		m_vecStages.emplace_back(move(stage));
+		m_Dirty = true;
+	}
+
+	void FrameGraph::AddStage(const sFrameStageDesc& desc, ETickType tick_group, function<void(double)>&& function)
+	{
+		AddStage(desc.name, tick_group, desc.reads, desc.writes, desc.main_thread, move(function));
+	}
+
+	void FrameGraph::Compile()
+	{
+		const uint32_t stage_count = static_cast<uint32_t>(m_vecStages.size());
+
+		for (sFrameStage& stage : m_vecStages)
+		{
+			stage.dependents.clear();
+			stage.dependency_count = 0;
+		}
+
+		// ռ   ڿ аų  ,
+		// Ǵ ռ  д ڿ  쿡  .
+		for (uint32_t i = 0; i < stage_count; i++)
+		{
+			for (uint32_t j = i + 1; j < stage_count; j++)
+			{
+				const sFrameStage& before = m_vecStages[i];
+				const sFrameStage& after = m_vecStages[j];
+
+				const bool conflict = (before.writes & (after.reads | after.writes)) || (before.reads & after.writes);
+
+				if (conflict)
+				{
+					m_vecStages[i].dependents.emplace_back(j);
+					m_vecStages[j].dependency_count++;
+				}
+			}
+		}
+
+		m_DependenciesLeft = make_unique<atomic<uint32_t>[]>(stage_count);
+		m_MainReady = make_unique<atomic<bool>[]>(stage_count);
+		m_Dirty = false;
+	}
+
+	void FrameGraph::Execute(double delta_time_variable, double delta_time_smoothed)
+	{
+		if (m_Dirty)
+			Compile();
+
+		const uint32_t stage_count = static_cast<uint32_t>(m_vecStages.size());
+
+		m_DeltaTime[static_cast<uint32_t>(ETickType::Variable)] = delta_time_variable;
+		m_DeltaTime[static_cast<uint32_t>(ETickType::Smoothed)] = delta_time_smoothed;
+		m_FrameStart = chrono::high_resolution_clock::now();
+
+		// ʱȭ
+		for (uint32_t i = 0; i < stage_count; i++)
+		{
+			m_DependenciesLeft[i] = m_vecStages[i].dependency_count;
+			m_MainReady[i] = false;
+		}
+
+		m_StagesLeft = stage_count;
+
+		//    Ѵ.
+		for (uint32_t i = 0; i < stage_count; i++)
+		{
+			if (m_vecStages[i].dependency_count == 0)
+				Schedule(i);
+		}
+
+		//    óϸ鼭    ٸ.
+		// Ŀ  ۾   ʵ ⼭ ٸ   ʴ´.
+		while (m_StagesLeft.load(memory_order_acquire) > 0)
+		{
+			bool executed = false;
+
+			for (uint32_t i = 0; i < stage_count; i++)
+			{
+				if (m_MainReady[i].load(memory_order_acquire) && m_MainReady[i].exchange(false))
+				{
+					Run(i);
+					executed = true;
+				}
+			}
+
+			if (!executed)
+				this_thread::yield();
+		}
+
+		m_ExecutionTimeMs = chrono::duration<double, milli>(chrono::high_resolution_clock::now() - m_FrameStart).count();
+
+		// Ӱ   ( ߰     ̴.)
+		vector<double> finish_ms(stage_count, 0.0);
+		m_CriticalPathMs = 0.0;
+
+		for (uint32_t i = 0; i < stage_count; i++)
+		{
+			finish_ms[i] += m_vecStages[i].duration_ms;
+			m_CriticalPathMs = max(m_CriticalPathMs, finish_ms[i]);
+
+			for (const uint32_t dependent : m_vecStages[i].dependents)
+			{
+				finish_ms[dependent] = max(finish_ms[dependent], finish_ms[i]);
+			}
+		}
+	}
+
+	void FrameGraph::Schedule(uint32_t index)
+	{
+		//   ̰ų Ŀ ٸ  尡 óѴ.
+		if (m_vecStages[index].main_thread || !m_Threading || m_Threading->GetThreadCount() == 0)
+		{
+			m_MainReady[index].store(true, memory_order_release);
+			return;
+		}
+
+		m_Threading->AddTask([this, index]() { Run(index); });
+	}
+
+	void FrameGraph::Run(uint32_t index)
+	{
+		sFrameStage& stage = m_vecStages[index];
+
+		const auto start = chrono::high_resolution_clock::now();
+
+		stage.function(m_DeltaTime[static_cast<uint32_t>(stage.tick_group)]);
+
+		const auto end = chrono::high_resolution_clock::now();
+		stage.start_ms = chrono::duration<double, milli>(start - m_FrameStart).count();
+		stage.duration_ms = chrono::duration<double, milli>(end - start).count();
+
+		//   ٸ   δ.
+		for (const uint32_t dependent : stage.dependents)
+		{
+			if (m_DependenciesLeft[dependent].fetch_sub(1, memory_order_acq_rel) == 1)
+				Schedule(dependent);
+		}
+
+		m_StagesLeft.fetch_sub(1, memory_order_release);
+	}
+}
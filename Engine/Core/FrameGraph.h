@@ -0,0 +1,111 @@
+#pragma once
+
+#include <vector>
+#include <string>
+#include <atomic>
+#include <memory>
+#include <functional>
+#include <chrono>
+#include "Context.h"
+
+namespace PlayGround
+{
+	class Threading;
+
+	//   а   ڿ
+	enum EFrameResource : uint32_t
+	{
+		FrameResource_None = 0,
+		FrameResource_Window = 1 << 0,		// â, SDL ̺Ʈ
+		FrameResource_Input = 1 << 1,		// Ű, 콺 
+		FrameResource_Transform = 1 << 2,	// ƼƼ Ʈ
+		FrameResource_Entities = 1 << 3,	//  ƼƼ ϰ Ʈ
+		FrameResource_Physics = 1 << 4,		// Bullet 
+		FrameResource_Audio = 1 << 5,		// FMOD ý۰ 
+		FrameResource_Renderer = 1 << 6,	//  Ʈ, RHI
+		FrameResource_All = 0xFFFFFFFF
+	};
+
+	//  ̸ ڿ  (  FrameStages.h ִ.)
+	struct sFrameStageDesc
+	{
+		const char* name;
+		uint32_t reads;
+		uint32_t writes;
+		//  忡   
+		bool main_thread;
+	};
+
+	//  ׷  ܰ
+	struct sFrameStage
+	{
+		std::string name;
+		ETickType tick_group = ETickType::Variable;
+		uint32_t reads = FrameResource_All;
+		uint32_t writes = FrameResource_All;
+		//  忡   
+		bool main_thread = true;
+		std::function<void(double)> function;
+
+		//      ִ 
+		std::vector<uint32_t> dependents;
+		uint32_t dependency_count = 0;
+
+		//    ð (   ms)
+		double start_ms = 0.0;
+		double duration_ms = 0.0;
+	};
+
+	//  Ʈ    б/ ڿ 
+	// ġ ʴ  Ŀ 忡 ÿ Ѵ.
+	//  ڿ ϴ  ߰  ȴ.
+	class FrameGraph
+	{
+	public:
+		FrameGraph(Context* context);
+		~FrameGraph() = default;
+
+		// ؽƮ κ  .
+		//   ʴ   ڿ     ȴ.
+		void Build();
+
+		//  ߰
+		void AddStage(const std::string& name, ETickType tick_group, uint32_t reads, uint32_t writes, bool main_thread, std::function<void(double)>&& function);
+		void AddStage(const sFrameStageDesc& desc, ETickType tick_group, std::function<void(double)>&& function);
+
+		//   ϰ  ٸ.
+		void Execute(double delta_time_variable, double delta_time_smoothed);
+
+		inline const std::vector<sFrameStage>& GetStages() const { return m_vecStages; }
+
+		//  ӿ     ɸ  ð
+		inline double GetCriticalPathMs() const { return m_CriticalPathMs; }
+
+		//  ӿ   ϴµ ɸ ð
+		inline double GetExecutionTimeMs() const { return m_ExecutionTimeMs; }
+
+	private:
+		//    Ѵ.
+		void Compile();
+		//    Ѵ.
+		void Schedule(uint32_t index);
+		//  
+		void Run(uint32_t index);
+
+		Context* m_Context = nullptr;
+		Threading* m_Threading = nullptr;
+
+		std::vector<sFrameStage> m_vecStages;
+		//  ִ  
+		std::unique_ptr<std::atomic<uint32_t>[]> m_DependenciesLeft;
+		//  忡  ٸ 
+		std::unique_ptr<std::atomic<bool>[]> m_MainReady;
+		std::atomic<uint32_t> m_StagesLeft = 0;
+		bool m_Dirty = true;
+
+		double m_DeltaTime[2] = { 0.0, 0.0 };
+		std::chrono::high_resolution_clock::time_point m_FrameStart;
+		double m_CriticalPathMs = 0.0;
+		double m_ExecutionTimeMs = 0.0;
+	};
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+#include "FrameGraph.h"
+
+namespace PlayGround
+{
+	//     
+	//   RegisterFrameStages ׽Ʈ   ϹǷ ڿ ٲ ⸸ ģ.
+	// (ڿ ׷     RegisterFrameStages ´.)
+	namespace FrameStages
+	{
+		//     (FrameGraph::Build  Ÿ ̸ ߰ȴ.)
+		inline constexpr sFrameStageDesc SUBMODULE_UPDATE = { "", FrameResource_All, FrameResource_All, true };
+
+		inline constexpr sFrameStageDesc WINDOW = { "Window", FrameResource_None, FrameResource_Window | FrameResource_Input | FrameResource_Renderer, true };
+		inline constexpr sFrameStageDesc INPUT = { "Input", FrameResource_Window, FrameResource_Input, true };
+		inline constexpr sFrameStageDesc RESOURCE_CACHE = { "ResourceCache", FrameResource_None, FrameResource_Entities | FrameResource_Renderer, true };
+		inline constexpr sFrameStageDesc AUDIO_LISTENER_SYNC = { "Audio_ListenerSync", FrameResource_Transform, FrameResource_Audio, true };
+		inline constexpr sFrameStageDesc AUDIO_UPDATE = { "Audio_Update", FrameResource_None, FrameResource_Audio, false };
+		inline constexpr sFrameStageDesc PHYSICS = { "Physics", FrameResource_Entities, FrameResource_Physics | FrameResource_Transform | FrameResource_Renderer, false };
+		inline constexpr sFrameStageDesc WORLD = { "World", FrameResource_Input, FrameResource_Entities | FrameResource_Transform | FrameResource_Physics | FrameResource_Audio | FrameResource_Renderer, true };
+		inline constexpr sFrameStageDesc WORLD_TRANSFORMS = { "World_Transforms", FrameResource_Entities, FrameResource_Transform | FrameResource_Renderer, true };
+		inline constexpr sFrameStageDesc RENDERER = { "Renderer", FrameResource_Window | FrameResource_Input | FrameResource_Transform | FrameResource_Entities | FrameResource_Physics, FrameResource_Renderer, true };
+	}
+}
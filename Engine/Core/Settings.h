@@ -33,6 +33,8 @@ namespace PlayGround
 
 		void OnPostInit() override;
 		void OnExit() override;
+		// Ʈ Ƿ  ׷   ʴ´.
+		bool RegisterFrameStages(FrameGraph& graph, ETickType tick_group) override { return true; }
 
 		void RegisterThirdParty(const std::string& name, const std::string& version, const std::string& url);
 
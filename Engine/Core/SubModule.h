@@ -7,6 +7,9 @@
 namespace PlayGround
 {
 	class Context;
+	class FrameGraph;
+	enum class ETickType;
+
 	//  ߰Ǵ  
 	class SubModule : public std::enable_shared_from_this<SubModule>
 	{
@@ -32,6 +35,10 @@ namespace PlayGround
 
 		virtual void OnExit() {}
 
+		//  ׷ Ʈ     ̵Ѵ.
+		// false ȯϸ Update  ڿ     ϵȴ.
+		virtual bool RegisterFrameStages(FrameGraph& graph, ETickType tick_group) { return false; }
+
 		// T Ÿ ȯ  ȯ
 		template <typename T>
 		std::shared_ptr<T> GetSharedPtr()
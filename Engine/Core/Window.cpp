@@ -1,5 +1,6 @@
 #include "Common.h"
 #include "Window.h"
+#include "FrameStages.h"
 #include "SDL.h"
 #include "SDL_syswm.h"
 #include "../Input/Input.h"
@@ -148,6 +149,14 @@ namespace PlayGround
 		}
 	}
 
+	bool Window::RegisterFrameStages(FrameGraph& graph, ETickType tick_group)
+	{
+		// SDL ̺Ʈ  忡 ó   Է°  ̺Ʈ Ѵ.
+		graph.AddStage(FrameStages::WINDOW, tick_group, [this](double delta_time) { Update(delta_time); });
+
+		return true;
+	}
+
 	void Window::Show()
 	{
 		ASSERT(m_Window != nullptr);
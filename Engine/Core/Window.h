@@ -21,6 +21,7 @@ namespace PlayGround
 		~Window();
 
 		void Update(double delta_time) override;
+		bool RegisterFrameStages(FrameGraph& graph, ETickType tick_group) override;
 
 		void Show();
 		void Hide();
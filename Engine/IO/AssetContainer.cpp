@@ -0,0 +1,313 @@
+#include "Common.h"
+#include "AssetContainer.h"
+#include <cstring>
+#if defined(_WIN32)
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+using namespace std;
+
+namespace PlayGround
+{
+	MappedFile::~MappedFile()
+	{
+		Close();
+	}
+
+	bool MappedFile::Open(const string& path)
+	{
+		Close();
+
+#if defined(_WIN32)
+		//  д´ٰ ˷ ̸ б⸦ ũ  Ѵ.
+		HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+		if (file == INVALID_HANDLE_VALUE)
+		{
+			LOG_ERROR("Failed to open \"%s\" for mapping", path.c_str());
+			return false;
+		}
+
+		LARGE_INTEGER size = {};
+		if (!GetFileSizeEx(file, &size) || size.QuadPart == 0)
+		{
+			LOG_ERROR("Failed to get the size of \"%s\" or it is empty", path.c_str());
+			CloseHandle(file);
+			return false;
+		}
+
+		HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (!mapping)
+		{
+			LOG_ERROR("Failed to create a file mapping for \"%s\"", path.c_str());
+			CloseHandle(file);
+			return false;
+		}
+
+		void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+		if (!data)
+		{
+			LOG_ERROR("Failed to map \"%s\"", path.c_str());
+			CloseHandle(mapping);
+			CloseHandle(file);
+			return false;
+		}
+
+		m_File = file;
+		m_Mapping = mapping;
+		m_Size = static_cast<uint64_t>(size.QuadPart);
+#else
+		const int file = open(path.c_str(), O_RDONLY);
+		if (file < 0)
+		{
+			LOG_ERROR("Failed to open \"%s\" for mapping", path.c_str());
+			return false;
+		}
+
+		struct stat status = {};
+		if (fstat(file, &status) != 0 || status.st_size == 0)
+		{
+			LOG_ERROR("Failed to get the size of \"%s\" or it is empty", path.c_str());
+			close(file);
+			return false;
+		}
+
+		void* data = mmap(nullptr, static_cast<size_t>(status.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+		//  ǹǷ  ũʹ ٷ ݾƵ ȴ.
+		close(file);
+
+		if (data == MAP_FAILED)
+		{
+			LOG_ERROR("Failed to map \"%s\"", path.c_str());
+			return false;
+		}
+
+		madvise(data, static_cast<size_t>(status.st_size), MADV_SEQUENTIAL);
+
+		m_Size = static_cast<uint64_t>(status.st_size);
+#endif
+
+		m_Data = static_cast<const byte*>(data);
+
+		return true;
+	}
+
+	void MappedFile::Close()
+	{
+		if (!m_Data)
+			return;
+
+#if defined(_WIN32)
+		UnmapViewOfFile(m_Data);
+		CloseHandle(static_cast<HANDLE>(m_Mapping));
+		CloseHandle(static_cast<HANDLE>(m_File));
+#else
+		munmap(const_cast<byte*>(m_Data), static_cast<size_t>(m_Size));
+#endif
+
+		m_Data = nullptr;
+		m_Size = 0;
+		m_File = nullptr;
+		m_Mapping = nullptr;
+	}
+
+	bool AssetContainer::IsAssetContainer(const string& path)
+	{
+		ifstream stream(path, ios::binary | ios::in);
+		if (stream.fail())
+			return false;
+
+		uint32_t magic = 0;
+		stream.read(reinterpret_cast<char*>(&magic), sizeof(magic));
+
+		return stream.gcount() == sizeof(magic) && magic == ASSET_CONTAINER_MAGIC;
+	}
+
+	bool AssetContainer::Open(const string& path)
+	{
+		Close();
+
+		if (!m_File.Open(path))
+			return false;
+
+		const uint64_t file_size = m_File.GetSize();
+
+		//  ˻
+		if (file_size < sizeof(sAssetContainerHeader))
+		{
+			LOG_ERROR("\"%s\" is too small to be an asset container", path.c_str());
+			Close();
+			return false;
+		}
+
+		sAssetContainerHeader header;
+		memcpy(&header, m_File.GetData(), sizeof(header));
+
+		if (header.magic != ASSET_CONTAINER_MAGIC)
+		{
+			LOG_ERROR("\"%s\" is not an asset container", path.c_str());
+			Close();
+			return false;
+		}
+
+		if (header.version != ASSET_CONTAINER_VERSION)
+		{
+			LOG_ERROR("\"%s\" has an unsupported container version (%d, expected %d)", path.c_str(), header.version, ASSET_CONTAINER_VERSION);
+			Close();
+			return false;
+		}
+
+		// ٰ ߴܵ   ũ  ũⰡ ٸ.
+		const uint64_t toc_size = static_cast<uint64_t>(header.chunk_count) * sizeof(sAssetChunk);
+		if (header.file_size != file_size || header.toc_offset > file_size || toc_size > file_size - header.toc_offset)
+		{
+			LOG_ERROR("\"%s\" is truncated or has a corrupted table of contents", path.c_str());
+			Close();
+			return false;
+		}
+
+		//  ˻
+		m_vecChunks.resize(header.chunk_count);
+		memcpy(m_vecChunks.data(), m_File.GetData() + header.toc_offset, toc_size);
+
+		for (const sAssetChunk& chunk : m_vecChunks)
+		{
+			const bool in_bounds = chunk.offset <= header.toc_offset && chunk.size <= header.toc_offset - chunk.offset;
+			const bool aligned = header.alignment == 0 || chunk.offset % header.alignment == 0;
+
+			if (!in_bounds || !aligned)
+			{
+				LOG_ERROR("\"%s\" has an invalid chunk", path.c_str());
+				Close();
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	void AssetContainer::Close()
+	{
+		m_File.Close();
+		m_vecChunks.clear();
+	}
+
+	const sAssetChunk* AssetContainer::FindChunk(uint32_t id) const
+	{
+		// ûũ  Ƿ  Ž ϴ.
+		for (const sAssetChunk& chunk : m_vecChunks)
+		{
+			if (chunk.id == id)
+				return &chunk;
+		}
+
+		return nullptr;
+	}
+
+	const byte* AssetContainer::GetChunkData(uint32_t id, uint64_t* size) const
+	{
+		const sAssetChunk* chunk = FindChunk(id);
+
+		if (!chunk)
+		{
+			*size = 0;
+			return nullptr;
+		}
+
+		*size = chunk->size;
+		return m_File.GetData() + chunk->offset;
+	}
+
+	AssetContainerWriter::AssetContainerWriter(const string& path)
+	{
+		m_Path = path;
+		m_Stream.open(path, ios::binary | ios::out | ios::trunc);
+
+		if (m_Stream.fail())
+		{
+			LOG_ERROR("Failed to open \"%s\" for writing", path.c_str());
+			return;
+		}
+
+		//  ڸ ΰ Close ä.
+		const sAssetContainerHeader header;
+		m_Stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+		m_Offset = sizeof(header);
+		m_Open = true;
+	}
+
+	AssetContainerWriter::~AssetContainerWriter()
+	{
+		if (m_Open)
+			Close();
+	}
+
+	void AssetContainerWriter::AddChunk(uint32_t id, const void* data, uint64_t size)
+	{
+		if (!m_Open)
+			return;
+
+		Pad(ASSET_CONTAINER_ALIGNMENT);
+
+		sAssetChunk chunk;
+		chunk.id = id;
+		chunk.offset = m_Offset;
+		chunk.size = size;
+		m_vecChunks.emplace_back(chunk);
+
+		if (size != 0)
+			m_Stream.write(static_cast<const char*>(data), static_cast<streamsize>(size));
+
+		m_Offset += size;
+	}
+
+	bool AssetContainerWriter::Close()
+	{
+		if (!m_Open)
+			return false;
+
+		m_Open = false;
+
+		// 
+		Pad(alignof(sAssetChunk));
+
+		sAssetContainerHeader header;
+		header.chunk_count = static_cast<uint32_t>(m_vecChunks.size());
+		header.toc_offset = m_Offset;
+
+		const uint64_t toc_size = m_vecChunks.size() * sizeof(sAssetChunk);
+		m_Stream.write(reinterpret_cast<const char*>(m_vecChunks.data()), static_cast<streamsize>(toc_size));
+		m_Offset += toc_size;
+
+		//     ڿ äǷ ߰   ũ ˻翡 ɷ.
+		header.file_size = m_Offset;
+		m_Stream.seekp(0);
+		m_Stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+		m_Stream.flush();
+
+		const bool success = !m_Stream.fail();
+		m_Stream.close();
+
+		if (!success)
+			LOG_ERROR("Failed to write \"%s\"", m_Path.c_str());
+
+		return success;
+	}
+
+	void AssetContainerWriter::Pad(uint64_t alignment)
+	{
+		static constexpr char zeros[ASSET_CONTAINER_ALIGNMENT] = {};
+
+		const uint64_t padding = (alignment - m_Offset % alignment) % alignment;
+
+		if (padding != 0)
+		{
+			m_Stream.write(zeros, static_cast<streamsize>(padding));
+			m_Offset += padding;
+		}
+	}
+}
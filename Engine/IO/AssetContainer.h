@@ -0,0 +1,150 @@
+#pragma once
+
+#include <vector>
+#include <string>
+#include <fstream>
+#include <cstdint>
+#include <cstddef>
+
+namespace PlayGround
+{
+	//  ڷ ûũ ̵ . (: AssetChunkId('I', 'N', 'D', 'X'))
+	constexpr uint32_t AssetChunkId(char a, char b, char c, char d)
+	{
+		return static_cast<uint32_t>(static_cast<uint8_t>(a)) |
+			(static_cast<uint32_t>(static_cast<uint8_t>(b)) << 8) |
+			(static_cast<uint32_t>(static_cast<uint8_t>(c)) << 16) |
+			(static_cast<uint32_t>(static_cast<uint8_t>(d)) << 24);
+	}
+
+	static constexpr uint32_t ASSET_CONTAINER_MAGIC = AssetChunkId('P', 'G', 'A', 'C');
+	static constexpr uint32_t ASSET_CONTAINER_VERSION = 1;
+	// ûũ   ּ  (ĳ , SIMD ε忡 .)
+	static constexpr uint32_t ASSET_CONTAINER_ALIGNMENT = 64;
+
+	//    
+	struct sAssetContainerHeader
+	{
+		uint32_t magic = ASSET_CONTAINER_MAGIC;
+		uint32_t version = ASSET_CONTAINER_VERSION;
+		uint32_t chunk_count = 0;
+		uint32_t alignment = ASSET_CONTAINER_ALIGNMENT;
+		// (sAssetChunk 迭) ġ
+		uint64_t toc_offset = 0;
+		uint64_t file_size = 0;
+	};
+
+	//  ׸ ϳ
+	struct sAssetChunk
+	{
+		uint32_t id = 0;
+		uint32_t flags = 0;
+		uint64_t offset = 0;
+		uint64_t size = 0;
+	};
+
+	// б   ü ޸𸮿 Ѵ.
+	//     OS оǷ  ۿ  ʴ´.
+	class MappedFile
+	{
+	public:
+		MappedFile() = default;
+		~MappedFile();
+
+		MappedFile(const MappedFile&) = delete;
+		MappedFile& operator=(const MappedFile&) = delete;
+
+		bool Open(const std::string& path);
+		void Close();
+
+		inline bool IsOpen() const { return m_Data != nullptr; }
+		inline const std::byte* GetData() const { return m_Data; }
+		inline uint64_t GetSize() const { return m_Size; }
+
+	private:
+		const std::byte* m_Data = nullptr;
+		uint64_t m_Size = 0;
+		// ÷ ڵ
+		void* m_File = nullptr;
+		void* m_Mapping = nullptr;
+	};
+
+	//  ִ ûũ ̳  д´.
+	// [][ĵ ûũ ...][]  Ǿ 
+	// ûũ ʹ ε ޸𸮸 ״ ŰǷ RHI ε忡 ٷ ѱų ڸ   ִ.
+	// ȯ ʹ ̳ʰ   ȿϴ.
+	class AssetContainer
+	{
+	public:
+		AssetContainer() = default;
+		~AssetContainer() = default;
+
+		//  պκ  ѹ ȮѴ. ( ˰   )
+		static bool IsAssetContainer(const std::string& path);
+
+		bool Open(const std::string& path);
+		void Close();
+
+		inline bool IsOpen() const { return m_File.IsOpen(); }
+
+		// ûũ ã´. (ٸ nullptr)
+		const sAssetChunk* FindChunk(uint32_t id) const;
+
+		// ûũ Ϳ Ʈ ũ (ٸ nullptr)
+		const std::byte* GetChunkData(uint32_t id, uint64_t* size) const;
+
+		// ûũ T 迭 . ũⰡ T  ƴ϶ nullptr
+		template <typename T>
+		const T* GetChunkData(uint32_t id, uint64_t* count) const
+		{
+			uint64_t size = 0;
+			const std::byte* data = GetChunkData(id, &size);
+
+			if (!data || size % sizeof(T) != 0)
+			{
+				*count = 0;
+				return nullptr;
+			}
+
+			*count = size / sizeof(T);
+			return reinterpret_cast<const T*>(data);
+		}
+
+		inline const std::vector<sAssetChunk>& GetChunks() const { return m_vecChunks; }
+
+	private:
+		MappedFile m_File;
+		std::vector<sAssetChunk> m_vecChunks;
+	};
+
+	// ûũ ̳ʸ .
+	// ûũ ͸ ٷ Ͽ   Ƶξٰ Close  .
+	class AssetContainerWriter
+	{
+	public:
+		AssetContainerWriter(const std::string& path);
+		~AssetContainerWriter();
+
+		inline bool IsOpen() const { return m_Open; }
+
+		void AddChunk(uint32_t id, const void* data, uint64_t size);
+
+		template <typename T>
+		void AddChunk(uint32_t id, const std::vector<T>& data)
+		{
+			AddChunk(id, data.data(), static_cast<uint64_t>(data.size() * sizeof(T)));
+		}
+
+		//    ݴ´.
+		bool Close();
+
+	private:
+		void Pad(uint64_t alignment);
+
+		std::ofstream m_Stream;
+		std::string m_Path;
+		std::vector<sAssetChunk> m_vecChunks;
+		uint64_t m_Offset = 0;
+		bool m_Open = false;
+	};
+}
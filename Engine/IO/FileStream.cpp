@@ -1,6 +1,12 @@
 #include "Common.h"
 #include "FileStream.h"
 #include "../RHI/RHI_Vertex.h"
+#if defined(FILESTREAM_POSIX_IO)
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/uio.h>
+#endif
 
 using namespace std;
 
@@ -10,14 +16,46 @@ namespace PlayGround
 	{
 		m_Open = false;
 		m_Flags = flags;
-
-		int ios_flags = ios::binary;
-		ios_flags |= (flags & FileStream_Read) ? ios::in : 0;
-		ios_flags |= (flags & FileStream_Write) ? ios::out : 0;
-		ios_flags |= (flags & FileStream_Append) ? ios::app : 0;
+		// б ۸   ũ
+		uint64_t file_size = 0;
 
 		//   ǽѴ.
 
+#if defined(FILESTREAM_POSIX_IO)
+		if (m_Flags & FileStream_Write)
+		{
+			const int open_flags = O_WRONLY | O_CREAT | ((flags & FileStream_Append) ? O_APPEND : O_TRUNC);
+			m_File = open(path.c_str(), open_flags, 0644);
+			if (m_File < 0)
+			{
+				LOG_ERROR("Failed to open \"%s\" for writing", path.c_str());
+				return;
+			}
+
+			if (flags & FileStream_Append)
+				m_FilePosition = static_cast<uint64_t>(lseek(m_File, 0, SEEK_END));
+		}
+		else if (m_Flags & FileStream_Read)
+		{
+			m_File = open(path.c_str(), O_RDONLY);
+			if (m_File < 0)
+			{
+				LOG_ERROR("Failed to open \"%s\" for reading", path.c_str());
+				return;
+			}
+
+			const off_t end = lseek(m_File, 0, SEEK_END);
+			file_size = end > 0 ? static_cast<uint64_t>(end) : 0;
+		}
+#else
+		ios::openmode ios_flags = ios::binary;
+		if (flags & FileStream_Read)
+			ios_flags |= ios::in;
+		if (flags & FileStream_Write)
+			ios_flags |= ios::out;
+		if (flags & FileStream_Append)
+			ios_flags |= ios::app;
+
 		if (m_Flags & FileStream_Write)
 		{
 			m_OutputStream.open(path, ios_flags);
@@ -35,11 +73,30 @@ namespace PlayGround
 				LOG_ERROR("Failed to open \"%s\" for reading", path.c_str());
 				return;
 			}
+
+			m_InputStream.seekg(0, ios::end);
+			const streamoff end = m_InputStream.tellg();
+			m_InputStream.seekg(0, ios::beg);
+			file_size = end > 0 ? static_cast<uint64_t>(end) : 0;
 		}
+#endif
+
+		// б ۴ Ϻ Ŭ ʿ䰡 .
+		if (!(m_Flags & FileStream_Write))
+			ReserveBuffer(std::min(file_size, BUFFER_SIZE));
 
 		m_Open = true;
 	}
 
+	FileStream::FileStream(const byte* data, uint64_t size)
+	{
+		//  ü ̹ ä б ۷ Ѵ.
+		m_Flags = FileStream_Read | FileStream_Memory;
+		m_Buffer = const_cast<char*>(reinterpret_cast<const char*>(data));
+		m_ReadSize = data ? size : 0;
+		m_Open = data != nullptr;
+	}
+
 	FileStream::~FileStream()
 	{
 		Close();
@@ -47,8 +104,18 @@ namespace PlayGround
 
 	void FileStream::Close()
 	{
-		//  Ʈ   ͸ Ʈ ۸ ʱȭϰ ݴ´.
+		if (!m_Open)
+			return;
+
+		// ۿ    Ʈ ݴ´.
+		if (m_Flags & FileStream_Write)
+			FlushBuffer();
 
+#if defined(FILESTREAM_POSIX_IO)
+		if (m_File >= 0)
+			close(m_File);
+		m_File = -1;
+#else
 		if (m_Flags & FileStream_Write)
 		{
 			m_OutputStream.flush();
@@ -59,6 +126,74 @@ namespace PlayGround
 			m_InputStream.clear();
 			m_InputStream.close();
 		}
+#endif
+
+		m_WriteSize = 0;
+		m_ReadSize = 0;
+		m_ReadPosition = 0;
+		m_Open = false;
+	}
+
+	uint64_t FileStream::GetPosition()
+	{
+		if (m_Flags & FileStream_Memory)
+			return m_ReadPosition;
+
+#if defined(FILESTREAM_POSIX_IO)
+		const uint64_t file_position = m_FilePosition;
+#else
+		const uint64_t file_position = (m_Flags & FileStream_Write) ? static_cast<uint64_t>(m_OutputStream.tellp()) : static_cast<uint64_t>(m_InputStream.tellg());
+#endif
+
+		// ۿ 𿴰ų    ŭ ݿѴ.
+		if (m_Flags & FileStream_Write)
+			return file_position + m_WriteSize;
+
+		return file_position - (m_ReadSize - m_ReadPosition);
+	}
+
+	void FileStream::WriteAt(uint64_t position, const void* data, uint64_t size)
+	{
+		if (!m_Open || !(m_Flags & FileStream_Write))
+			return;
+
+		const uint64_t buffer_start = GetPosition() - m_WriteSize;
+
+		//  ۿ ִٸ ۸ ģ.
+		if (position >= buffer_start && position + size <= buffer_start + m_WriteSize)
+		{
+			memcpy(m_Buffer + (position - buffer_start), data, size);
+			return;
+		}
+
+		// Ͽ   ۸    ġ    ġ ƿ´.
+		FlushBuffer();
+
+#if defined(FILESTREAM_POSIX_IO)
+		const uint64_t end = m_FilePosition;
+		m_FilePosition = position;
+		WriteBlocks(data, size, nullptr, 0);
+		m_FilePosition = end;
+#else
+		const streampos end = m_OutputStream.tellp();
+		m_OutputStream.seekp(static_cast<streamoff>(position));
+		WriteBlocks(data, size, nullptr, 0);
+		m_OutputStream.seekp(end);
+#endif
+	}
+
+	const byte* FileStream::ReadInPlace(uint64_t size)
+	{
+		if (!(m_Flags & FileStream_Memory) || size > m_ReadSize - m_ReadPosition)
+		{
+			m_Eof = true;
+			return nullptr;
+		}
+
+		const byte* data = reinterpret_cast<const byte*>(m_Buffer + m_ReadPosition);
+		m_ReadPosition += size;
+
+		return data;
 	}
 
 	void FileStream::Write(const string& value)
@@ -66,7 +201,7 @@ namespace PlayGround
 		const uint32_t length = static_cast<uint32_t>(value.length());
 		Write(length);
 
-		m_OutputStream.write(const_cast<char*>(value.c_str()), length);
+		WriteBytes(value.data(), length);
 	}
 
 	void FileStream::Write(const vector<string>& value)
@@ -84,28 +219,28 @@ namespace PlayGround
 	{
 		const uint32_t length = static_cast<uint32_t>(value.size());
 		Write(length);
-		m_OutputStream.write(reinterpret_cast<const char*>(&value[0]), sizeof(RHI_Vertex_PosTexNorTan) * length);
+		WriteBytes(value.data(), sizeof(RHI_Vertex_PosTexNorTan) * length);
 	}
 
 	void FileStream::Write(const vector<uint32_t>& value)
 	{
 		const uint32_t size = static_cast<uint32_t>(value.size());
 		Write(size);
-		m_OutputStream.write(reinterpret_cast<const char*>(&value[0]), sizeof(unsigned char) * size);
+		WriteBytes(value.data(), sizeof(uint32_t) * size);
 	}
 
 	void FileStream::Write(const vector<unsigned char>& value)
 	{
 		const uint32_t size = static_cast<uint32_t>(value.size());
 		Write(size);
-		m_OutputStream.write(reinterpret_cast<const char*>(&value[0]), sizeof(unsigned char) * size);
+		WriteBytes(value.data(), sizeof(unsigned char) * size);
 	}
 
 	void FileStream::Write(const vector<std::byte>& value)
 	{
 		const uint32_t size = static_cast<uint32_t>(value.size());
 		Write(size);
-		m_OutputStream.write(reinterpret_cast<const char*>(&value[0]), sizeof(std::byte) * size);
+		WriteBytes(value.data(), sizeof(std::byte) * size);
 	}
 
 	void FileStream::Skip(const uint64_t n)
@@ -113,9 +248,42 @@ namespace PlayGround
 		//  Ž ġ Ѵ.
 
 		if (m_Flags & FileStream_Write)
+		{
+			FlushBuffer();
+
+#if defined(FILESTREAM_POSIX_IO)
+			m_FilePosition += n;
+#else
 			m_OutputStream.seekp(n, ios::cur);
+#endif
+		}
 		else if (m_Flags & FileStream_Read)
-			m_InputStream.ignore(n, ios::cur);
+		{
+			//  ȿ ٸ ġ ű.
+			const uint64_t available = m_ReadSize - m_ReadPosition;
+			if (n <= available)
+			{
+				m_ReadPosition += n;
+				return;
+			}
+
+			// ޸ Ʈ  .
+			if (m_Flags & FileStream_Memory)
+			{
+				m_ReadPosition = m_ReadSize;
+				m_Eof = true;
+				return;
+			}
+
+			m_ReadSize = 0;
+			m_ReadPosition = 0;
+
+#if defined(FILESTREAM_POSIX_IO)
+			m_FilePosition += n - available;
+#else
+			m_InputStream.seekg(n - available, ios::cur);
+#endif
+		}
 	}
 
 	void FileStream::Read(string* value)
@@ -124,7 +292,7 @@ namespace PlayGround
 		Read(&length);
 
 		value->resize(length);
-		m_InputStream.read(const_cast<char*>(value->c_str()), length);
+		ReadBytes(value->data(), length);
 	}
 
 	void FileStream::Read(vector<string>* vec)
@@ -152,14 +320,12 @@ namespace PlayGround
 			return;
 
 		vec->clear();
-		vec->shrink_to_fit();
 
 		const uint32_t length = ReadAs<uint32_t>();
 
-		vec->reserve(length);
 		vec->resize(length);
 
-		m_InputStream.read(reinterpret_cast<char*>(vec->data()), sizeof(RHI_Vertex_PosTexNorTan) * length);
+		ReadBytes(vec->data(), sizeof(RHI_Vertex_PosTexNorTan) * length);
 	}
 
 	void FileStream::Read(vector<uint32_t>* vec)
@@ -168,14 +334,12 @@ namespace PlayGround
 			return;
 
 		vec->clear();
-		vec->shrink_to_fit();
 
-		uint32_t length = ReadAs<uint32_t>();
+		const uint32_t length = ReadAs<uint32_t>();
 
-		vec->reserve(length);
 		vec->resize(length);
 
-		m_InputStream.read(reinterpret_cast<char*>(vec->data()), sizeof(uint32_t) * length);
+		ReadBytes(vec->data(), sizeof(uint32_t) * length);
 	}
 
 	void FileStream::Read(vector<unsigned char>* vec)
@@ -184,14 +348,12 @@ namespace PlayGround
 			return;
 
 		vec->clear();
-		vec->shrink_to_fit();
 
 		const uint32_t length = ReadAs<uint32_t>();
 
-		vec->reserve(length);
 		vec->resize(length);
 
-		m_InputStream.read(reinterpret_cast<char*>(vec->data()), sizeof(unsigned char) * length);
+		ReadBytes(vec->data(), sizeof(unsigned char) * length);
 	}
 
 	void FileStream::Read(vector<std::byte>* vec)
@@ -200,13 +362,252 @@ namespace PlayGround
 			return;
 
 		vec->clear();
-		vec->shrink_to_fit();
 
 		const uint32_t length = ReadAs<uint32_t>();
 
-		vec->reserve(length);
 		vec->resize(length);
 
-		m_InputStream.read(reinterpret_cast<char*>(vec->data()), sizeof(std::byte) * length);
+		ReadBytes(vec->data(), sizeof(std::byte) * length);
+	}
+
+	void FileStream::WriteOverflow(const void* data, uint64_t size)
+	{
+		//  Ʈ ƴ϶ Ѵ.
+		if (!(m_Flags & FileStream_Write))
+			return;
+
+		// ۰ ִ ũⰡ   Ű  .
+		if (size < BUFFER_SIZE && m_BufferCapacity < BUFFER_SIZE)
+		{
+			ReserveBuffer(std::min(std::max({ m_BufferCapacity * 2, m_WriteSize + size, BUFFER_SIZE_MIN }), BUFFER_SIZE));
+
+			if (m_WriteSize + size <= m_WriteCapacity)
+			{
+				memcpy(m_Buffer + m_WriteSize, data, size);
+				m_WriteSize += size;
+				return;
+			}
+		}
+
+		// ۺ ۴ٸ ۸  ٽ .
+		if (size < BUFFER_SIZE)
+		{
+			FlushBuffer();
+
+			memcpy(m_Buffer, data, size);
+			m_WriteSize = size;
+			return;
+		}
+
+		// ū ʹ ۿ  ʰ   Բ ٷ .
+		if (m_Open)
+			WriteBlocks(m_Buffer, m_WriteSize, data, size);
+
+		m_WriteSize = 0;
+	}
+
+	void FileStream::ReadUnderflow(void* data, uint64_t size)
+	{
+		char* destination = static_cast<char*>(data);
+
+		// ۿ  ͺ ѱ.
+		const uint64_t available = m_ReadSize - m_ReadPosition;
+		memcpy(destination, m_Buffer + m_ReadPosition, available);
+		destination += available;
+		size -= available;
+
+		// ޸ Ʈ    .
+		if (m_Flags & FileStream_Memory)
+		{
+			m_ReadPosition = m_ReadSize;
+			m_Eof = true;
+			memset(destination, 0, size);
+			return;
+		}
+
+		m_ReadSize = 0;
+		m_ReadPosition = 0;
+
+		// ڶ κ  ٷ а ̾ ۸ ٽ ä.
+		const bool readable = m_Open && (m_Flags & FileStream_Read) && !(m_Flags & FileStream_Write);
+		const uint64_t read = readable ? ReadBlocks(destination, size, m_Buffer, m_BufferCapacity) : 0;
+
+		//   Ѿ   0 ä.
+		if (read < size)
+		{
+			m_Eof = true;
+			memset(destination + read, 0, size - read);
+			return;
+		}
+
+		m_ReadSize = read - size;
+	}
+
+	void FileStream::FlushBuffer()
+	{
+		if (m_WriteSize == 0)
+			return;
+
+		if (m_Open)
+			WriteBlocks(m_Buffer, m_WriteSize, nullptr, 0);
+
+		m_WriteSize = 0;
+	}
+
+	void FileStream::ReserveBuffer(const uint64_t capacity)
+	{
+		if (capacity <= m_BufferCapacity)
+			return;
+
+		unique_ptr<char[]> storage = make_unique_for_overwrite<char[]>(capacity);
+		if (m_WriteSize != 0)
+			memcpy(storage.get(), m_Buffer, m_WriteSize);
+
+		m_BufferStorage = move(storage);
+		m_Buffer = m_BufferStorage.get();
+		m_BufferCapacity = capacity;
+
+		if (m_Flags & FileStream_Write)
+			m_WriteCapacity = capacity;
+	}
+
+#if defined(FILESTREAM_POSIX_IO)
+	bool FileStream::WriteBlocks(const void* first, uint64_t first_size, const void* second, uint64_t second_size)
+	{
+		iovec blocks[2] =
+		{
+			{ const_cast<void*>(first), static_cast<size_t>(first_size) },
+			{ const_cast<void*>(second), static_cast<size_t>(second_size) }
+		};
+
+		iovec* block = blocks;
+		int block_count = second_size != 0 ? 2 : 1;
+
+		while (block_count > 0)
+		{
+			const ssize_t written = pwritev(m_File, block, block_count, static_cast<off_t>(m_FilePosition));
+
+			if (written < 0)
+			{
+				if (errno == EINTR)
+					continue;
+
+				LOG_ERROR("Failed to write to file (errno %d)", errno);
+				return false;
+			}
+
+			m_FilePosition += static_cast<uint64_t>(written);
+
+			// Ϻθ ٸ  κк ٽ .
+			size_t left = static_cast<size_t>(written);
+			while (block_count > 0 && left >= block->iov_len)
+			{
+				left -= block->iov_len;
+				block++;
+				block_count--;
+			}
+
+			if (block_count > 0)
+			{
+				block->iov_base = static_cast<char*>(block->iov_base) + left;
+				block->iov_len -= left;
+			}
+		}
+
+		return true;
+	}
+
+	uint64_t FileStream::ReadBlocks(void* first, uint64_t first_size, void* second, uint64_t second_size)
+	{
+		iovec blocks[2] =
+		{
+			{ first, static_cast<size_t>(first_size) },
+			{ second, static_cast<size_t>(second_size) }
+		};
+
+		iovec* block = blocks;
+		int block_count = 2;
+		uint64_t total = 0;
+
+		while (block_count > 0)
+		{
+			const ssize_t read = preadv(m_File, block, block_count, static_cast<off_t>(m_FilePosition));
+
+			if (read < 0)
+			{
+				if (errno == EINTR)
+					continue;
+
+				LOG_ERROR("Failed to read from file (errno %d)", errno);
+				break;
+			}
+
+			//  
+			if (read == 0)
+				break;
+
+			m_FilePosition += static_cast<uint64_t>(read);
+			total += static_cast<uint64_t>(read);
+
+			//   äٸ ۴ ѹ ä  ϴ.
+			if (total >= first_size)
+				break;
+
+			size_t left = static_cast<size_t>(read);
+			while (block_count > 0 && left >= block->iov_len)
+			{
+				left -= block->iov_len;
+				block++;
+				block_count--;
+			}
+
+			if (block_count > 0)
+			{
+				block->iov_base = static_cast<char*>(block->iov_base) + left;
+				block->iov_len -= left;
+			}
+		}
+
+		return total;
+	}
+#else
+	bool FileStream::WriteBlocks(const void* first, uint64_t first_size, const void* second, uint64_t second_size)
+	{
+		if (first_size != 0)
+			m_OutputStream.write(static_cast<const char*>(first), static_cast<streamsize>(first_size));
+
+		if (second_size != 0)
+			m_OutputStream.write(static_cast<const char*>(second), static_cast<streamsize>(second_size));
+
+		if (m_OutputStream.fail())
+		{
+			LOG_ERROR("Failed to write to file");
+			return false;
+		}
+
+		return true;
+	}
+
+	uint64_t FileStream::ReadBlocks(void* first, uint64_t first_size, void* second, uint64_t second_size)
+	{
+		//   ª  eofbit failbit   ڷ tellg, seekg ϹǷ ¸ .
+		//    Ʈ  Ǵؼ m_Eof  Ѵ.
+		m_InputStream.read(static_cast<char*>(first), static_cast<streamsize>(first_size));
+		const uint64_t first_read = static_cast<uint64_t>(m_InputStream.gcount());
+
+		if (first_read < first_size)
+		{
+			m_InputStream.clear();
+			return first_read;
+		}
+
+		m_InputStream.read(static_cast<char*>(second), static_cast<streamsize>(second_size));
+		const uint64_t second_read = static_cast<uint64_t>(m_InputStream.gcount());
+
+		if (second_read < second_size)
+			m_InputStream.clear();
+
+		return first_read + second_read;
 	}
+#endif
 }
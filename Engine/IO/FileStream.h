@@ -1,6 +1,10 @@
 #pragma once
 
 #include <vector>
+#include <span>
+#include <memory>
+#include <cstring>
+#include <type_traits>
 #include <fstream>
 #include "../Math/Vector2.h"
 #include "../Math/Vector3.h"
@@ -8,6 +12,12 @@
 #include "../Math/Quaternion.h"
 #include "../Math/BoundingBox.h"
 
+//  fstream   ũͿ pwritev/preadv  Ѵ.
+// FILESTREAM_USE_FSTREAM ϸ  ÷̵ fstream Ѵ.
+#if defined(__linux__) && !defined(FILESTREAM_USE_FSTREAM)
+#define FILESTREAM_POSIX_IO
+#endif
+
 namespace PlayGround
 {
 	class Entity;
@@ -18,20 +28,43 @@ namespace PlayGround
 	{
 		FileStream_Read = 1 << 0,
 		FileStream_Write = 1 << 1,
-		FileStream_Append = 1 << 2
+		FileStream_Append = 1 << 2,
+		FileStream_Memory = 1 << 3
 	};
 	
 	//    Ŭ
+	//     ۿ Ƶξٰ ū   Ͽ  д´.
+	// ۸ Ѵ ū ʹ ۸ ġ ʰ   Բ ѹ Ѵ.
+	// ۴ ó ִ ũ  ʴ´. б  ũ⸸ŭ,   ŭ  辿 Ű.
 	class FileStream
 	{
 	public:
+		//  ִ ũ
+		static constexpr uint64_t BUFFER_SIZE = 2 * 1024 * 1024;
+		//  ۸ ó   ũ
+		static constexpr uint64_t BUFFER_SIZE_MIN = 64 * 1024;
+
 		FileStream(const std::string& path, uint32_t flags);
+		// ޸𸮿 ִ ͸ д Ʈ ( Ƿ data Ʈ  ־ Ѵ.)
+		FileStream(const std::byte* data, uint64_t size);
 		~FileStream();
 
 		inline bool IsOpen() const	{ return m_Open; }
+		//  Ѿ    ִ
+		inline bool IsEof() const	{ return m_Eof; }
 
 		void Close();
 
+		// (޸) ó  ġ
+		uint64_t GetPosition();
+
+		// ̹  ġ  . (ũ⳪  ߿ ä  )
+		//  ۿ ִ  ۸ ģ.
+		void WriteAt(uint64_t position, const void* data, uint64_t size);
+
+		// ޸ Ʈ sizeŭ  ʰ Ų  Ѿ. (  nullptr)
+		const std::byte* ReadInPlace(uint64_t size);
+
 		//  ½  Ǵ ŸԵ鸸   ְѴ.
 		template <class T, class = typename std::enable_if <
 			std::is_same<T, bool>::value ||
@@ -57,7 +90,14 @@ namespace PlayGround
 		> ::type >
 		void Write(T value)
 		{
-			m_OutputStream.write(reinterpret_cast<char*>(&value), sizeof(value));
+			WriteBytes(&value, sizeof(value));
+		}
+
+		// ڸϰ   Ÿ 迭   ״ .
+		template <class T, class = typename std::enable_if<std::is_trivially_copyable<T>::value>::type>
+		void Write(std::span<const T> values)
+		{
+			WriteBytes(values.data(), values.size_bytes());
 		}
 
 		void Write(const std::string& value);
@@ -94,7 +134,14 @@ namespace PlayGround
 		> ::type >
 		void Read(T* value)
 		{
-			m_InputStream.read(reinterpret_cast<char*>(value), sizeof(T));
+			ReadBytes(value, sizeof(T));
+		}
+
+		// span ũ⸸ŭ ״ д´. (Write(std::span)  )
+		template <class T, class = typename std::enable_if<std::is_trivially_copyable<T>::value>::type>
+		void Read(std::span<T> values)
+		{
+			ReadBytes(values.data(), values.size_bytes());
 		}
 
 		void Read(std::string* value);
@@ -132,10 +179,65 @@ namespace PlayGround
 		}
 
 
+		// ۿ  縸 ϰ ĥ  Ͽ .
+		inline void WriteBytes(const void* data, uint64_t size)
+		{
+			if (m_WriteSize + size <= m_WriteCapacity)
+			{
+				memcpy(m_Buffer + m_WriteSize, data, size);
+				m_WriteSize += size;
+				return;
+			}
+
+			WriteOverflow(data, size);
+		}
+
+		// ۿ ִٸ 縸 ϰ ڶ  Ͽ д´.
+		inline void ReadBytes(void* data, uint64_t size)
+		{
+			if (size <= m_ReadSize - m_ReadPosition)
+			{
+				memcpy(data, m_Buffer + m_ReadPosition, size);
+				m_ReadPosition += size;
+				return;
+			}
+
+			ReadUnderflow(data, size);
+		}
+
 	private:
+		void WriteOverflow(const void* data, uint64_t size);
+		void ReadUnderflow(void* data, uint64_t size);
+		//   Ͽ .
+		void FlushBuffer();
+		// ۸ capacity ũ ø. ( ۿ   ű.)
+		void ReserveBuffer(uint64_t capacity);
+
+		//    ѹ .
+		bool WriteBlocks(const void* first, uint64_t first_size, const void* second, uint64_t second_size);
+		//    ѹ а  Ʈ  ȯѴ.
+		uint64_t ReadBlocks(void* first, uint64_t first_size, void* second, uint64_t second_size);
+
+#if defined(FILESTREAM_POSIX_IO)
+		int m_File = -1;
+		//  аų   ġ
+		uint64_t m_FilePosition = 0;
+#else
 		std::ofstream m_OutputStream;
 		std::ifstream m_InputStream;
+#endif
+		//  Ʈ m_BufferStorage, ޸ Ʈ  ͸ Ų.
+		char* m_Buffer = nullptr;
+		std::unique_ptr<char[]> m_BufferStorage;
+		uint64_t m_BufferCapacity = 0;
+		// : ۿ  ũ,  ũ ( Ʈ ƴ϶ 0)
+		uint64_t m_WriteSize = 0;
+		uint64_t m_WriteCapacity = 0;
+		// б: ۿ ä ũ, ۿ   ġ
+		uint64_t m_ReadSize = 0;
+		uint64_t m_ReadPosition = 0;
 		uint32_t m_Flags;
 		bool m_Open;
+		bool m_Eof = false;
 	};
 }
@@ -4,6 +4,7 @@
 #include "../Core/EventSystem.h"
 #include "../Core/Window.h"
 #include "../Core/Context.h"
+#include "../Core/FrameStages.h"
 
 using namespace std;
 using namespace PlayGround::Math;
@@ -44,6 +45,14 @@ namespace PlayGround
 		PollKeyboard();
 	}
 
+	bool Input::RegisterFrameStages(FrameGraph& graph, ETickType tick_group)
+	{
+		// SDL ¸ Ƿ  忡 Ѵ.
+		graph.AddStage(FrameStages::INPUT, tick_group, [this](double delta_time) { Update(delta_time); });
+
+		return true;
+	}
+
 	void Input::PostUpdate()
 	{
 		m_mouse_wheel_delta = Vector2::Zero;
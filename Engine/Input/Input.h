@@ -69,6 +69,7 @@ namespace PlayGround
         ~Input() = default;
 
         void Update(double delta_time) override;
+        bool RegisterFrameStages(FrameGraph& graph, ETickType tick_group) override;
         void PostUpdate() override;
 
         // 
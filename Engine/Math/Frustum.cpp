@@ -2,6 +2,10 @@
 #include "Frustum.h"
 #include "Matrix.h"
 #include "Plane.h"
+#include <emmintrin.h>
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
 
 using namespace std;
 
@@ -116,6 +120,28 @@ namespace PlayGround::Math
         return result;
     }
 
+    Intersection Frustum::CheckAabb(const Vector3& center, const Vector3& extent, bool ignore_near_plane /*= false*/) const
+    {
+        Intersection result = Intersection::Inside;
+
+        //  0 near plane̴.
+        for (uint32_t i = ignore_near_plane ? 1 : 0; i < 6; i++)
+        {
+            const Plane& plane = m_planes[i];
+
+            const float d = center.x * plane.normal.x + center.y * plane.normal.y + center.z * plane.normal.z;
+            const float r = extent.x * Util::Abs(plane.normal.x) + extent.y * Util::Abs(plane.normal.y) + extent.z * Util::Abs(plane.normal.z);
+
+            if (d + r < -plane.d)
+                return Intersection::Outside;
+
+            if (d - r < -plane.d)
+                result = Intersection::Intersects;
+        }
+
+        return result;
+    }
+
     Intersection Frustum::CheckSphere(const Vector3& center, float radius) const
     {
         //  ϴ ȮѴ.
@@ -132,4 +158,118 @@ namespace PlayGround::Math
 
         return Intersection::Inside;
     }
+
+    void Frustum::IsVisibleBatch(
+        const float* center_x, const float* center_y, const float* center_z,
+        const float* extent_x, const float* extent_y, const float* extent_z,
+        uint32_t count, uint64_t* visibility, bool ignore_near_plane /*= false*/) const
+    {
+        const uint32_t word_count = (count + 63) / 64;
+
+        for (uint32_t i = 0; i < word_count; i++)
+        {
+            visibility[i] = 0;
+        }
+
+        //  0 near plane̴.
+        const uint32_t plane_start = ignore_near_plane ? 1 : 0;
+
+        // 鸶 abs(normal)  Ƿ ̸ صд.
+        float normal_abs[6][3];
+        for (uint32_t p = 0; p < 6; p++)
+        {
+            normal_abs[p][0] = Util::Abs(m_planes[p].normal.x);
+            normal_abs[p][1] = Util::Abs(m_planes[p].normal.y);
+            normal_abs[p][2] = Util::Abs(m_planes[p].normal.z);
+        }
+
+        uint32_t i = 0;
+
+#if defined(__AVX2__)
+        // 8 ˻
+        for (; i + 8 <= count; i += 8)
+        {
+            const __m256 cx = _mm256_loadu_ps(center_x + i);
+            const __m256 cy = _mm256_loadu_ps(center_y + i);
+            const __m256 cz = _mm256_loadu_ps(center_z + i);
+            const __m256 ex = _mm256_loadu_ps(extent_x + i);
+            const __m256 ey = _mm256_loadu_ps(extent_y + i);
+            const __m256 ez = _mm256_loadu_ps(extent_z + i);
+
+            __m256 inside = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+
+            for (uint32_t p = plane_start; p < 6; p++)
+            {
+                const Plane& plane = m_planes[p];
+
+                // d = dot(center, n), r = dot(extent, abs(n))
+                __m256 d = _mm256_mul_ps(cx, _mm256_set1_ps(plane.normal.x));
+                d = _mm256_add_ps(d, _mm256_mul_ps(cy, _mm256_set1_ps(plane.normal.y)));
+                d = _mm256_add_ps(d, _mm256_mul_ps(cz, _mm256_set1_ps(plane.normal.z)));
+
+                __m256 r = _mm256_mul_ps(ex, _mm256_set1_ps(normal_abs[p][0]));
+                r = _mm256_add_ps(r, _mm256_mul_ps(ey, _mm256_set1_ps(normal_abs[p][1])));
+                r = _mm256_add_ps(r, _mm256_mul_ps(ez, _mm256_set1_ps(normal_abs[p][2])));
+
+                // d + r < -plane.d   ٱ ִ.
+                const __m256 outside = _mm256_cmp_ps(_mm256_add_ps(d, r), _mm256_set1_ps(-plane.d), _CMP_LT_OQ);
+                inside = _mm256_andnot_ps(outside, inside);
+            }
+
+            const uint64_t bits = static_cast<uint64_t>(_mm256_movemask_ps(inside));
+            visibility[i / 64] |= bits << (i % 64);
+        }
+#endif
+
+        // 4 ˻
+        for (; i + 4 <= count; i += 4)
+        {
+            const __m128 cx = _mm_loadu_ps(center_x + i);
+            const __m128 cy = _mm_loadu_ps(center_y + i);
+            const __m128 cz = _mm_loadu_ps(center_z + i);
+            const __m128 ex = _mm_loadu_ps(extent_x + i);
+            const __m128 ey = _mm_loadu_ps(extent_y + i);
+            const __m128 ez = _mm_loadu_ps(extent_z + i);
+
+            __m128 inside = _mm_castsi128_ps(_mm_set1_epi32(-1));
+
+            for (uint32_t p = plane_start; p < 6; p++)
+            {
+                const Plane& plane = m_planes[p];
+
+                __m128 d = _mm_mul_ps(cx, _mm_set1_ps(plane.normal.x));
+                d = _mm_add_ps(d, _mm_mul_ps(cy, _mm_set1_ps(plane.normal.y)));
+                d = _mm_add_ps(d, _mm_mul_ps(cz, _mm_set1_ps(plane.normal.z)));
+
+                __m128 r = _mm_mul_ps(ex, _mm_set1_ps(normal_abs[p][0]));
+                r = _mm_add_ps(r, _mm_mul_ps(ey, _mm_set1_ps(normal_abs[p][1])));
+                r = _mm_add_ps(r, _mm_mul_ps(ez, _mm_set1_ps(normal_abs[p][2])));
+
+                const __m128 outside = _mm_cmplt_ps(_mm_add_ps(d, r), _mm_set1_ps(-plane.d));
+                inside = _mm_andnot_ps(outside, inside);
+            }
+
+            const uint64_t bits = static_cast<uint64_t>(_mm_movemask_ps(inside));
+            visibility[i / 64] |= bits << (i % 64);
+        }
+
+        //  ͵ ϳ ˻Ѵ.
+        for (; i < count; i++)
+        {
+            bool inside = true;
+
+            for (uint32_t p = plane_start; p < 6 && inside; p++)
+            {
+                const Plane& plane = m_planes[p];
+
+                const float d = center_x[i] * plane.normal.x + center_y[i] * plane.normal.y + center_z[i] * plane.normal.z;
+                const float r = extent_x[i] * normal_abs[p][0] + extent_y[i] * normal_abs[p][1] + extent_z[i] * normal_abs[p][2];
+
+                inside = !(d + r < -plane.d);
+            }
+
+            if (inside)
+                visibility[i / 64] |= uint64_t(1) << (i % 64);
+        }
+    }
 }
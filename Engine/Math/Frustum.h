@@ -16,6 +16,17 @@ namespace PlayGround::Math
 
         bool IsVisible(const Vector3& center, const Vector3& extent, bool ignore_near_plane = false) const;
 
+        // SoA  AABB 迭 ѹ 4 (AVX2 8)   ˻Ѵ.
+        // ̴ ڽ Ʈ visibility Ҵ. visibility (count + 63) / 64 尡 ־ Ѵ.
+        // ignore_near_plane̶ near plane ˻ ʴ´.
+        void IsVisibleBatch(
+            const float* center_x, const float* center_y, const float* center_z,
+            const float* extent_x, const float* extent_y, const float* extent_z,
+            uint32_t count, uint64_t* visibility, bool ignore_near_plane = false) const;
+
+        // ະ ũ⸦ ״ ϴ AABB ˻ (° ȿ ִٸ Inside)
+        Intersection CheckAabb(const Vector3& center, const Vector3& extent, bool ignore_near_plane = false) const;
+
     private:
         Intersection CheckCube(const Vector3& center, const Vector3& extent) const;
         Intersection CheckSphere(const Vector3& center, float radius) const;
@@ -0,0 +1,166 @@
+#pragma once
+
+//  Ÿ SIMD 
+// x64 SSE2 ׻ Ƿ ⺻ Ѱ AVX2 ϸ (/arch:AVX2)   óϴ ε Ҵ.
+// MATH_NO_SIMD ϸ Į θ .
+// Į ڵ   ϰ ϸ FMA  Ƿ ( )  Į ο Ʈ  .
+#if !defined(MATH_NO_SIMD) && (defined(_M_X64) || defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define MATH_SIMD_SSE 1
+#include <emmintrin.h>
+#if defined(__AVX2__)
+#define MATH_SIMD_AVX2 1
+#include <immintrin.h>
+#endif
+#endif
+
+#if defined(MATH_SIMD_SSE)
+namespace PlayGround::Math::Simd
+{
+	//    Ǿ ִ. (data[ * 4 + ])
+	//    Ծ(v * M)̹Ƿ C = A * B j°  A  B j°  ҷ  ̴.
+	inline void MultiplyMatrix(const float* a, const float* b, float* out)
+	{
+#if defined(MATH_SIMD_AVX2)
+		//   ѹ Ѵ.
+		const __m256 a0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(a + 0));
+		const __m256 a1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(a + 4));
+		const __m256 a2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(a + 8));
+		const __m256 a3 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(a + 12));
+
+		for (int j = 0; j < 4; j += 2)
+		{
+			const __m256 b01 = _mm256_loadu_ps(b + j * 4);
+
+			__m256 r = _mm256_mul_ps(a0, _mm256_permute_ps(b01, 0x00));
+			r = _mm256_add_ps(r, _mm256_mul_ps(a1, _mm256_permute_ps(b01, 0x55)));
+			r = _mm256_add_ps(r, _mm256_mul_ps(a2, _mm256_permute_ps(b01, 0xAA)));
+			r = _mm256_add_ps(r, _mm256_mul_ps(a3, _mm256_permute_ps(b01, 0xFF)));
+
+			_mm256_storeu_ps(out + j * 4, r);
+		}
+#else
+		const __m128 a0 = _mm_loadu_ps(a + 0);
+		const __m128 a1 = _mm_loadu_ps(a + 4);
+		const __m128 a2 = _mm_loadu_ps(a + 8);
+		const __m128 a3 = _mm_loadu_ps(a + 12);
+
+		for (int j = 0; j < 4; j++)
+		{
+			const __m128 bj = _mm_loadu_ps(b + j * 4);
+
+			__m128 r = _mm_mul_ps(a0, _mm_shuffle_ps(bj, bj, _MM_SHUFFLE(0, 0, 0, 0)));
+			r = _mm_add_ps(r, _mm_mul_ps(a1, _mm_shuffle_ps(bj, bj, _MM_SHUFFLE(1, 1, 1, 1))));
+			r = _mm_add_ps(r, _mm_mul_ps(a2, _mm_shuffle_ps(bj, bj, _MM_SHUFFLE(2, 2, 2, 2))));
+			r = _mm_add_ps(r, _mm_mul_ps(a3, _mm_shuffle_ps(bj, bj, _MM_SHUFFLE(3, 3, 3, 3))));
+
+			_mm_storeu_ps(out + j * 4, r);
+		}
+#endif
+	}
+
+	//   xyz  (w 1),      ´.
+	// w  ° ҵ ǹǷ 1 Ἥ ״    ְ Ѵ.
+	inline __m128 MatrixScale(const float* m)
+	{
+		const __m128 c0 = _mm_loadu_ps(m + 0);
+		const __m128 c1 = _mm_loadu_ps(m + 4);
+		const __m128 c2 = _mm_loadu_ps(m + 8);
+		const __m128 c3 = _mm_loadu_ps(m + 12);
+
+		// i° Ұ i° ࿡   ȴ.
+		__m128 length_squared = _mm_mul_ps(c0, c0);
+		length_squared = _mm_add_ps(length_squared, _mm_mul_ps(c1, c1));
+		length_squared = _mm_add_ps(length_squared, _mm_mul_ps(c2, c2));
+
+		const __m128 product = _mm_mul_ps(_mm_mul_ps(_mm_mul_ps(c0, c1), c2), c3);
+		const __m128 negative = _mm_and_ps(_mm_cmplt_ps(product, _mm_setzero_ps()), _mm_set1_ps(-0.0f));
+
+		const __m128 scale = _mm_xor_ps(_mm_sqrt_ps(length_squared), negative);
+		const __m128 mask_xyz = _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1));
+
+		return _mm_or_ps(_mm_and_ps(scale, mask_xyz), _mm_set_ps(1.0f, 0.0f, 0.0f, 0.0f));
+	}
+
+	//  (Ľ 0̸  ǵ ʴ´.)
+	// ġ    ġ̹Ƿ    ״   ִ.
+	inline void InvertMatrix(const float* m, float* out)
+	{
+		__m128 row0 = _mm_loadu_ps(m + 0);
+		__m128 row1 = _mm_loadu_ps(m + 4);
+		__m128 row2 = _mm_loadu_ps(m + 8);
+		__m128 row3 = _mm_loadu_ps(m + 12);
+
+		// μ   ġϰ Ʒ   ݾ ٲ۴.
+		_MM_TRANSPOSE4_PS(row0, row1, row2, row3);
+		row1 = _mm_shuffle_ps(row1, row1, _MM_SHUFFLE(1, 0, 3, 2));
+		row3 = _mm_shuffle_ps(row3, row3, _MM_SHUFFLE(1, 0, 3, 2));
+
+		__m128 minor0, minor1, minor2, minor3;
+		__m128 tmp;
+
+		tmp = _mm_mul_ps(row2, row3);
+		tmp = _mm_shuffle_ps(tmp, tmp, 0xB1);
+		minor0 = _mm_mul_ps(row1, tmp);
+		minor1 = _mm_mul_ps(row0, tmp);
+		tmp = _mm_shuffle_ps(tmp, tmp, 0x4E);
+		minor0 = _mm_sub_ps(_mm_mul_ps(row1, tmp), minor0);
+		minor1 = _mm_sub_ps(_mm_mul_ps(row0, tmp), minor1);
+		minor1 = _mm_shuffle_ps(minor1, minor1, 0x4E);
+
+		tmp = _mm_mul_ps(row1, row2);
+		tmp = _mm_shuffle_ps(tmp, tmp, 0xB1);
+		minor0 = _mm_add_ps(_mm_mul_ps(row3, tmp), minor0);
+		minor3 = _mm_mul_ps(row0, tmp);
+		tmp = _mm_shuffle_ps(tmp, tmp, 0x4E);
+		minor0 = _mm_sub_ps(minor0, _mm_mul_ps(row3, tmp));
+		minor3 = _mm_sub_ps(_mm_mul_ps(row0, tmp), minor3);
+		minor3 = _mm_shuffle_ps(minor3, minor3, 0x4E);
+
+		tmp = _mm_mul_ps(_mm_shuffle_ps(row1, row1, 0x4E), row3);
+		tmp = _mm_shuffle_ps(tmp, tmp, 0xB1);
+		row2 = _mm_shuffle_ps(row2, row2, 0x4E);
+		minor0 = _mm_add_ps(_mm_mul_ps(row2, tmp), minor0);
+		minor2 = _mm_mul_ps(row0, tmp);
+		tmp = _mm_shuffle_ps(tmp, tmp, 0x4E);
+		minor0 = _mm_sub_ps(minor0, _mm_mul_ps(row2, tmp));
+		minor2 = _mm_sub_ps(_mm_mul_ps(row0, tmp), minor2);
+		minor2 = _mm_shuffle_ps(minor2, minor2, 0x4E);
+
+		tmp = _mm_mul_ps(row0, row1);
+		tmp = _mm_shuffle_ps(tmp, tmp, 0xB1);
+		minor2 = _mm_add_ps(_mm_mul_ps(row3, tmp), minor2);
+		minor3 = _mm_sub_ps(_mm_mul_ps(row2, tmp), minor3);
+		tmp = _mm_shuffle_ps(tmp, tmp, 0x4E);
+		minor2 = _mm_sub_ps(_mm_mul_ps(row3, tmp), minor2);
+		minor3 = _mm_sub_ps(minor3, _mm_mul_ps(row2, tmp));
+
+		tmp = _mm_mul_ps(row0, row3);
+		tmp = _mm_shuffle_ps(tmp, tmp, 0xB1);
+		minor1 = _mm_sub_ps(minor1, _mm_mul_ps(row2, tmp));
+		minor2 = _mm_add_ps(_mm_mul_ps(row1, tmp), minor2);
+		tmp = _mm_shuffle_ps(tmp, tmp, 0x4E);
+		minor1 = _mm_add_ps(_mm_mul_ps(row2, tmp), minor1);
+		minor2 = _mm_sub_ps(minor2, _mm_mul_ps(row1, tmp));
+
+		tmp = _mm_mul_ps(row0, row2);
+		tmp = _mm_shuffle_ps(tmp, tmp, 0xB1);
+		minor1 = _mm_add_ps(_mm_mul_ps(row3, tmp), minor1);
+		minor3 = _mm_sub_ps(minor3, _mm_mul_ps(row1, tmp));
+		tmp = _mm_shuffle_ps(tmp, tmp, 0x4E);
+		minor1 = _mm_sub_ps(minor1, _mm_mul_ps(row3, tmp));
+		minor3 = _mm_add_ps(_mm_mul_ps(row1, tmp), minor3);
+
+		// Ľ (ٻ    Į ο е .)
+		__m128 det = _mm_mul_ps(row0, minor0);
+		det = _mm_add_ps(_mm_shuffle_ps(det, det, 0x4E), det);
+		det = _mm_add_ss(_mm_shuffle_ps(det, det, 0xB1), det);
+		det = _mm_div_ss(_mm_set_ss(1.0f), det);
+		det = _mm_shuffle_ps(det, det, 0x00);
+
+		_mm_storeu_ps(out + 0, _mm_mul_ps(det, minor0));
+		_mm_storeu_ps(out + 4, _mm_mul_ps(det, minor1));
+		_mm_storeu_ps(out + 8, _mm_mul_ps(det, minor2));
+		_mm_storeu_ps(out + 12, _mm_mul_ps(det, minor3));
+	}
+}
+#endif
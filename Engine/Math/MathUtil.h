@@ -162,7 +162,7 @@ namespace PlayGround::Math::Util
     }
 
     template <typename T>
-    T Random(T from = static_cast < T>0, T to = static_cast<T>(1))
+    T Random(T from = static_cast<T>(0), T to = static_cast<T>(1))
     {
         std::random_device rd;
         std::mt19937 eng(rd());
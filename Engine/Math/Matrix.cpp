@@ -17,7 +17,147 @@ namespace PlayGround::Math
     string Matrix::ToString() const
     {
         char buffer[256] = {};
-        sprintf_s(buffer, "%f, %f, %f, %f, %f, %f, %f, %f, %f, %f, %f, %f, %f, %f, %f, %f", m00, m01, m02, m03, m10, m11, m12, m13, m20, m21, m22, m23, m30, m31, m32, m33);
+        snprintf(buffer, sizeof(buffer), "%f, %f, %f, %f, %f, %f, %f, %f, %f, %f, %f, %f, %f, %f, %f, %f", m00, m01, m02, m03, m10, m11, m12, m13, m20, m21, m22, m23, m30, m31, m32, m33);
         return string(buffer);
     }
+
+    void Matrix::ComposeTRS(span<const Vector3> translations, span<const Quaternion> rotations, span<const Vector3> scales, span<Matrix> result)
+    {
+        ASSERT(translations.size() == result.size() && rotations.size() == result.size() && scales.size() == result.size());
+
+        const size_t count = result.size();
+        size_t i = 0;
+
+#if defined(MATH_SIMD_SSE)
+        // 4 SoA ٲ㼭 ȸ  ϰ ٽ ĸ  ġؼ Ѵ.
+        const __m128 one = _mm_set1_ps(1.0f);
+        const __m128 two = _mm_set1_ps(2.0f);
+        const __m128 last_column = _mm_set_ps(1.0f, 0.0f, 0.0f, 0.0f);
+
+        for (; i + 4 <= count; i += 4)
+        {
+            __m128 x = _mm_loadu_ps(&rotations[i + 0].x);
+            __m128 y = _mm_loadu_ps(&rotations[i + 1].x);
+            __m128 z = _mm_loadu_ps(&rotations[i + 2].x);
+            __m128 w = _mm_loadu_ps(&rotations[i + 3].x);
+            _MM_TRANSPOSE4_PS(x, y, z, w);
+
+            const __m128 sx = _mm_set_ps(scales[i + 3].x, scales[i + 2].x, scales[i + 1].x, scales[i + 0].x);
+            const __m128 sy = _mm_set_ps(scales[i + 3].y, scales[i + 2].y, scales[i + 1].y, scales[i + 0].y);
+            const __m128 sz = _mm_set_ps(scales[i + 3].z, scales[i + 2].z, scales[i + 1].z, scales[i + 0].z);
+            const __m128 tx = _mm_set_ps(translations[i + 3].x, translations[i + 2].x, translations[i + 1].x, translations[i + 0].x);
+            const __m128 ty = _mm_set_ps(translations[i + 3].y, translations[i + 2].y, translations[i + 1].y, translations[i + 0].y);
+            const __m128 tz = _mm_set_ps(translations[i + 3].z, translations[i + 2].z, translations[i + 1].z, translations[i + 0].z);
+
+            // CreateRotation  
+            const __m128 xx = _mm_mul_ps(x, x);
+            const __m128 yy = _mm_mul_ps(y, y);
+            const __m128 zz = _mm_mul_ps(z, z);
+            const __m128 xy = _mm_mul_ps(x, y);
+            const __m128 zw = _mm_mul_ps(z, w);
+            const __m128 zx = _mm_mul_ps(z, x);
+            const __m128 yw = _mm_mul_ps(y, w);
+            const __m128 yz = _mm_mul_ps(y, z);
+            const __m128 xw = _mm_mul_ps(x, w);
+
+            //   ( 0, 1, 2   ȸ,  3 ̵)
+            __m128 c0r0 = _mm_mul_ps(sx, _mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(yy, zz))));
+            __m128 c0r1 = _mm_mul_ps(sy, _mm_mul_ps(two, _mm_sub_ps(xy, zw)));
+            __m128 c0r2 = _mm_mul_ps(sz, _mm_mul_ps(two, _mm_add_ps(zx, yw)));
+            __m128 c0r3 = tx;
+
+            __m128 c1r0 = _mm_mul_ps(sx, _mm_mul_ps(two, _mm_add_ps(xy, zw)));
+            __m128 c1r1 = _mm_mul_ps(sy, _mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(zz, xx))));
+            __m128 c1r2 = _mm_mul_ps(sz, _mm_mul_ps(two, _mm_sub_ps(yz, xw)));
+            __m128 c1r3 = ty;
+
+            __m128 c2r0 = _mm_mul_ps(sx, _mm_mul_ps(two, _mm_sub_ps(zx, yw)));
+            __m128 c2r1 = _mm_mul_ps(sy, _mm_mul_ps(two, _mm_add_ps(yz, xw)));
+            __m128 c2r2 = _mm_mul_ps(sz, _mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(yy, xx))));
+            __m128 c2r3 = tz;
+
+            _MM_TRANSPOSE4_PS(c0r0, c0r1, c0r2, c0r3);
+            _MM_TRANSPOSE4_PS(c1r0, c1r1, c1r2, c1r3);
+            _MM_TRANSPOSE4_PS(c2r0, c2r1, c2r2, c2r3);
+
+            // ġ  k° Ͱ k°  ̴.
+            const __m128 columns[4][3] =
+            {
+                { c0r0, c1r0, c2r0 },
+                { c0r1, c1r1, c2r1 },
+                { c0r2, c1r2, c2r2 },
+                { c0r3, c1r3, c2r3 }
+            };
+
+            for (size_t k = 0; k < 4; k++)
+            {
+                float* out = &result[i + k].m00;
+                _mm_storeu_ps(out + 0, columns[k][0]);
+                _mm_storeu_ps(out + 4, columns[k][1]);
+                _mm_storeu_ps(out + 8, columns[k][2]);
+                _mm_storeu_ps(out + 12, last_column);
+            }
+        }
+#endif
+
+        for (; i < count; i++)
+        {
+            result[i] = Matrix(translations[i], rotations[i], scales[i]);
+        }
+    }
+
+    void Matrix::MultiplyMatrices(span<const Matrix> lhs, span<const Matrix> rhs, span<Matrix> result)
+    {
+        ASSERT(lhs.size() == result.size() && rhs.size() == result.size());
+
+        for (size_t i = 0; i < result.size(); i++)
+        {
+#if defined(MATH_SIMD_SSE)
+            Simd::MultiplyMatrix(lhs[i].Data(), rhs[i].Data(), &result[i].m00);
+#else
+            result[i] = lhs[i] * rhs[i];
+#endif
+        }
+    }
+
+    void Matrix::TransformPoints(const Matrix& matrix, span<const Vector3> points, span<Vector3> result)
+    {
+        ASSERT(points.size() == result.size());
+
+        const size_t count = points.size();
+
+#if defined(MATH_SIMD_SSE)
+        //  ѹ Ƶθ   4,  3̸ ȴ.
+        __m128 r0 = _mm_loadu_ps(&matrix.m00);
+        __m128 r1 = _mm_loadu_ps(&matrix.m01);
+        __m128 r2 = _mm_loadu_ps(&matrix.m02);
+        __m128 r3 = _mm_loadu_ps(&matrix.m03);
+        _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+
+        const __m128 one = _mm_set1_ps(1.0f);
+
+        for (size_t i = 0; i < count; i++)
+        {
+            const Vector3& point = points[i];
+
+            __m128 v = _mm_mul_ps(_mm_set1_ps(point.x), r0);
+            v = _mm_add_ps(v, _mm_mul_ps(_mm_set1_ps(point.y), r1));
+            v = _mm_add_ps(v, _mm_mul_ps(_mm_set1_ps(point.z), r2));
+            v = _mm_add_ps(v, r3);
+
+            // Į ó w  Ѵ.
+            const __m128 w_inverse = _mm_div_ps(one, _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 3, 3)));
+            v = _mm_mul_ps(v, w_inverse);
+
+            float out[4];
+            _mm_storeu_ps(out, v);
+            result[i] = Vector3(out[0], out[1], out[2]);
+        }
+#else
+        for (size_t i = 0; i < count; i++)
+        {
+            result[i] = points[i] * matrix;
+        }
+#endif
+    }
 }
\ No newline at end of file
@@ -1,8 +1,10 @@
 #pragma once
 
+#include <span>
 #include "Quaternion.h"
 #include "Vector3.h"
 #include "Vector4.h"
+#include "MathSimd.h"
 
 namespace PlayGround::Math
 {
@@ -92,6 +94,20 @@ namespace PlayGround::Math
 
         Quaternion GetRotation() const
         {
+#if defined(MATH_SIMD_SSE)
+            const __m128 scale = Simd::MatrixScale(Data());
+
+            // 0  츦 Ѵ. (w ׻ 1̹Ƿ xyz .)
+            if ((_mm_movemask_ps(_mm_cmpeq_ps(scale, _mm_setzero_ps())) & 0x7) != 0) { return Quaternion(0, 0, 0, 1); }
+
+            //  i° Ұ i° ̹Ƿ  Ϸ  ึ  Ͱ . (w 1 .)
+            Matrix normalized;
+            _mm_storeu_ps(&normalized.m00, _mm_div_ps(_mm_loadu_ps(&m00), scale));
+            _mm_storeu_ps(&normalized.m01, _mm_div_ps(_mm_loadu_ps(&m01), scale));
+            _mm_storeu_ps(&normalized.m02, _mm_div_ps(_mm_loadu_ps(&m02), scale));
+
+            return RotationMatrixToQuaternion(normalized);
+#else
             const Vector3 scale = GetScale();
 
             // 0  츦 Ѵ.
@@ -105,6 +121,7 @@ namespace PlayGround::Math
             normalized.m30 = 0; normalized.m31 = 0; normalized.m32 = 0; normalized.m33 = 1.0f;
 
             return RotationMatrixToQuaternion(normalized);
+#endif
         }
 
         static inline Quaternion RotationMatrixToQuaternion(const Matrix& mRot)
@@ -163,6 +180,12 @@ namespace PlayGround::Math
 
         Vector3 GetScale() const
         {
+#if defined(MATH_SIMD_SSE)
+            float scale[4];
+            _mm_storeu_ps(scale, Simd::MatrixScale(Data()));
+
+            return Vector3(scale[0], scale[1], scale[2]);
+#else
             const int xs = (Util::Sign(m00 * m01 * m02 * m03) < 0) ? -1 : 1;
             const int ys = (Util::Sign(m10 * m11 * m12 * m13) < 0) ? -1 : 1;
             const int zs = (Util::Sign(m20 * m21 * m22 * m23) < 0) ? -1 : 1;
@@ -172,6 +195,7 @@ namespace PlayGround::Math
                 static_cast<float>(ys) * Util::Sqrt(m10 * m10 + m11 * m11 + m12 * m12),
                 static_cast<float>(zs) * Util::Sqrt(m20 * m20 + m21 * m21 + m22 * m22)
             );
+#endif
         }
 
         static inline Matrix CreateScale(float scale) { return CreateScale(scale, scale, scale); }
@@ -251,6 +275,12 @@ namespace PlayGround::Math
         inline Matrix Inverted() const { return Invert(*this); }
         static inline Matrix Invert(const Matrix& matrix)
         {
+#if defined(MATH_SIMD_SSE)
+            Matrix result;
+            Simd::InvertMatrix(matrix.Data(), &result.m00);
+
+            return result;
+#else
             float v0 = matrix.m20 * matrix.m31 - matrix.m21 * matrix.m30;
             float v1 = matrix.m20 * matrix.m32 - matrix.m22 * matrix.m30;
             float v2 = matrix.m20 * matrix.m33 - matrix.m23 * matrix.m30;
@@ -304,6 +334,7 @@ namespace PlayGround::Math
                 i10, i11, i12, i13,
                 i20, i21, i22, i23,
                 i30, i31, i32, i33);
+#endif
         }
 
         inline void Decompose(Vector3& scale, Quaternion& rotation, Vector3& translation) const
@@ -323,6 +354,12 @@ namespace PlayGround::Math
 
         Matrix operator*(const Matrix& rhs) const
         {
+#if defined(MATH_SIMD_SSE)
+            Matrix result;
+            Simd::MultiplyMatrix(Data(), rhs.Data(), &result.m00);
+
+            return result;
+#else
             return Matrix(
                 m00 * rhs.m00 + m01 * rhs.m10 + m02 * rhs.m20 + m03 * rhs.m30,
                 m00 * rhs.m01 + m01 * rhs.m11 + m02 * rhs.m21 + m03 * rhs.m31,
@@ -341,6 +378,7 @@ namespace PlayGround::Math
                 m30 * rhs.m02 + m31 * rhs.m12 + m32 * rhs.m22 + m33 * rhs.m32,
                 m30 * rhs.m03 + m31 * rhs.m13 + m32 * rhs.m23 + m33 * rhs.m33
             );
+#endif
         }
 
         void operator*=(const Matrix& rhs) { (*this) = (*this) * rhs; }
@@ -401,6 +439,15 @@ namespace PlayGround::Math
         inline const float* Data() const { return &m00; }
         std::string ToString() const;
 
+        // 迭   (Ʈ, ø, Űó   ѹ ٷ  .)
+        //  迭 Է° ũⰡ ƾ ϸ Է°  迭̾ ȴ.
+        // result[i] = Matrix(translations[i], rotations[i], scales[i])
+        static void ComposeTRS(std::span<const Vector3> translations, std::span<const Quaternion> rotations, std::span<const Vector3> scales, std::span<Matrix> result);
+        // result[i] = lhs[i] * rhs[i]
+        static void MultiplyMatrices(std::span<const Matrix> lhs, std::span<const Matrix> rhs, std::span<Matrix> result);
+        // result[i] = points[i] * matrix
+        static void TransformPoints(const Matrix& matrix, std::span<const Vector3> points, std::span<Vector3> result);
+
         float m00 = 0.0f, m10 = 0.0f, m20 = 0.0f, m30 = 0.0f;
         float m01 = 0.0f, m11 = 0.0f, m21 = 0.0f, m31 = 0.0f;
         float m02 = 0.0f, m12 = 0.0f, m22 = 0.0f, m32 = 0.0f;
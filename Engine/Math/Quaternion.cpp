@@ -21,7 +21,7 @@ namespace PlayGround::Math
 	string Quaternion::ToString() const
 	{
 		char buffer[256] = {};
-		sprintf_s(buffer, "X:%f, Y:%f, Z:%f, W:%f", x, y, z, w);
+		snprintf(buffer, sizeof(buffer), "X:%f, Y:%f, Z:%f, W:%f", x, y, z, w);
 		return string(buffer);
 	}
 }
\ No newline at end of file
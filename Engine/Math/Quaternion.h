@@ -128,6 +128,23 @@ namespace PlayGround::Math
             return quaternion.Normalized();
         }
 
+        //    (ӵ ϴ.)
+        //  ȸ  ٸ  ҾϹǷ   Ѵ.
+        static inline Quaternion Slerp(const Quaternion& a, const Quaternion& b, const float t)
+        {
+            float cos_theta = Dot(a, b);
+            const Quaternion end = cos_theta < 0.0f ? -b : b;
+            cos_theta = cos_theta < 0.0f ? -cos_theta : cos_theta;
+
+            if (cos_theta > 0.9995f)
+                return (a * (1.0f - t) + end * t).Normalized();
+
+            const float theta = std::acos(cos_theta);
+            const float sin_theta_inv = 1.0f / Util::Sin(theta);
+
+            return a * (Util::Sin((1.0f - t) * theta) * sin_theta_inv) + end * (Util::Sin(t * theta) * sin_theta_inv);
+        }
+
         static inline Quaternion Multiply(const Quaternion& Qa, const Quaternion& Qb)
         {
             const float x = Qa.x;
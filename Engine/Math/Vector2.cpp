@@ -11,7 +11,7 @@ namespace PlayGround::Math
 	string Vector2::ToString() const
 	{
 		char buffer[256] = {};
-		sprintf_s(buffer, "X:%f, Y:%f", x, y);
+		snprintf(buffer, sizeof(buffer), "X:%f, Y:%f", x, y);
 		return string(buffer);
 	}
 }
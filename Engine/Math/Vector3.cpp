@@ -25,7 +25,7 @@ namespace PlayGround::Math
     string Vector3::ToString() const
     {
         char buffer[256] = {};
-        sprintf_s(buffer, "X:%f, Y:%f, Z:%f", x, y, z);
+        snprintf(buffer, sizeof(buffer), "X:%f, Y:%f, Z:%f", x, y, z);
         return string(buffer);
     }
 }
\ No newline at end of file
@@ -5,6 +5,7 @@
 #include "../Profiling/Profiler.h"
 #include "../Rendering/Renderer.h"
 #include "../Core/Context.h"
+#include "../Core/FrameStages.h"
 #include "../Core/Settings.h"
 #include "../Core/Engine.h"
 #include "../World/World.h"
@@ -130,6 +131,15 @@ namespace PlayGround
 		m_IsSimulating = false;
 	}
 
+	bool Physics::RegisterFrameStages(FrameGraph& graph, ETickType tick_group)
+	{
+		// ùķ̼ ü Ʈ ϰ    ߰Ѵ.
+		//   ٸ ,  ļ Ŀ 忡 Ѵ.
+		graph.AddStage(FrameStages::PHYSICS, tick_group, [this](double delta_time) { Update(delta_time); });
+
+		return true;
+	}
+
 	void Physics::AddBody(btRigidBody* body) const
 	{
 		if (!m_World)
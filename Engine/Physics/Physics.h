@@ -34,6 +34,7 @@ namespace PlayGround
 
 		void OnInit() override;
 		void Update(double delta_time) override;
+		bool RegisterFrameStages(FrameGraph& graph, ETickType tick_group) override;
 
 		// ü 忡 ߰Ѵ.
 		void AddBody(btRigidBody* body) const;
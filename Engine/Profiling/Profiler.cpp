@@ -25,6 +25,8 @@ namespace PlayGround
 		m_vecTime_blocks_write.reserve(initial_capacity);
 		m_vecTime_blocks_write.resize(initial_capacity);
 
+		m_MainThreadID = this_thread::get_id();
+
 		//   ̺Ʈ 
 		SUBSCRIBE_TO_EVENT(EventType::PostPresent, EVENT_HANDLER(OnPostPresent));
 	}
@@ -209,6 +211,10 @@ namespace PlayGround
 		if (!m_Profile || !m_Poll)
 			return;
 
+		//  ׷ Ŀ 忡 ȣǸ ŸӺ  ̹Ƿ Ѵ.
+		if (this_thread::get_id() != m_MainThreadID)
+			return;
+
 		// ϸ  Ȯ
 		const bool can_profile_cpu = (type == TimeBlockType::CPU) && m_Profile_CPU;
 		const bool can_profile_gpu = (type == TimeBlockType::GPU) && m_Profile_GPU;
@@ -227,6 +233,9 @@ namespace PlayGround
 
 	void Profiler::TimeBlockEnd()
 	{
+		if (this_thread::get_id() != m_MainThreadID)
+			return;
+
 		TimeBlock* time_block = GetLastIncompleteTimeBlock();
 
 		if (time_block)
@@ -2,6 +2,7 @@
 
 #include <string>
 #include <vector>
+#include <thread>
 #include "TimeBlock.h"
 #include "../Core/SubModule.h"
 #include "../Core/StopWatch.h"
@@ -33,6 +34,8 @@ namespace PlayGround
 		void OnInit() override;
 		void PrevUpdate() override;
 		void PostUpdate() override;
+		// Ʈ Ƿ  ׷   ʴ´.
+		bool RegisterFrameStages(FrameGraph& graph, ETickType tick_group) override { return true; }
 
 		void TimeBlockStart(const char* func_name, TimeBlockType type, RHI_CommandList* cmd_list = nullptr);
 		void TimeBlockEnd();
@@ -189,6 +192,8 @@ namespace PlayGround
 		bool m_Increase_capactiy = false;
 		bool m_AllowTime_block_end = true;
 		void* m_Query_disjoint = nullptr;
+		// ŸӺ  忡 Ѵ.
+		std::thread::id m_MainThreadID;
 
 		ResourceCache* m_ResourceManager = nullptr;
 		Renderer* m_Renderer = nullptr;
@@ -268,6 +268,25 @@ namespace PlayGround
 		return true;
 	}
 
+	uint64_t RHI_Texture::ReleaseCpuData()
+	{
+		// GPU ҽ     ڿ Ѵ.
+		if (m_IsLoading || !HasData() || !m_resource_view_srv || HasPerMipViews())
+			return 0;
+
+		// ü   ־  ͸  ʰ ٽ ҷ  ִ.
+		if (!HasFilePathNative() || !FileSystem::Exists(GetResourceFilePathNative()))
+			return 0;
+
+		const uint64_t size = m_ObjectSizeCPU;
+
+		m_data.clear();
+		m_data.shrink_to_fit();
+		ComputeMemoryUsage();
+
+		return size;
+	}
+
 	RHI_Texture_Mip& RHI_Texture::CreateMip(const uint32_t array_index)
 	{
 		while (array_index >= m_data.size())
@@ -66,6 +66,7 @@ namespace PlayGround
 
         bool SaveToFile(const std::string& file_path) override;
         bool LoadFromFile(const std::string& file_path) override;
+        uint64_t ReleaseCpuData() override;
 
         inline uint32_t GetWidth()                                const { return m_width; }
         inline void SetWidth(const uint32_t width) { m_width = width; }
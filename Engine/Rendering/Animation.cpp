@@ -1,10 +1,386 @@
 #include "Common.h"
 #include "Animation.h"
+#include "../IO/AssetContainer.h"
+#include <algorithm>
+#include <cmath>
 
 using namespace std;
+using namespace PlayGround::Math;
 
 namespace PlayGround
 {
+	// ִϸ̼  ûũ
+	static constexpr uint32_t ANIMATION_CHUNK_HEADER = AssetChunkId('H', 'E', 'A', 'D');
+	static constexpr uint32_t ANIMATION_CHUNK_NAME = AssetChunkId('N', 'A', 'M', 'E');
+	static constexpr uint32_t ANIMATION_CHUNK_CHANNELS = AssetChunkId('C', 'H', 'N', 'L');
+	static constexpr uint32_t ANIMATION_CHUNK_RANGES = AssetChunkId('R', 'N', 'G', 'E');
+	static constexpr uint32_t ANIMATION_CHUNK_OFFSETS = AssetChunkId('K', 'O', 'F', 'S');
+	static constexpr uint32_t ANIMATION_CHUNK_TIMES = AssetChunkId('T', 'I', 'M', 'E');
+	static constexpr uint32_t ANIMATION_CHUNK_VALUES = AssetChunkId('V', 'A', 'L', 'U');
+
+	namespace
+	{
+		// äθ ġ, ȸ, ũ
+		constexpr uint32_t TRACKS_PER_CHANNEL = 3;
+		//   ()
+		constexpr double SEGMENT_SECONDS = 1.0;
+		// Ű   ѹ ǳʶٴ ִ Ű  ( Ʈ ˻    ʰ Ѵ.)
+		constexpr uint32_t MAX_REDUCTION_SPAN = 64;
+		// smallest-three     (1 / sqrt(2))
+		constexpr float SMALLEST_THREE_RANGE = 0.70710678f;
+
+		//  
+		struct sAnimationHeader
+		{
+			double duration = 0;
+			double ticks_per_sec = 0;
+			double segment_length = 0;
+			uint32_t channel_count = 0;
+			uint32_t segment_count = 0;
+		};
+
+		inline Vector3 interpolate(const Vector3& a, const Vector3& b, const float t) { return Vector3::Lerp(a, b, t); }
+		inline Quaternion interpolate(const Quaternion& a, const Quaternion& b, const float t) { return Quaternion::Slerp(a, b, t); }
+
+		inline float get_error(const Vector3& a, const Vector3& b) { return (a - b).Length(); }
+		//  ȸ   (q -q  ȸ)
+		inline float get_error(const Quaternion& a, const Quaternion& b) { return 2.0f * acos(Util::Min(Util::Abs(Quaternion::Dot(a, b)), 1.0f)); }
+
+		inline float get_factor(const double begin, const double end, const double time)
+		{
+			return end > begin ? Util::Saturate(static_cast<float>((time - begin) / (end - begin))) : 0.0f;
+		}
+
+		//  Ʈ time Ѵ. (    Ű)
+		template <typename Key>
+		auto evaluate(const vector<Key>& keys, const double time) -> decltype(Key::value)
+		{
+			const auto it = upper_bound(keys.begin(), keys.end(), time, [](double t, const Key& key) { return t < key.time; });
+
+			if (it == keys.begin())
+				return keys.front().value;
+
+			if (it == keys.end())
+				return keys.back().value;
+
+			const Key& a = *(it - 1);
+			const Key& b = *it;
+
+			return interpolate(a.value, b.value, get_factor(a.time, b.time, time));
+		}
+
+		// յ Ű     Ű .
+		template <typename Key>
+		vector<Key> reduce_keys(const vector<Key>& keys, const float tolerance)
+		{
+			if (keys.empty())
+				return keys;
+
+			//  Ű ù Ű ٸ Ű ϳ ϴ.
+			if (all_of(keys.begin(), keys.end(), [&](const Key& key) { return get_error(key.value, keys.front().value) <= tolerance; }))
+				return { keys.front() };
+
+			const uint32_t count = static_cast<uint32_t>(keys.size());
+
+			vector<Key> result;
+			result.push_back(keys.front());
+
+			// anchor(  Ű) i + 1 ٷ ص   Ű   ̶ i .
+			uint32_t anchor = 0;
+			for (uint32_t i = 1; i + 1 < count; i++)
+			{
+				bool is_removable = i + 1 - anchor <= MAX_REDUCTION_SPAN;
+
+				for (uint32_t j = anchor + 1; is_removable && j <= i; j++)
+				{
+					const float t = get_factor(keys[anchor].time, keys[i + 1].time, keys[j].time);
+					is_removable = get_error(interpolate(keys[anchor].value, keys[i + 1].value, t), keys[j].value) <= tolerance;
+				}
+
+				if (!is_removable)
+				{
+					result.push_back(keys[i]);
+					anchor = i;
+				}
+			}
+
+			result.push_back(keys.back());
+
+			return result;
+		}
+
+		inline uint16_t quantize_unorm(const float value)
+		{
+			return static_cast<uint16_t>(Util::Saturate(value) * 65535.0f + 0.5f);
+		}
+
+		inline sAnimationRange get_range(const vector<KeyVector>& keys)
+		{
+			sAnimationRange range;
+			if (keys.empty())
+				return range;
+
+			Vector3 min = keys.front().value;
+			Vector3 max = keys.front().value;
+			for (const KeyVector& key : keys)
+			{
+				min = Vector3(Util::Min(min.x, key.value.x), Util::Min(min.y, key.value.y), Util::Min(min.z, key.value.z));
+				max = Vector3(Util::Max(max.x, key.value.x), Util::Max(max.y, key.value.y), Util::Max(max.z, key.value.z));
+			}
+
+			range.min = min;
+			range.extent = max - min;
+
+			return range;
+		}
+
+		inline void quantize(const Vector3& value, const sAnimationRange& range, uint16_t* result)
+		{
+			result[0] = quantize_unorm(range.extent.x > 0.0f ? (value.x - range.min.x) / range.extent.x : 0.0f);
+			result[1] = quantize_unorm(range.extent.y > 0.0f ? (value.y - range.min.y) / range.extent.y : 0.0f);
+			result[2] = quantize_unorm(range.extent.z > 0.0f ? (value.z - range.min.z) / range.extent.z : 0.0f);
+		}
+
+		inline Vector3 dequantize(const uint16_t* value, const sAnimationRange& range)
+		{
+			constexpr float scale = 1.0f / 65535.0f;
+
+			return Vector3(
+				range.min.x + range.extent.x * (value[0] * scale),
+				range.min.y + range.extent.y * (value[1] * scale),
+				range.min.z + range.extent.z * (value[2] * scale));
+		}
+
+		// smallest-three:  ū      15Ʈ Ѵ.
+		//  ū  ġ(2Ʈ)     Ʈ  ְ    ̷ ǻ츰.
+		inline void quantize(const Quaternion& rotation, uint16_t* result)
+		{
+			const float q[4] = { rotation.x, rotation.y, rotation.z, rotation.w };
+
+			uint32_t largest = 0;
+			for (uint32_t i = 1; i < 4; i++)
+			{
+				if (Util::Abs(q[i]) > Util::Abs(q[largest]))
+				{
+					largest = i;
+				}
+			}
+
+			//  ū    Ѵ. (q -q  ȸ)
+			const float sign = q[largest] < 0.0f ? -1.0f : 1.0f;
+
+			uint16_t packed[3] = {};
+			for (uint32_t i = 0, k = 0; i < 4; i++)
+			{
+				if (i == largest)
+					continue;
+
+				const float value = q[i] * sign / SMALLEST_THREE_RANGE * 0.5f + 0.5f;
+				packed[k++] = static_cast<uint16_t>(Util::Saturate(value) * 32767.0f + 0.5f);
+			}
+
+			result[0] = static_cast<uint16_t>((packed[0] << 1) | (largest >> 1));
+			result[1] = static_cast<uint16_t>((packed[1] << 1) | (largest & 1));
+			result[2] = static_cast<uint16_t>(packed[2] << 1);
+		}
+
+		inline Quaternion dequantize_rotation(const uint16_t* value)
+		{
+			constexpr float scale = 2.0f / 32767.0f;
+
+			const uint32_t largest = ((value[0] & 1) << 1) | (value[1] & 1);
+
+			float q[4];
+			float length_squared = 0.0f;
+			for (uint32_t i = 0, k = 0; i < 4; i++)
+			{
+				if (i == largest)
+					continue;
+
+				q[i] = ((value[k++] >> 1) * scale - 1.0f) * SMALLEST_THREE_RANGE;
+				length_squared += q[i] * q[i];
+			}
+
+			q[largest] = sqrtf(Util::Max(1.0f - length_squared, 0.0f));
+
+			return Quaternion(q[0], q[1], q[2], q[3]);
+		}
+
+		//  [start, start + length] Ű δ.
+		//    Ʈ  Ű ־ ٸ  Ű    ְ Ѵ.
+		template <typename Key, typename Quantize>
+		void append_segment(const vector<Key>& keys, const double start, const double length, const float tolerance, Quantize quantize_value, vector<uint16_t>* times, vector<uint16_t>* values)
+		{
+			if (keys.empty())
+				return;
+
+			const auto add_key = [&](const double time, const decltype(Key::value)& value)
+			{
+				times->push_back(quantize_unorm(static_cast<float>((time - start) / length)));
+				values->resize(values->size() + 3);
+				quantize_value(value, values->data() + values->size() - 3);
+			};
+
+			const double end = start + length;
+			const auto first = evaluate(keys, start);
+			const auto last = evaluate(keys, end);
+
+			//   Ű
+			const auto begin = upper_bound(keys.begin(), keys.end(), start, [](double t, const Key& key) { return t < key.time; });
+			const auto finish = lower_bound(begin, keys.end(), end, [](const Key& key, double t) { return key.time < t; });
+
+			add_key(start, first);
+
+			//  ȿ  ʴ Ʈ Ű ϳ
+			if (begin == finish && get_error(first, last) <= tolerance)
+				return;
+
+			for (auto it = begin; it != finish; ++it)
+			{
+				add_key(it->time, it->value);
+			}
+
+			add_key(end, last);
+		}
+
+		// times[i] <= time < times[i + 1] i ã´.
+		// Ŀ ó   ð ڷ ų ũ ǳʶپ   ŽѴ.
+		inline uint32_t find_key(const uint16_t* times, const uint32_t count, const float time, const uint32_t cursor)
+		{
+			const uint32_t last = count - 1;
+
+			for (uint32_t i = cursor; i <= last && i <= cursor + 1; i++)
+			{
+				if (times[i] <= time && (i == last || time < times[i + 1]))
+					return i;
+			}
+
+			const uint16_t* it = upper_bound(times, times + count, time, [](float t, uint16_t key) { return t < key; });
+
+			return it == times ? 0 : static_cast<uint32_t>(it - times) - 1;
+		}
+
+		// Ʈ [begin, end) Ű time δ  Ű   ã´. Ű ٸ false
+		inline bool find_keys(const uint16_t* times, const uint32_t begin, const uint32_t end, const float time, uint32_t* cursor, uint32_t* a, uint32_t* b, float* factor)
+		{
+			if (begin == end)
+				return false;
+
+			const uint32_t count = end - begin;
+			const uint16_t* keys = times + begin;
+			const uint32_t i = *cursor = find_key(keys, count, time, *cursor);
+			const uint32_t j = Util::Min(i + 1, count - 1);
+
+			*a = begin + i;
+			*b = begin + j;
+			*factor = keys[j] > keys[i] ? Util::Saturate((time - keys[i]) / static_cast<float>(keys[j] - keys[i])) : 0.0f;
+
+			return true;
+		}
+
+		// '\0'  ̸
+		vector<string> split_names(const char* names, const uint64_t length)
+		{
+			vector<string> result;
+			for (const char* begin = names, *end = names + (names ? length : 0); begin < end;)
+			{
+				const char* name_end = find(begin, end, '\0');
+				result.emplace_back(begin, name_end);
+				begin = name_end + 1;
+			}
+
+			return result;
+		}
+	}
+
+	void Skeleton::Clear()
+	{
+		m_vecJoints.clear();
+		m_vecJointNames.clear();
+		m_vecBones.clear();
+		m_vecBindGlobal.clear();
+		m_vecBindGlobalInverse.clear();
+	}
+
+	uint32_t Skeleton::AddJoint(const string& name, const int32_t parent, const Matrix& bind_local)
+	{
+		ASSERT(parent < static_cast<int32_t>(m_vecJoints.size()));
+
+		sSkeletonJoint joint;
+		joint.parent = parent;
+		joint.bind_position = bind_local.GetTranslation();
+		joint.bind_rotation = bind_local.GetRotation();
+		joint.bind_scale = bind_local.GetScale();
+
+		const uint32_t index = static_cast<uint32_t>(m_vecJoints.size());
+		m_vecJoints.push_back(joint);
+		m_vecJointNames.push_back(name);
+		m_vecBindGlobal.emplace_back();
+		m_vecBindGlobalInverse.emplace_back();
+		ComputeBindGlobal(index);
+
+		return index;
+	}
+
+	uint32_t Skeleton::AddBone(const uint32_t joint, const Matrix& offset)
+	{
+		for (uint32_t i = 0; i < static_cast<uint32_t>(m_vecBones.size()); i++)
+		{
+			if (m_vecBones[i].joint == joint && m_vecBones[i].offset == offset)
+				return i;
+		}
+
+		m_vecBones.push_back({ joint, offset });
+
+		return static_cast<uint32_t>(m_vecBones.size()) - 1;
+	}
+
+	void Skeleton::Set(vector<sSkeletonJoint> joints, vector<string> names, vector<sSkeletonBone> bones)
+	{
+		m_vecJoints = move(joints);
+		m_vecJointNames = move(names);
+		m_vecBones = move(bones);
+		m_vecJointNames.resize(m_vecJoints.size());
+
+		// ջ  θ𺸴 ڽ  ξٸ Ʈ Ѵ.
+		for (uint32_t i = 0; i < static_cast<uint32_t>(m_vecJoints.size()); i++)
+		{
+			if (m_vecJoints[i].parent >= static_cast<int32_t>(i))
+			{
+				m_vecJoints[i].parent = -1;
+			}
+		}
+
+		m_vecBones.erase(remove_if(m_vecBones.begin(), m_vecBones.end(), [this](const sSkeletonBone& bone) { return bone.joint >= m_vecJoints.size(); }), m_vecBones.end());
+
+		m_vecBindGlobal.resize(m_vecJoints.size());
+		m_vecBindGlobalInverse.resize(m_vecJoints.size());
+		for (uint32_t i = 0; i < static_cast<uint32_t>(m_vecJoints.size()); i++)
+		{
+			ComputeBindGlobal(i);
+		}
+	}
+
+	int32_t Skeleton::FindJoint(const string& name) const
+	{
+		for (uint32_t i = 0; i < static_cast<uint32_t>(m_vecJointNames.size()); i++)
+		{
+			if (m_vecJointNames[i] == name)
+				return static_cast<int32_t>(i);
+		}
+
+		return -1;
+	}
+
+	void Skeleton::ComputeBindGlobal(const uint32_t joint)
+	{
+		const sSkeletonJoint& data = m_vecJoints[joint];
+		const Matrix local = Matrix(data.bind_position, data.bind_rotation, data.bind_scale);
+
+		m_vecBindGlobal[joint] = data.parent < 0 ? local : local * m_vecBindGlobal[data.parent];
+		m_vecBindGlobalInverse[joint] = Matrix::Invert(m_vecBindGlobal[joint]);
+	}
+
 	Animation::Animation(Context* context) : IResource(context, EResourceType::Animation)
 	{
 
@@ -12,11 +388,235 @@ namespace PlayGround
 
 	bool Animation::LoadFromFile(const string& file_path)
 	{
+		AssetContainer container;
+		if (!container.Open(file_path))
+			return false;
+
+		uint64_t header_count = 0;
+		uint64_t name_length = 0;
+		uint64_t channel_names_length = 0;
+		uint64_t range_count = 0;
+		uint64_t offset_count = 0;
+		uint64_t time_count = 0;
+		uint64_t value_count = 0;
+		const sAnimationHeader* header = container.GetChunkData<sAnimationHeader>(ANIMATION_CHUNK_HEADER, &header_count);
+		const char* name = container.GetChunkData<char>(ANIMATION_CHUNK_NAME, &name_length);
+		const char* channel_names = container.GetChunkData<char>(ANIMATION_CHUNK_CHANNELS, &channel_names_length);
+		const sAnimationRange* ranges = container.GetChunkData<sAnimationRange>(ANIMATION_CHUNK_RANGES, &range_count);
+		const uint32_t* offsets = container.GetChunkData<uint32_t>(ANIMATION_CHUNK_OFFSETS, &offset_count);
+		const uint16_t* times = container.GetChunkData<uint16_t>(ANIMATION_CHUNK_TIMES, &time_count);
+		const uint16_t* values = container.GetChunkData<uint16_t>(ANIMATION_CHUNK_VALUES, &value_count);
+
+		if (!header || header_count != 1 || !offsets)
+		{
+			LOG_ERROR("\"%s\" is missing animation chunks", file_path.c_str());
+			return false;
+		}
+
+		// Ű ġ 迭  Ű ʴ ȮѴ.
+		const uint64_t track_count = static_cast<uint64_t>(header->channel_count) * TRACKS_PER_CHANNEL;
+		bool is_valid = header->segment_length > 0.0 &&
+			offset_count == header->segment_count * track_count + 1 &&
+			range_count == header->channel_count * 2ull &&
+			value_count == time_count * 3 &&
+			offsets[offset_count - 1] == time_count;
+
+		for (uint64_t i = 0; is_valid && i + 1 < offset_count; i++)
+		{
+			is_valid = offsets[i] <= offsets[i + 1];
+		}
+
+		vector<string> names = split_names(channel_names, channel_names_length);
+		if (!is_valid || names.size() != header->channel_count)
+		{
+			LOG_ERROR("\"%s\" is corrupted", file_path.c_str());
+			return false;
+		}
+
+		SetResourceFilePath(file_path);
+
+		m_Object_name = name ? string(name, static_cast<size_t>(name_length)) : GetResourceName();
+		m_Duration = header->duration;
+		m_TicksPerSec = header->ticks_per_sec;
+		m_SegmentLength = header->segment_length;
+		m_SegmentCount = header->segment_count;
+		m_vecChannels.clear();
+		m_vecChannelNames = move(names);
+		m_vecRanges.assign(ranges, ranges + range_count);
+		m_vecKeyOffsets.assign(offsets, offsets + offset_count);
+		m_vecKeyTimes.assign(times, times + time_count);
+		m_vecKeyValues.assign(values, values + value_count);
+
+		UpdateMemoryUsage();
+
 		return true;
 	}
 
 	bool Animation::SaveToFile(const string& file_path)
 	{
-		return true;
+		if (!m_vecChannels.empty())
+		{
+			Compress();
+		}
+
+		AssetContainerWriter file(file_path);
+		if (!file.IsOpen())
+			return false;
+
+		sAnimationHeader header;
+		header.duration = m_Duration;
+		header.ticks_per_sec = m_TicksPerSec;
+		header.segment_length = m_SegmentLength;
+		header.channel_count = GetChannelCount();
+		header.segment_count = m_SegmentCount;
+
+		string channel_names;
+		for (const string& name : m_vecChannelNames)
+		{
+			channel_names += name;
+			channel_names += '\0';
+		}
+
+		file.AddChunk(ANIMATION_CHUNK_HEADER, &header, sizeof(header));
+		file.AddChunk(ANIMATION_CHUNK_NAME, m_Object_name.data(), m_Object_name.size());
+		file.AddChunk(ANIMATION_CHUNK_CHANNELS, channel_names.data(), channel_names.size());
+		file.AddChunk(ANIMATION_CHUNK_RANGES, m_vecRanges);
+		file.AddChunk(ANIMATION_CHUNK_OFFSETS, m_vecKeyOffsets);
+		file.AddChunk(ANIMATION_CHUNK_TIMES, m_vecKeyTimes);
+		file.AddChunk(ANIMATION_CHUNK_VALUES, m_vecKeyValues);
+
+		return file.Close();
+	}
+
+	void Animation::Compress(const sAnimationCompression& settings)
+	{
+		const uint32_t channel_count = static_cast<uint32_t>(m_vecChannels.size());
+
+		// Ʈ  ȿ Ű δ.
+		vector<vector<KeyVector>> positions(channel_count);
+		vector<vector<KeyQuaternion>> rotations(channel_count);
+		vector<vector<KeyVector>> scales(channel_count);
+		double end = m_Duration;
+
+		for (uint32_t i = 0; i < channel_count; i++)
+		{
+			AnimationNode& channel = m_vecChannels[i];
+			for (KeyQuaternion& key : channel.rotationFrames)
+			{
+				key.value = key.value.Normalized();
+			}
+
+			positions[i] = reduce_keys(channel.positionFrames, settings.position_tolerance);
+			rotations[i] = reduce_keys(channel.rotationFrames, settings.rotation_tolerance);
+			scales[i] = reduce_keys(channel.scaleFrames, settings.scale_tolerance);
+
+			end = channel.positionFrames.empty() ? end : Util::Max(end, channel.positionFrames.back().time);
+			end = channel.rotationFrames.empty() ? end : Util::Max(end, channel.rotationFrames.back().time);
+			end = channel.scaleFrames.empty() ? end : Util::Max(end, channel.scaleFrames.back().time);
+		}
+
+		// Ŭ    .
+		m_SegmentLength = m_TicksPerSec > 0.0 ? m_TicksPerSec * SEGMENT_SECONDS : Util::Max(end, 1.0);
+		m_SegmentCount = Util::Max(static_cast<uint32_t>(ceil(end / m_SegmentLength)), 1u);
+
+		m_vecChannelNames.resize(channel_count);
+		m_vecRanges.resize(channel_count * 2);
+		for (uint32_t i = 0; i < channel_count; i++)
+		{
+			m_vecChannelNames[i] = move(m_vecChannels[i].name);
+			m_vecRanges[i * 2] = get_range(positions[i]);
+			m_vecRanges[i * 2 + 1] = get_range(scales[i]);
+		}
+
+		m_vecKeyOffsets.clear();
+		m_vecKeyTimes.clear();
+		m_vecKeyValues.clear();
+		m_vecKeyOffsets.reserve(static_cast<size_t>(m_SegmentCount) * channel_count * TRACKS_PER_CHANNEL + 1);
+
+		for (uint32_t segment = 0; segment < m_SegmentCount; segment++)
+		{
+			const double start = segment * m_SegmentLength;
+
+			for (uint32_t i = 0; i < channel_count; i++)
+			{
+				const sAnimationRange& position_range = m_vecRanges[i * 2];
+				const sAnimationRange& scale_range = m_vecRanges[i * 2 + 1];
+
+				m_vecKeyOffsets.push_back(static_cast<uint32_t>(m_vecKeyTimes.size()));
+				append_segment(positions[i], start, m_SegmentLength, settings.position_tolerance, [&](const Vector3& value, uint16_t* result) { quantize(value, position_range, result); }, &m_vecKeyTimes, &m_vecKeyValues);
+
+				m_vecKeyOffsets.push_back(static_cast<uint32_t>(m_vecKeyTimes.size()));
+				append_segment(rotations[i], start, m_SegmentLength, settings.rotation_tolerance, [](const Quaternion& value, uint16_t* result) { quantize(value, result); }, &m_vecKeyTimes, &m_vecKeyValues);
+
+				m_vecKeyOffsets.push_back(static_cast<uint32_t>(m_vecKeyTimes.size()));
+				append_segment(scales[i], start, m_SegmentLength, settings.scale_tolerance, [&](const Vector3& value, uint16_t* result) { quantize(value, scale_range, result); }, &m_vecKeyTimes, &m_vecKeyValues);
+			}
+		}
+
+		m_vecKeyOffsets.push_back(static_cast<uint32_t>(m_vecKeyTimes.size()));
+		m_vecKeyTimes.shrink_to_fit();
+		m_vecKeyValues.shrink_to_fit();
+
+		//  Ű  ̻ ʿ .
+		m_vecChannels.clear();
+		m_vecChannels.shrink_to_fit();
+
+		UpdateMemoryUsage();
+	}
+
+	void Animation::SampleChannel(const uint32_t channel, const double time, sAnimationCursor* cursor, Vector3* position, Quaternion* rotation, Vector3* scale) const
+	{
+		if (m_SegmentCount == 0)
+			return;
+
+		// ð     ȭ ð (Ű ð  )
+		const double ticks = Util::Max(time * m_TicksPerSec, 0.0);
+		const uint32_t segment = Util::Min(static_cast<uint32_t>(ticks / m_SegmentLength), m_SegmentCount - 1);
+		const float local_time = static_cast<float>(Util::Min((ticks - segment * m_SegmentLength) / m_SegmentLength, 1.0) * 65535.0);
+
+		if (cursor->segment != segment)
+		{
+			cursor->segment = segment;
+			cursor->position = 0;
+			cursor->rotation = 0;
+			cursor->scale = 0;
+		}
+
+		const uint32_t* offsets = &m_vecKeyOffsets[(static_cast<size_t>(segment) * GetChannelCount() + channel) * TRACKS_PER_CHANNEL];
+		const uint16_t* times = m_vecKeyTimes.data();
+		const uint16_t* values = m_vecKeyValues.data();
+		uint32_t a = 0;
+		uint32_t b = 0;
+		float factor = 0.0f;
+
+		if (find_keys(times, offsets[0], offsets[1], local_time, &cursor->position, &a, &b, &factor))
+		{
+			const sAnimationRange& range = m_vecRanges[channel * 2];
+			*position = Vector3::Lerp(dequantize(values + a * 3, range), dequantize(values + b * 3, range), factor);
+		}
+
+		if (find_keys(times, offsets[1], offsets[2], local_time, &cursor->rotation, &a, &b, &factor))
+		{
+			*rotation = Quaternion::Slerp(dequantize_rotation(values + a * 3), dequantize_rotation(values + b * 3), factor);
+		}
+
+		if (find_keys(times, offsets[2], offsets[3], local_time, &cursor->scale, &a, &b, &factor))
+		{
+			const sAnimationRange& range = m_vecRanges[channel * 2 + 1];
+			*scale = Vector3::Lerp(dequantize(values + a * 3, range), dequantize(values + b * 3, range), factor);
+		}
+	}
+
+	void Animation::UpdateMemoryUsage()
+	{
+		m_ObjectSizeCPU = sizeof(*this);
+		m_ObjectSizeCPU += m_vecRanges.size() * sizeof(sAnimationRange);
+		m_ObjectSizeCPU += m_vecKeyOffsets.size() * sizeof(uint32_t);
+		m_ObjectSizeCPU += m_vecKeyTimes.size() * sizeof(uint16_t);
+		m_ObjectSizeCPU += m_vecKeyValues.size() * sizeof(uint16_t);
+		for (const string& name : m_vecChannelNames)
+		{
+			m_ObjectSizeCPU += name.capacity();
+		}
 	}
-}
\ No newline at end of file
+}
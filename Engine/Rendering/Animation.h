@@ -5,6 +5,66 @@
 
 namespace PlayGround
 {
+	// ؽ ϳ ޴   (ġ ū  ִ 4,  ġ 0)
+	struct sSkinWeight
+	{
+		uint16_t bones[4] = {};
+		float weights[4] = {};
+	};
+
+	// ̷  ϳ (  .)
+	struct sSkeletonJoint
+	{
+		// θ ׻ ڽĺ տ ´. (Ʈ -1)
+		int32_t parent = -1;
+		Math::Vector3 bind_position;
+		Math::Quaternion bind_rotation;
+		Math::Vector3 bind_scale = Math::Vector3::One;
+	};
+
+	// ؽ ̴  (޽  ->   )
+	struct sSkeletonBone
+	{
+		uint32_t joint = 0;
+		Math::Matrix offset;
+	};
+
+	//     忡  
+	class Skeleton
+	{
+	public:
+		void Clear();
+
+		// θ  ߰Ǿ ־ Ѵ.
+		uint32_t AddJoint(const std::string& name, int32_t parent, const Math::Matrix& bind_local);
+		//     ִٸ   ȯѴ. (޽  Ѵ.)
+		uint32_t AddBone(uint32_t joint, const Math::Matrix& offset);
+		// Ͽ    ٽ .
+		void Set(std::vector<sSkeletonJoint> joints, std::vector<std::string> names, std::vector<sSkeletonBone> bones);
+
+		// ̸  (ٸ -1)
+		int32_t FindJoint(const std::string& name) const;
+
+		inline bool IsEmpty()                                        const { return m_vecJoints.empty(); }
+		inline uint32_t GetJointCount()                              const { return static_cast<uint32_t>(m_vecJoints.size()); }
+		inline uint32_t GetBoneCount()                               const { return static_cast<uint32_t>(m_vecBones.size()); }
+		inline const std::vector<sSkeletonJoint>& GetJoints()        const { return m_vecJoints; }
+		inline const std::vector<std::string>& GetJointNames()       const { return m_vecJointNames; }
+		inline const std::vector<sSkeletonBone>& GetBones()          const { return m_vecBones; }
+		// ε    İ  
+		inline const Math::Matrix& GetBindGlobal(uint32_t joint)        const { return m_vecBindGlobal[joint]; }
+		inline const Math::Matrix& GetBindGlobalInverse(uint32_t joint) const { return m_vecBindGlobalInverse[joint]; }
+
+	private:
+		void ComputeBindGlobal(uint32_t joint);
+
+		std::vector<sSkeletonJoint> m_vecJoints;
+		std::vector<std::string> m_vecJointNames;
+		std::vector<sSkeletonBone> m_vecBones;
+		std::vector<Math::Matrix> m_vecBindGlobal;
+		std::vector<Math::Matrix> m_vecBindGlobalInverse;
+	};
+
 	struct AnimationVertexWeight
 	{
 		uint32_t vertexID;
@@ -38,6 +98,37 @@ namespace PlayGround
 		std::vector<KeyVector> scaleFrames;
 	};
 
+	// äθ  ã    Ű ġ
+	// ð κ ݾ  帣Ƿ  Ű Ȯϸ ȴ.
+	struct sAnimationCursor
+	{
+		uint32_t segment = UINT32_MAX;
+		uint32_t position = 0;
+		uint32_t rotation = 0;
+		uint32_t scale = 0;
+	};
+
+	// Ŭ   Ű ̴  
+	struct sAnimationCompression
+	{
+		// ġ ( )
+		float position_tolerance = 0.0005f;
+		// ȸ ()
+		float rotation_tolerance = 0.001f;
+		float scale_tolerance = 0.0005f;
+	};
+
+	// ġ, ũ Ʈ ȭ 
+	struct sAnimationRange
+	{
+		Math::Vector3 min;
+		Math::Vector3 extent;
+	};
+
+	//  ִϸ̼ Ŭ
+	// äθ ġ, ȸ, ũ Ʈ ְ Ŭ      Ʈ Ű Ƶд.
+	// Ű 16Ʈ ð 16Ʈ  3 (ġ, ũ Ʈ   , ȸ smallest-three)̸
+	//    Ű Ƿ ø  ð   д´.
 	class Animation : public IResource
 	{
 	public:
@@ -62,11 +153,48 @@ namespace PlayGround
 			m_TicksPerSec = ticksPerSec;
 		}
 
+		// Ʈ ä (Compress ϱ   ִ´.)
+		inline void AddChannel(AnimationNode&& channel)
+		{
+			m_vecChannels.emplace_back(std::move(channel));
+		}
+
+		// ߰ ä Ű  ȿ ̰ ȭؼ  .  ä Ѵ.
+		void Compress(const sAnimationCompression& settings = sAnimationCompression());
+
+		inline const std::string& GetName()                        const { return m_Object_name; }
+		inline double GetDuration()                                const { return m_Duration; }
+		inline double GetTicksPerSec()                             const { return m_TicksPerSec; }
+		//  ð ()
+		inline double GetDurationSec()                             const { return m_TicksPerSec > 0.0 ? m_Duration / m_TicksPerSec : 0.0; }
+		inline uint32_t GetChannelCount()                          const { return static_cast<uint32_t>(m_vecChannelNames.size()); }
+		inline const std::vector<std::string>& GetChannelNames()   const { return m_vecChannelNames; }
+
+		// time() ä ϳ øѴ.
+		// Ű   ״ ιǷ ε  ä ѱ ȴ.
+		void SampleChannel(uint32_t channel, double time, sAnimationCursor* cursor, Math::Vector3* position, Math::Quaternion* rotation, Math::Vector3* scale) const;
+
 	private:
+		void UpdateMemoryUsage();
+
 		std::string m_Object_name;
 		double m_Duration = 0;
 		double m_TicksPerSec = 0;
 
 		std::vector<AnimationNode> m_vecChannels;
+
+		//  Ŭ
+		std::vector<std::string> m_vecChannelNames;
+		// äθ ġ, ũ  2
+		std::vector<sAnimationRange> m_vecRanges;
+		//   (ƽ)
+		double m_SegmentLength = 0;
+		uint32_t m_SegmentCount = 0;
+		//  s, Ʈ k Ű [m_vecKeyOffsets[s * Ʈ  + k], m_vecKeyOffsets[s * Ʈ  + k + 1])
+		std::vector<uint32_t> m_vecKeyOffsets;
+		//   ȭ ð (0 ~ 65535)
+		std::vector<uint16_t> m_vecKeyTimes;
+		// Ű 3
+		std::vector<uint16_t> m_vecKeyValues;
 	};
 }
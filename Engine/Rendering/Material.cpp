@@ -54,6 +54,12 @@ namespace PlayGround
 
         const int texture_count = xml->GetAttributeAs<int>("Textures", "Count");
 
+        // ؽó   ûؼ ۾  ÿ ҷ Ѵ.
+        // ٸ  ̹ û ؽó  û ٸ.
+        ResourceCache* resource_cache = m_Context->GetSubModule<ResourceCache>();
+        vector<pair<Material_Property, ResourceFuture<RHI_Texture2D>>> textures;
+        textures.reserve(texture_count);
+
         for (int i = 0; i < texture_count; i++)
         {
             string node_name = "Texture_" + to_string(i);
@@ -61,12 +67,17 @@ namespace PlayGround
             string tex_name = xml->GetAttributeAs<string>(node_name, "Texture_Name");
             string tex_path = xml->GetAttributeAs<string>(node_name, "Texture_Path");
 
-            auto texture = m_Context->GetSubModule<ResourceCache>()->GetByName<RHI_Texture2D>(tex_name);
+            shared_ptr<RHI_Texture2D> texture = resource_cache->GetByName<RHI_Texture2D>(tex_name);
 
-            if (!texture)
-                texture = m_Context->GetSubModule<ResourceCache>()->Load<RHI_Texture2D>(tex_path);
+            if (texture)
+                textures.emplace_back(tex_type, ResourceFuture<RHI_Texture2D>(texture));
+            else
+                textures.emplace_back(tex_type, resource_cache->LoadAsync<RHI_Texture2D>(tex_path));
+        }
 
-            SetTextureSlot(tex_type, texture, GetProperty(tex_type));
+        for (auto& [tex_type, texture] : textures)
+        {
+            SetTextureSlot(tex_type, texture.Get(), GetProperty(tex_type));
         }
 
         m_ObjectSizeCPU = sizeof(*this);
@@ -185,11 +196,13 @@ namespace PlayGround
 
     void Material::SetColorAlbedo(const Math::Vector4& color)
     {
-        // , ΰ ٲ  Ʈ
-        if ((m_ColorAlbedo.w != 1.0f && color.w == 1.0f) ||
-            (m_ColorAlbedo.w == 1.0f && color.w != 1.0f))
-            m_Context->GetSubModule<World>()->Resolve();
+        // , γ ̴ ΰ ٲ  ˸.
+        const bool transparency_changed = (m_ColorAlbedo.w != 1.0f && color.w == 1.0f) || (m_ColorAlbedo.w == 1.0f && color.w != 1.0f);
+        const bool visibility_changed = (m_ColorAlbedo.w == 0.0f) != (color.w == 0.0f);
 
         m_ColorAlbedo = color;
+
+        if (transparency_changed || visibility_changed)
+            FIRE_EVENT_DATA(EventType::MaterialTransparencyChanged, static_cast<void*>(this));
     }
 }
\ No newline at end of file
@@ -1,6 +1,7 @@
 #include "Common.h"
 #include "Mesh.h"
 #include "../RHI/RHI_Vertex.h"
+#include "../Math/Ray.h"
 
 using namespace std;
 using namespace PlayGround::Math;
@@ -9,6 +10,8 @@ namespace PlayGround
 {
     void Mesh::Clear()
     {
+        InvalidateBVH();
+
         m_vecVertices.clear();
         m_vecVertices.shrink_to_fit();
         m_vecIndices.clear();
@@ -22,6 +25,11 @@ namespace PlayGround
         size += uint32_t(m_vecVertices.size() * sizeof(RHI_Vertex_PosTexNorTan));
         size += uint32_t(m_vecIndices.size() * sizeof(uint32_t));
 
+        for (const auto& [range, bvh] : m_BVHs)
+        {
+            size += bvh->GetMemoryUsage();
+        }
+
         return size;
     }
 
@@ -53,6 +61,7 @@ namespace PlayGround
         }
 
         m_vecVertices.insert(m_vecVertices.end(), vertices.begin(), vertices.end());
+        InvalidateBVH();
     }
 
     uint32_t Mesh::VerticesCount() const
@@ -73,5 +82,35 @@ namespace PlayGround
         }
 
         m_vecIndices.insert(m_vecIndices.end(), indices.begin(), indices.end());
+        InvalidateBVH();
+    }
+
+    float Mesh::RayCast(const Ray& ray, uint32_t index_offset, uint32_t index_count, uint32_t vertex_offset)
+    {
+        if (index_count < 3 || index_offset + index_count > m_vecIndices.size() || vertex_offset >= m_vecVertices.size())
+            return Util::INFINITY_;
+
+        MeshBVH* bvh = nullptr;
+        {
+            lock_guard<mutex> lock(m_MutexBVH);
+
+            unique_ptr<MeshBVH>& cached = m_BVHs[make_tuple(index_offset, index_count, vertex_offset)];
+
+            if (!cached)
+            {
+                cached = make_unique<MeshBVH>();
+                cached->Build(m_vecVertices.data() + vertex_offset, m_vecIndices.data() + index_offset, index_count);
+            }
+
+            bvh = cached.get();
+        }
+
+        return bvh->RayCast(ray, m_vecVertices.data() + vertex_offset, m_vecIndices.data() + index_offset);
+    }
+
+    void Mesh::InvalidateBVH()
+    {
+        lock_guard<mutex> lock(m_MutexBVH);
+        m_BVHs.clear();
     }
 }
\ No newline at end of file
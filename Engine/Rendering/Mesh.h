@@ -1,10 +1,20 @@
 #pragma once
 
 #include <vector>
+#include <map>
+#include <tuple>
+#include <memory>
+#include <mutex>
 #include "../RHI/RHI_Definition.h"
+#include "MeshBVH.h"
 
 namespace PlayGround
 {
+    namespace Math
+    {
+        class Ray;
+    }
+
     // 3D  ޽
 	class Mesh
 	{
@@ -28,20 +38,29 @@ namespace PlayGround
         void VerticesAppend(const std::vector<RHI_Vertex_PosTexNorTan>& vertices, uint32_t* vertexOffset);
         uint32_t VerticesCount() const;
         inline std::vector<RHI_Vertex_PosTexNorTan>& GetVertices() { return m_vecVertices; }
-        inline void SetVertices(const std::vector<RHI_Vertex_PosTexNorTan>& vertices) { m_vecVertices = vertices; }
+        inline void SetVertices(const std::vector<RHI_Vertex_PosTexNorTan>& vertices) { m_vecVertices = vertices; InvalidateBVH(); }
 
         // ε 
         inline void IndexAdd(uint32_t index) { m_vecIndices.emplace_back(index); }
         inline std::vector<uint32_t>& GetIndices() { return m_vecIndices; }
-        inline void SetIndices(const std::vector<uint32_t>& indices) { m_vecIndices = indices; }
+        inline void SetIndices(const std::vector<uint32_t>& indices) { m_vecIndices = indices; InvalidateBVH(); }
         inline uint32_t IndicesCount() const { return static_cast<uint32_t>(m_vecIndices.size()); }
         void IndicesAppend(const std::vector<uint32_t>& indices, uint32_t* indexOffset);
 
         // ﰢ 
         inline uint32_t GetTriangleCount() const { return IndicesCount() / 3; }
 
+        //  ﰢ    ˻Ѵ. (ٸ INFINITY)
+        //  BVH ó ˻   ޽ ٲ  Ѵ.
+        float RayCast(const Math::Ray& ray, uint32_t index_offset, uint32_t index_count, uint32_t vertex_offset);
+        // ؽ ε  ƴٸ ȣؼ BVH ٽ  Ѵ.
+        void InvalidateBVH();
+
     private:
         std::vector<RHI_Vertex_PosTexNorTan> m_vecVertices;
         std::vector<uint32_t> m_vecIndices;
+        // (ε , ε , ؽ ) -> BVH
+        std::map<std::tuple<uint32_t, uint32_t, uint32_t>, std::unique_ptr<MeshBVH>> m_BVHs;
+        std::mutex m_MutexBVH;
 	};
 }
\ No newline at end of file
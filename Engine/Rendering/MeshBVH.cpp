@@ -0,0 +1,325 @@
+#include "Common.h"
+#include "MeshBVH.h"
+#include "../RHI/RHI_Vertex.h"
+
+using namespace std;
+using namespace PlayGround::Math;
+
+namespace PlayGround
+{
+	// ̺  ﰢ  ʴ´.
+	static constexpr uint32_t LEAF_SIZE_MIN = 4;
+	//    ũ ̺ ٸ .
+	static constexpr uint32_t LEAF_SIZE_MAX = 16;
+	static constexpr uint32_t BIN_COUNT = 16;
+
+	static inline Vector3 GetPosition(const RHI_Vertex_PosTexNorTan* vertices, uint32_t index)
+	{
+		return Vector3(vertices[index].pos[0], vertices[index].pos[1], vertices[index].pos[2]);
+	}
+
+	static inline Vector3 Min(const Vector3& a, const Vector3& b)
+	{
+		return Vector3(Util::Min(a.x, b.x), Util::Min(a.y, b.y), Util::Min(a.z, b.z));
+	}
+
+	static inline Vector3 Max(const Vector3& a, const Vector3& b)
+	{
+		return Vector3(Util::Max(a.x, b.x), Util::Max(a.y, b.y), Util::Max(a.z, b.z));
+	}
+
+	static inline float HalfArea(const Vector3& min, const Vector3& max)
+	{
+		const Vector3 size = max - min;
+		return size.x * size.y + size.y * size.z + size.z * size.x;
+	}
+
+	//  ׽Ʈ ڽ Ÿ Ѵ. (  INFINITY)
+	static inline float RayBoxDistance(const Vector3& origin, const Vector3& inverse_direction, const Vector3& min, const Vector3& max)
+	{
+		const float tx1 = (min.x - origin.x) * inverse_direction.x;
+		const float tx2 = (max.x - origin.x) * inverse_direction.x;
+		float t_min = fminf(tx1, tx2);
+		float t_max = fmaxf(tx1, tx2);
+
+		const float ty1 = (min.y - origin.y) * inverse_direction.y;
+		const float ty2 = (max.y - origin.y) * inverse_direction.y;
+		t_min = fmaxf(t_min, fminf(ty1, ty2));
+		t_max = fminf(t_max, fmaxf(ty1, ty2));
+
+		const float tz1 = (min.z - origin.z) * inverse_direction.z;
+		const float tz2 = (max.z - origin.z) * inverse_direction.z;
+		t_min = fmaxf(t_min, fminf(tz1, tz2));
+		t_max = fminf(t_max, fmaxf(tz1, tz2));
+
+		t_min = fmaxf(t_min, 0.0f);
+
+		return t_max < t_min ? Util::INFINITY_ : t_min;
+	}
+
+	void MeshBVH::Build(const RHI_Vertex_PosTexNorTan* vertices, const uint32_t* indices, uint32_t index_count)
+	{
+		m_vecNodes.clear();
+		m_vecTriangles.clear();
+
+		const uint32_t triangle_count = index_count / 3;
+		if (triangle_count == 0)
+			return;
+
+		// ﰢ ߽ɰ ڽ ( ȸ  ִ´.)
+		vector<Vector3> centroids(triangle_count);
+		vector<Vector3> triangle_min(triangle_count);
+		vector<Vector3> triangle_max(triangle_count);
+		m_vecTriangles.resize(triangle_count);
+
+		for (uint32_t i = 0; i < triangle_count; i++)
+		{
+			const Vector3 p0 = GetPosition(vertices, indices[i * 3]);
+			const Vector3 p1 = GetPosition(vertices, indices[i * 3 + 1]);
+			const Vector3 p2 = GetPosition(vertices, indices[i * 3 + 2]);
+
+			centroids[i] = (p0 + p1 + p2) / 3.0f;
+			triangle_min[i] = Min(p0, Min(p1, p2));
+			triangle_max[i] = Max(p0, Max(p1, p2));
+			m_vecTriangles[i] = i;
+		}
+
+		const auto triangle_bounds = [&triangle_min, &triangle_max](uint32_t triangle, Vector3& min, Vector3& max)
+		{
+			min = Min(min, triangle_min[triangle]);
+			max = Max(max, triangle_max[triangle]);
+		};
+
+		m_vecNodes.reserve(triangle_count / LEAF_SIZE_MIN * 2 + 1);
+		m_vecNodes.emplace_back();
+		m_vecNodes[0].left_or_first = 0;
+		m_vecNodes[0].count = triangle_count;
+
+		//    . (ﰢ 鸸  ִ.)
+		vector<uint32_t> stack;
+		stack.emplace_back(0);
+
+		while (!stack.empty())
+		{
+			const uint32_t node_index = stack.back();
+			stack.pop_back();
+
+			const uint32_t first = m_vecNodes[node_index].left_or_first;
+			const uint32_t count = m_vecNodes[node_index].count;
+
+			//  ߽ 
+			Vector3 node_min = Vector3::Inf;
+			Vector3 node_max = Vector3::NegInf;
+			Vector3 centroid_min = Vector3::Inf;
+			Vector3 centroid_max = Vector3::NegInf;
+
+			for (uint32_t i = first; i < first + count; i++)
+			{
+				triangle_bounds(m_vecTriangles[i], node_min, node_max);
+				centroid_min = Min(centroid_min, centroids[m_vecTriangles[i]]);
+				centroid_max = Max(centroid_max, centroids[m_vecTriangles[i]]);
+			}
+
+			m_vecNodes[node_index].min = node_min;
+			m_vecNodes[node_index].max = node_max;
+
+			if (count <= LEAF_SIZE_MIN)
+				continue;
+
+			// ึ   SAH     ã´.
+			float best_cost = Util::INFINITY_;
+			uint32_t best_axis = 0;
+			uint32_t best_split = 0;
+
+			for (uint32_t axis = 0; axis < 3; axis++)
+			{
+				const float axis_min = axis == 0 ? centroid_min.x : axis == 1 ? centroid_min.y : centroid_min.z;
+				const float axis_max = axis == 0 ? centroid_max.x : axis == 1 ? centroid_max.y : centroid_max.z;
+
+				if (axis_max <= axis_min)
+					continue;
+
+				const float scale = BIN_COUNT / (axis_max - axis_min);
+
+				Vector3 bin_min[BIN_COUNT];
+				Vector3 bin_max[BIN_COUNT];
+				uint32_t bin_count[BIN_COUNT] = {};
+
+				for (uint32_t b = 0; b < BIN_COUNT; b++)
+				{
+					bin_min[b] = Vector3::Inf;
+					bin_max[b] = Vector3::NegInf;
+				}
+
+				for (uint32_t i = first; i < first + count; i++)
+				{
+					const Vector3& centroid = centroids[m_vecTriangles[i]];
+					const float value = axis == 0 ? centroid.x : axis == 1 ? centroid.y : centroid.z;
+					const uint32_t bin = min(BIN_COUNT - 1, static_cast<uint32_t>((value - axis_min) * scale));
+
+					bin_count[bin]++;
+					triangle_bounds(m_vecTriangles[i], bin_min[bin], bin_max[bin]);
+				}
+
+				// ʿ   
+				float left_area[BIN_COUNT - 1];
+				uint32_t left_count[BIN_COUNT - 1];
+				Vector3 acc_min = Vector3::Inf;
+				Vector3 acc_max = Vector3::NegInf;
+				uint32_t acc_count = 0;
+
+				for (uint32_t b = 0; b < BIN_COUNT - 1; b++)
+				{
+					acc_count += bin_count[b];
+					if (bin_count[b] > 0)
+					{
+						acc_min = Min(acc_min, bin_min[b]);
+						acc_max = Max(acc_max, bin_max[b]);
+					}
+
+					left_count[b] = acc_count;
+					left_area[b] = acc_count > 0 ? HalfArea(acc_min, acc_max) : 0.0f;
+				}
+
+				// ʿ ϸ鼭  Ѵ.
+				acc_min = Vector3::Inf;
+				acc_max = Vector3::NegInf;
+				acc_count = 0;
+
+				for (uint32_t b = BIN_COUNT - 1; b > 0; b--)
+				{
+					acc_count += bin_count[b];
+					if (bin_count[b] > 0)
+					{
+						acc_min = Min(acc_min, bin_min[b]);
+						acc_max = Max(acc_max, bin_max[b]);
+					}
+
+					if (left_count[b - 1] == 0 || acc_count == 0)
+						continue;
+
+					const float cost = left_count[b - 1] * left_area[b - 1] + acc_count * HalfArea(acc_min, acc_max);
+
+					if (cost < best_cost)
+					{
+						best_cost = cost;
+						best_axis = axis;
+						best_split = b;
+					}
+				}
+			}
+
+			//    δٸ (ʹ ũ  )   д.
+			const float leaf_cost = count * HalfArea(node_min, node_max);
+			if (best_cost == Util::INFINITY_ || (best_cost >= leaf_cost && count <= LEAF_SIZE_MAX))
+				continue;
+
+			//  ġ  ﰢ ȣ .
+			const float axis_min = best_axis == 0 ? centroid_min.x : best_axis == 1 ? centroid_min.y : centroid_min.z;
+			const float axis_max = best_axis == 0 ? centroid_max.x : best_axis == 1 ? centroid_max.y : centroid_max.z;
+			const float scale = BIN_COUNT / (axis_max - axis_min);
+
+			const auto middle = partition(m_vecTriangles.begin() + first, m_vecTriangles.begin() + first + count, [&](uint32_t triangle)
+			{
+				const Vector3& centroid = centroids[triangle];
+				const float value = best_axis == 0 ? centroid.x : best_axis == 1 ? centroid.y : centroid.z;
+				return min(BIN_COUNT - 1, static_cast<uint32_t>((value - axis_min) * scale)) < best_split;
+			});
+
+			const uint32_t left_count = static_cast<uint32_t>(middle - (m_vecTriangles.begin() + first));
+			if (left_count == 0 || left_count == count)
+				continue;
+
+			// ڽ ׻ پ .
+			const uint32_t left = static_cast<uint32_t>(m_vecNodes.size());
+			m_vecNodes.emplace_back();
+			m_vecNodes.emplace_back();
+
+			m_vecNodes[left].left_or_first = first;
+			m_vecNodes[left].count = left_count;
+			m_vecNodes[left + 1].left_or_first = first + left_count;
+			m_vecNodes[left + 1].count = count - left_count;
+
+			m_vecNodes[node_index].left_or_first = left;
+			m_vecNodes[node_index].count = 0;
+
+			stack.emplace_back(left);
+			stack.emplace_back(left + 1);
+		}
+
+		m_vecNodes.shrink_to_fit();
+	}
+
+	float MeshBVH::RayCast(const Ray& ray, const RHI_Vertex_PosTexNorTan* vertices, const uint32_t* indices) const
+	{
+		if (m_vecNodes.empty())
+			return Util::INFINITY_;
+
+		const Vector3& origin = ray.GetStart();
+		const Vector3 inverse_direction = Vector3(1.0f / ray.GetDirection().x, 1.0f / ray.GetDirection().y, 1.0f / ray.GetDirection().z);
+
+		float closest = Util::INFINITY_;
+
+		if (RayBoxDistance(origin, inverse_direction, m_vecNodes[0].min, m_vecNodes[0].max) == Util::INFINITY_)
+			return closest;
+
+		// (, ڽ Ÿ)
+		vector<pair<uint32_t, float>> stack;
+		stack.reserve(64);
+		stack.emplace_back(0, 0.0f);
+
+		while (!stack.empty())
+		{
+			const auto [node_index, node_distance] = stack.back();
+			stack.pop_back();
+
+			//  ڿ   ﰢ ã  ִ.
+			if (node_distance >= closest)
+				continue;
+
+			const sNode& node = m_vecNodes[node_index];
+
+			//   ﰢ ˻Ѵ.
+			if (node.count > 0)
+			{
+				for (uint32_t i = node.left_or_first; i < node.left_or_first + node.count; i++)
+				{
+					const uint32_t triangle = m_vecTriangles[i];
+
+					const float distance = ray.HitDistance(
+						GetPosition(vertices, indices[triangle * 3]),
+						GetPosition(vertices, indices[triangle * 3 + 1]),
+						GetPosition(vertices, indices[triangle * 3 + 2]));
+
+					closest = Util::Min(closest, distance);
+				}
+
+				continue;
+			}
+
+			const uint32_t left = node.left_or_first;
+			const uint32_t right = left + 1;
+			const float distance_left = RayBoxDistance(origin, inverse_direction, m_vecNodes[left].min, m_vecNodes[left].max);
+			const float distance_right = RayBoxDistance(origin, inverse_direction, m_vecNodes[right].min, m_vecNodes[right].max);
+
+			//  ڽ   ߿ ִ´. ̹ ã ͺ  ڽ  ʴ´.
+			const bool left_first = distance_left <= distance_right;
+			const uint32_t near_child = left_first ? left : right;
+			const uint32_t far_child = left_first ? right : left;
+			const float near_distance = left_first ? distance_left : distance_right;
+			const float far_distance = left_first ? distance_right : distance_left;
+
+			if (far_distance < closest)
+				stack.emplace_back(far_child, far_distance);
+			if (near_distance < closest)
+				stack.emplace_back(near_child, near_distance);
+		}
+
+		return closest;
+	}
+
+	uint32_t MeshBVH::GetMemoryUsage() const
+	{
+		return static_cast<uint32_t>(m_vecNodes.size() * sizeof(sNode) + m_vecTriangles.size() * sizeof(uint32_t));
+	}
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <vector>
+#include "../RHI/RHI_Definition.h"
+#include "../Math/Vector3.h"
+
+namespace PlayGround
+{
+	namespace Math
+	{
+		class Ray;
+	}
+
+	// ޽  (޽) ﰢ    BVH
+	// ؽ ε  ʰ ĵ ﰢ ȣ  Ƿ
+	// ˻  ޽ ۸  Ѱ Ѵ.
+	class MeshBVH
+	{
+	public:
+		MeshBVH() = default;
+		~MeshBVH() = default;
+
+		//  SAH Ʈ . indices vertices  ε.
+		void Build(const RHI_Vertex_PosTexNorTan* vertices, const uint32_t* indices, uint32_t index_count);
+
+		//      ﰢ Ÿ (ٸ INFINITY)
+		float RayCast(const Math::Ray& ray, const RHI_Vertex_PosTexNorTan* vertices, const uint32_t* indices) const;
+
+		uint32_t GetMemoryUsage() const;
+
+	private:
+		struct sNode
+		{
+			Math::Vector3 min;
+			//   ù ﰢ, ƴ϶  ڽ ( ٷ )
+			uint32_t left_or_first = 0;
+			Math::Vector3 max;
+			// 0̶  
+			uint32_t count = 0;
+		};
+
+		std::vector<sNode> m_vecNodes;
+		std::vector<uint32_t> m_vecTriangles;
+	};
+}
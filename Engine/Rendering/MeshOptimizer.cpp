@@ -0,0 +1,730 @@
+#include "Common.h"
+#include "MeshOptimizer.h"
+#include "../RHI/RHI_Vertex.h"
+#include <algorithm>
+#include <numeric>
+#include <unordered_map>
+#include <cmath>
+#include <cstring>
+#include <cfloat>
+
+using namespace std;
+using namespace PlayGround::Math;
+
+namespace PlayGround
+{
+	namespace
+	{
+		// ùķ̼ϴ ؽ ĳ ũ (ֱ GPU post-transform ĳÿ  ũ)
+		constexpr uint32_t VERTEX_CACHE_SIZE = 32;
+		// ο     ĳ ũ ( 谡 ĳ ߷ ũ ߸ ʵ ۰ ´.)
+		constexpr uint32_t OVERDRAW_CACHE_SIZE = 16;
+
+		Vector3 get_position(const RHI_Vertex_PosTexNorTan& vertex)
+		{
+			return Vector3(vertex.pos[0], vertex.pos[1], vertex.pos[2]);
+		}
+
+		// ؽ -> ﰢ   (CSR )
+		struct sTriangleAdjacency
+		{
+			vector<uint32_t> offsets;
+			vector<uint32_t> counts;
+			vector<uint32_t> triangles;
+
+			void Build(const vector<uint32_t>& indices, uint32_t vertex_count)
+			{
+				const uint32_t triangle_count = static_cast<uint32_t>(indices.size() / 3);
+
+				counts.assign(vertex_count, 0);
+				offsets.assign(vertex_count, 0);
+				triangles.resize(triangle_count * 3);
+
+				for (uint32_t i = 0; i < triangle_count * 3; i++)
+				{
+					counts[indices[i]]++;
+				}
+
+				uint32_t offset = 0;
+				for (uint32_t v = 0; v < vertex_count; v++)
+				{
+					offsets[v] = offset;
+					offset += counts[v];
+				}
+
+				vector<uint32_t> fill(offsets);
+				for (uint32_t t = 0; t < triangle_count; t++)
+				{
+					for (uint32_t k = 0; k < 3; k++)
+					{
+						triangles[fill[indices[t * 3 + k]]++] = t;
+					}
+				}
+			}
+		};
+
+		// Forsyth : ĳÿ ֱ  ؽϼ,  ﰢ  ؽϼ .
+		float get_vertex_score(int32_t cache_position, uint32_t remaining_triangles)
+		{
+			if (remaining_triangles == 0)
+				return -1.0f;
+
+			float score = 0.0f;
+
+			if (cache_position >= 0)
+			{
+				//   ﰢ  ؽ   ༭ ٷ  ﰢ  ʰ Ѵ.
+				if (cache_position < 3)
+				{
+					score = 0.75f;
+				}
+				else
+				{
+					const float scale = 1.0f / static_cast<float>(VERTEX_CACHE_SIZE - 3);
+					score = powf(1.0f - static_cast<float>(cache_position - 3) * scale, 1.5f);
+				}
+			}
+
+			//  ﰢ  ؽ   ߿  ﰢ  ʴ´.
+			score += 2.0f / sqrtf(static_cast<float>(remaining_triangles));
+
+			return score;
+		}
+
+		// Ī 4x4 ķ Ÿ   ( Ÿ  )
+		struct sQuadric
+		{
+			double a00 = 0.0, a11 = 0.0, a22 = 0.0;
+			double a01 = 0.0, a02 = 0.0, a12 = 0.0;
+			double b0 = 0.0, b1 = 0.0, b2 = 0.0;
+			double c = 0.0;
+
+			void AddPlane(double nx, double ny, double nz, double d)
+			{
+				a00 += nx * nx; a11 += ny * ny; a22 += nz * nz;
+				a01 += nx * ny; a02 += nx * nz; a12 += ny * nz;
+				b0 += nx * d; b1 += ny * d; b2 += nz * d;
+				c += d * d;
+			}
+
+			void Add(const sQuadric& q)
+			{
+				a00 += q.a00; a11 += q.a11; a22 += q.a22;
+				a01 += q.a01; a02 += q.a02; a12 += q.a12;
+				b0 += q.b0; b1 += q.b1; b2 += q.b2;
+				c += q.c;
+			}
+
+			double Evaluate(const Vector3& p) const
+			{
+				const double x = p.x, y = p.y, z = p.z;
+				const double error = a00 * x * x + a11 * y * y + a22 * z * z
+					+ 2.0 * (a01 * x * y + a02 * x * z + a12 * y * z)
+					+ 2.0 * (b0 * x + b1 * y + b2 * z)
+					+ c;
+
+				// εҼ     ִ.
+				return error > 0.0 ? error : 0.0;
+			}
+		};
+
+		struct sPositionKey
+		{
+			float x, y, z;
+
+			bool operator==(const sPositionKey& other) const
+			{
+				return x == other.x && y == other.y && z == other.z;
+			}
+		};
+
+		struct sPositionKeyHash
+		{
+			size_t operator()(const sPositionKey& key) const
+			{
+				uint32_t bits[3];
+				memcpy(bits, &key, sizeof(bits));
+
+				return static_cast<size_t>((bits[0] * 73856093u) ^ (bits[1] * 19349663u) ^ (bits[2] * 83492791u));
+			}
+		};
+
+		inline uint64_t get_edge_key(uint32_t a, uint32_t b)
+		{
+			return a < b ? (static_cast<uint64_t>(a) << 32) | b : (static_cast<uint64_t>(b) << 32) | a;
+		}
+	}
+
+	void MeshOptimizer::OptimizeVertexCache(vector<uint32_t>& indices, uint32_t vertex_count)
+	{
+		const uint32_t triangle_count = static_cast<uint32_t>(indices.size() / 3);
+		if (triangle_count == 0 || vertex_count == 0)
+			return;
+
+		sTriangleAdjacency adjacency;
+		adjacency.Build(indices, vertex_count);
+
+		// ؽ  ׸  ﰢ  ĳ ġ
+		vector<uint32_t> remaining(adjacency.counts);
+		vector<int32_t> cache_position(vertex_count, -1);
+		vector<float> vertex_score(vertex_count);
+
+		for (uint32_t v = 0; v < vertex_count; v++)
+		{
+			vertex_score[v] = get_vertex_score(-1, remaining[v]);
+		}
+
+		vector<float> triangle_score(triangle_count);
+		vector<uint8_t> emitted(triangle_count, 0);
+
+		for (uint32_t t = 0; t < triangle_count; t++)
+		{
+			triangle_score[t] = vertex_score[indices[t * 3 + 0]] + vertex_score[indices[t * 3 + 1]] + vertex_score[indices[t * 3 + 2]];
+		}
+
+		// ĳ (  ֱ),  ﰢ  ؽ   д.
+		vector<uint32_t> cache;
+		vector<uint32_t> next_cache;
+		cache.reserve(VERTEX_CACHE_SIZE + 3);
+		next_cache.reserve(VERTEX_CACHE_SIZE + 3);
+
+		vector<uint32_t> result;
+		result.reserve(indices.size());
+
+		// ĳ ֺ ĺ   ó Ⱦ ġ
+		uint32_t scan_cursor = 0;
+		uint32_t best_triangle = UINT32_MAX;
+
+		for (uint32_t emitted_count = 0; emitted_count < triangle_count; emitted_count++)
+		{
+			if (best_triangle == UINT32_MAX)
+			{
+				// ĳÿ ִ ؽ  ﰢ Ƿ  ׸  ù ﰢ Ѵ.
+				while (scan_cursor < triangle_count && emitted[scan_cursor])
+				{
+					scan_cursor++;
+				}
+
+				best_triangle = scan_cursor;
+			}
+
+			const uint32_t* triangle = &indices[best_triangle * 3];
+			result.push_back(triangle[0]);
+			result.push_back(triangle[1]);
+			result.push_back(triangle[2]);
+			emitted[best_triangle] = 1;
+
+			// ׸ ﰢ ؽ ĳ  ű.
+			next_cache.clear();
+			for (uint32_t k = 0; k < 3; k++)
+			{
+				next_cache.push_back(triangle[k]);
+			}
+
+			for (uint32_t v : cache)
+			{
+				if (v != triangle[0] && v != triangle[1] && v != triangle[2])
+				{
+					next_cache.push_back(v);
+				}
+			}
+
+			// ׸ ﰢ  Ͽ   ﰢ  δ.
+			for (uint32_t k = 0; k < 3; k++)
+			{
+				const uint32_t v = triangle[k];
+				uint32_t* begin = &adjacency.triangles[adjacency.offsets[v]];
+				uint32_t* end = begin + remaining[v];
+				uint32_t* it = find(begin, end, best_triangle);
+
+				if (it != end)
+				{
+					*it = *(end - 1);
+					remaining[v]--;
+				}
+			}
+
+			// ĳÿ з ؽ ġ  ֺ ﰢ  .
+			for (size_t i = VERTEX_CACHE_SIZE; i < next_cache.size(); i++)
+			{
+				const uint32_t v = next_cache[i];
+				cache_position[v] = -1;
+
+				const float score = get_vertex_score(-1, remaining[v]);
+				const float delta = score - vertex_score[v];
+				vertex_score[v] = score;
+
+				const uint32_t* begin = &adjacency.triangles[adjacency.offsets[v]];
+				for (uint32_t j = 0; j < remaining[v]; j++)
+				{
+					triangle_score[begin[j]] += delta;
+				}
+			}
+
+			if (next_cache.size() > VERTEX_CACHE_SIZE)
+			{
+				next_cache.resize(VERTEX_CACHE_SIZE);
+			}
+
+			cache.swap(next_cache);
+
+			// ĳÿ ִ ؽ  ϰ  ֺ ﰢ       .
+			for (uint32_t i = 0; i < static_cast<uint32_t>(cache.size()); i++)
+			{
+				const uint32_t v = cache[i];
+				cache_position[v] = static_cast<int32_t>(i);
+
+				const float score = get_vertex_score(cache_position[v], remaining[v]);
+				const float delta = score - vertex_score[v];
+				vertex_score[v] = score;
+
+				const uint32_t* begin = &adjacency.triangles[adjacency.offsets[v]];
+				for (uint32_t j = 0; j < remaining[v]; j++)
+				{
+					triangle_score[begin[j]] += delta;
+				}
+			}
+
+			best_triangle = UINT32_MAX;
+			float best_score = 0.0f;
+
+			for (uint32_t v : cache)
+			{
+				const uint32_t* begin = &adjacency.triangles[adjacency.offsets[v]];
+				for (uint32_t j = 0; j < remaining[v]; j++)
+				{
+					const uint32_t t = begin[j];
+					//  ؽ ι  ﰢ  Ͽ    ִ.
+					if (!emitted[t] && triangle_score[t] > best_score)
+					{
+						best_score = triangle_score[t];
+						best_triangle = t;
+					}
+				}
+			}
+		}
+
+		indices.swap(result);
+	}
+
+	void MeshOptimizer::OptimizeOverdraw(vector<uint32_t>& indices, const vector<RHI_Vertex_PosTexNorTan>& vertices)
+	{
+		const uint32_t triangle_count = static_cast<uint32_t>(indices.size() / 3);
+		if (triangle_count < 2)
+			return;
+
+		//  FIFO ĳø ùķ̼ؼ  ؽ   ʴ   .
+		//    ״ ιǷ ĳ ȭ  κ ȴ.
+		vector<uint32_t> cluster_begin;
+		{
+			const uint32_t vertex_count = static_cast<uint32_t>(vertices.size());
+			vector<uint32_t> timestamps(vertex_count, 0);
+			uint32_t time = OVERDRAW_CACHE_SIZE + 1;
+
+			for (uint32_t t = 0; t < triangle_count; t++)
+			{
+				uint32_t misses = 0;
+
+				for (uint32_t k = 0; k < 3; k++)
+				{
+					const uint32_t v = indices[t * 3 + k];
+
+					if (time - timestamps[v] > OVERDRAW_CACHE_SIZE)
+					{
+						timestamps[v] = time++;
+						misses++;
+					}
+				}
+
+				if (t == 0 || misses == 3)
+				{
+					cluster_begin.push_back(t);
+				}
+			}
+		}
+
+		const uint32_t cluster_count = static_cast<uint32_t>(cluster_begin.size());
+		if (cluster_count < 2)
+			return;
+
+		cluster_begin.push_back(triangle_count);
+
+		// ޽ ü ߽ ( )
+		Vector3 mesh_centroid = Vector3::Zero;
+		float mesh_area = 0.0f;
+
+		vector<Vector3> cluster_centroid(cluster_count, Vector3::Zero);
+		vector<Vector3> cluster_normal(cluster_count, Vector3::Zero);
+
+		for (uint32_t c = 0; c < cluster_count; c++)
+		{
+			float cluster_area = 0.0f;
+
+			for (uint32_t t = cluster_begin[c]; t < cluster_begin[c + 1]; t++)
+			{
+				const Vector3 p0 = get_position(vertices[indices[t * 3 + 0]]);
+				const Vector3 p1 = get_position(vertices[indices[t * 3 + 1]]);
+				const Vector3 p2 = get_position(vertices[indices[t * 3 + 2]]);
+
+				//  ̴  ι̹Ƿ ״ ġ .
+				const Vector3 normal = Vector3::Cross(p1 - p0, p2 - p0);
+				const float area = normal.Length();
+				const Vector3 centroid = (p0 + p1 + p2) * (1.0f / 3.0f);
+
+				cluster_centroid[c] += centroid * area;
+				cluster_normal[c] += normal;
+				cluster_area += area;
+			}
+
+			mesh_centroid += cluster_centroid[c];
+			mesh_area += cluster_area;
+
+			cluster_centroid[c] = cluster_area > 0.0f ? cluster_centroid[c] * (1.0f / cluster_area) : get_position(vertices[indices[cluster_begin[c] * 3]]);
+			cluster_normal[c] = cluster_normal[c].Normalized();
+		}
+
+		if (mesh_area > 0.0f)
+		{
+			mesh_centroid = mesh_centroid * (1.0f / mesh_area);
+		}
+
+		// ߽ɿ ְ ٱ  ϼ ٸ   ɼ Ƿ  ׸.
+		vector<float> cluster_sort_key(cluster_count);
+		for (uint32_t c = 0; c < cluster_count; c++)
+		{
+			cluster_sort_key[c] = Vector3::Dot(cluster_centroid[c] - mesh_centroid, cluster_normal[c]);
+		}
+
+		vector<uint32_t> cluster_order(cluster_count);
+		iota(cluster_order.begin(), cluster_order.end(), 0);
+		stable_sort(cluster_order.begin(), cluster_order.end(), [&cluster_sort_key](uint32_t a, uint32_t b)
+			{
+				return cluster_sort_key[a] > cluster_sort_key[b];
+			});
+
+		vector<uint32_t> result;
+		result.reserve(indices.size());
+
+		for (uint32_t c : cluster_order)
+		{
+			result.insert(result.end(), indices.begin() + cluster_begin[c] * 3, indices.begin() + cluster_begin[c + 1] * 3);
+		}
+
+		indices.swap(result);
+	}
+
+	void MeshOptimizer::OptimizeVertexFetch(vector<uint32_t>& indices, vector<RHI_Vertex_PosTexNorTan>& vertices, vector<vector<uint32_t>>* lods, vector<uint32_t>* vertex_remap)
+	{
+		vector<uint32_t> remap(vertices.size(), UINT32_MAX);
+		vector<RHI_Vertex_PosTexNorTan> reordered;
+		reordered.reserve(vertices.size());
+
+		const auto remap_indices = [&remap, &reordered, &vertices](vector<uint32_t>& list)
+		{
+			for (uint32_t& index : list)
+			{
+				if (remap[index] == UINT32_MAX)
+				{
+					remap[index] = static_cast<uint32_t>(reordered.size());
+					reordered.push_back(vertices[index]);
+				}
+
+				index = remap[index];
+			}
+		};
+
+		remap_indices(indices);
+
+		// LOD   ؽ ϹǷ  ؽ ߰ ʴ´.
+		if (lods)
+		{
+			for (vector<uint32_t>& lod : *lods)
+			{
+				remap_indices(lod);
+			}
+		}
+
+		vertices.swap(reordered);
+
+		if (vertex_remap)
+		{
+			vertex_remap->swap(remap);
+		}
+	}
+
+	vector<uint32_t> MeshOptimizer::Simplify(const vector<uint32_t>& indices, const vector<RHI_Vertex_PosTexNorTan>& vertices, uint32_t target_index_count, float target_error, float* result_error)
+	{
+		vector<uint32_t> result = indices;
+
+		if (result_error)
+		{
+			*result_error = 0.0f;
+		}
+
+		const uint32_t vertex_count = static_cast<uint32_t>(vertices.size());
+		if (result.size() <= target_index_count || vertex_count == 0)
+			return result;
+
+		// ġ ޽ ũ ȭؼ  ޽ ũ    ְ Ѵ.
+		vector<Vector3> positions(vertex_count);
+		{
+			Vector3 min = Vector3::Inf;
+			Vector3 max = Vector3::NegInf;
+
+			for (const RHI_Vertex_PosTexNorTan& vertex : vertices)
+			{
+				const Vector3 position = get_position(vertex);
+				min = Vector3(std::min(min.x, position.x), std::min(min.y, position.y), std::min(min.z, position.z));
+				max = Vector3(std::max(max.x, position.x), std::max(max.y, position.y), std::max(max.z, position.z));
+			}
+
+			const Vector3 size = max - min;
+			const float extent = std::max(size.x, std::max(size.y, size.z));
+			const float scale = extent > 0.0f ? 1.0f / extent : 1.0f;
+
+			for (uint32_t v = 0; v < vertex_count; v++)
+			{
+				positions[v] = (get_position(vertices[v]) - min) * scale;
+			}
+		}
+
+		//  ġ ؽ(UV 븻   ؽ) ϳ ġ ID ´.
+		vector<uint32_t> position_id(vertex_count);
+		vector<uint32_t> wedge_count(vertex_count, 0);
+		{
+			unordered_map<sPositionKey, uint32_t, sPositionKeyHash> position_map;
+			position_map.reserve(vertex_count);
+
+			for (uint32_t v = 0; v < vertex_count; v++)
+			{
+				const sPositionKey key = { vertices[v].pos[0], vertices[v].pos[1], vertices[v].pos[2] };
+				position_id[v] = position_map.emplace(key, v).first->second;
+				wedge_count[position_id[v]]++;
+			}
+		}
+
+		// , , Ŵ尡 ƴ  ؽ ̸ ̳ UV  Ƿ Ѵ.
+		vector<uint8_t> locked(vertex_count, 0);
+		{
+			for (uint32_t v = 0; v < vertex_count; v++)
+			{
+				if (wedge_count[position_id[v]] > 1)
+				{
+					locked[position_id[v]] = 1;
+				}
+			}
+
+			unordered_map<uint64_t, uint32_t> edge_count;
+			edge_count.reserve(result.size());
+
+			for (size_t i = 0; i < result.size(); i += 3)
+			{
+				for (uint32_t k = 0; k < 3; k++)
+				{
+					edge_count[get_edge_key(position_id[result[i + k]], position_id[result[i + (k + 1) % 3]])]++;
+				}
+			}
+
+			for (size_t i = 0; i < result.size(); i += 3)
+			{
+				for (uint32_t k = 0; k < 3; k++)
+				{
+					const uint32_t a = position_id[result[i + k]];
+					const uint32_t b = position_id[result[i + (k + 1) % 3]];
+
+					if (edge_count[get_edge_key(a, b)] != 2)
+					{
+						locked[a] = 1;
+						locked[b] = 1;
+					}
+				}
+			}
+		}
+
+		// ġ ֺ ﰢ    .
+		vector<sQuadric> quadrics(vertex_count);
+		for (size_t i = 0; i < result.size(); i += 3)
+		{
+			const Vector3& p0 = positions[result[i + 0]];
+			const Vector3& p1 = positions[result[i + 1]];
+			const Vector3& p2 = positions[result[i + 2]];
+
+			const Vector3 normal = Vector3::Cross(p1 - p0, p2 - p0);
+			const float length = normal.Length();
+			if (length <= 0.0f)
+				continue;
+
+			const Vector3 n = normal * (1.0f / length);
+			const double d = -static_cast<double>(Vector3::Dot(n, p0));
+
+			for (uint32_t k = 0; k < 3; k++)
+			{
+				quadrics[position_id[result[i + k]]].AddPlane(n.x, n.y, n.z, d);
+			}
+		}
+
+		struct sCollapse
+		{
+			uint32_t from;
+			uint32_t to;
+			double cost;
+		};
+
+		const double error_limit = static_cast<double>(target_error) * static_cast<double>(target_error);
+		double max_error = 0.0;
+
+		sTriangleAdjacency adjacency;
+		vector<sCollapse> collapses;
+		vector<uint32_t> collapse_target(vertex_count);
+		vector<uint8_t> touched(vertex_count);
+
+		// ر  ֺ ﰢ   ȮѴ.
+		const auto flips = [&](uint32_t from, uint32_t to)
+		{
+			const Vector3& target = positions[to];
+			const uint32_t* begin = &adjacency.triangles[adjacency.offsets[from]];
+
+			for (uint32_t j = 0; j < adjacency.counts[from]; j++)
+			{
+				const uint32_t* triangle = &result[begin[j] * 3];
+
+				// ر   ﰢ .
+				if (position_id[triangle[0]] == position_id[to] || position_id[triangle[1]] == position_id[to] || position_id[triangle[2]] == position_id[to])
+					continue;
+
+				const Vector3& p0 = positions[triangle[0]];
+				const Vector3& p1 = positions[triangle[1]];
+				const Vector3& p2 = positions[triangle[2]];
+
+				const Vector3 q0 = triangle[0] == from ? target : p0;
+				const Vector3 q1 = triangle[1] == from ? target : p1;
+				const Vector3 q2 = triangle[2] == from ? target : p2;
+
+				const Vector3 old_normal = Vector3::Cross(p1 - p0, p2 - p0);
+				const Vector3 new_normal = Vector3::Cross(q1 - q0, q2 - q0);
+
+				if (Vector3::Dot(old_normal, new_normal) <= 0.0f)
+					return true;
+			}
+
+			return false;
+		};
+
+		//  н   ʴ ر   Ƽ Ѵ.
+		while (result.size() > target_index_count)
+		{
+			adjacency.Build(result, vertex_count);
+
+			collapses.clear();
+			for (size_t i = 0; i < result.size(); i += 3)
+			{
+				for (uint32_t k = 0; k < 3; k++)
+				{
+					const uint32_t a = result[i + k];
+					const uint32_t b = result[i + (k + 1) % 3];
+
+					//    ﰢ ݴ  ѹ Ƿ  ⸸ .
+					if (a > b)
+						continue;
+
+					const uint32_t pa = position_id[a];
+					const uint32_t pb = position_id[b];
+					if (pa == pb || (locked[pa] && locked[pb]))
+						continue;
+
+					sQuadric quadric = quadrics[pa];
+					quadric.Add(quadrics[pb]);
+
+					const double cost_ab = locked[pa] ? DBL_MAX : quadric.Evaluate(positions[b]);
+					const double cost_ba = locked[pb] ? DBL_MAX : quadric.Evaluate(positions[a]);
+
+					if (cost_ab <= cost_ba)
+					{
+						collapses.push_back({ a, b, cost_ab });
+					}
+					else
+					{
+						collapses.push_back({ b, a, cost_ba });
+					}
+				}
+			}
+
+			if (collapses.empty())
+				break;
+
+			sort(collapses.begin(), collapses.end(), [](const sCollapse& a, const sCollapse& b)
+				{
+					return a.cost < b.cost;
+				});
+
+			iota(collapse_target.begin(), collapse_target.end(), 0);
+			fill(touched.begin(), touched.end(), static_cast<uint8_t>(0));
+
+			const size_t triangles_to_remove = (result.size() - target_index_count) / 3 + 1;
+			size_t removed_triangles = 0;
+			bool collapsed = false;
+
+			for (const sCollapse& collapse : collapses)
+			{
+				if (collapse.cost > error_limit || removed_triangles >= triangles_to_remove)
+					break;
+
+				if (touched[collapse.from] || touched[collapse.to])
+					continue;
+
+				if (flips(collapse.from, collapse.to))
+					continue;
+
+				collapse_target[collapse.from] = collapse.to;
+				quadrics[position_id[collapse.to]].Add(quadrics[position_id[collapse.from]]);
+				max_error = std::max(max_error, collapse.cost);
+				collapsed = true;
+
+				// ֺ ﰢ  ٲǷ ̹ н ֺ ؽ  ǵ帮 ʴ´.
+				const uint32_t* begin = &adjacency.triangles[adjacency.offsets[collapse.from]];
+				for (uint32_t j = 0; j < adjacency.counts[collapse.from]; j++)
+				{
+					const uint32_t* triangle = &result[begin[j] * 3];
+
+					touched[triangle[0]] = 1;
+					touched[triangle[1]] = 1;
+					touched[triangle[2]] = 1;
+
+					const uint32_t to = position_id[collapse.to];
+					if (position_id[triangle[0]] == to || position_id[triangle[1]] == to || position_id[triangle[2]] == to)
+					{
+						removed_triangles++;
+					}
+				}
+			}
+
+			if (!collapsed)
+				break;
+
+			// ر ϰ ̰  ﰢ .
+			size_t write = 0;
+			for (size_t i = 0; i < result.size(); i += 3)
+			{
+				const uint32_t a = collapse_target[result[i + 0]];
+				const uint32_t b = collapse_target[result[i + 1]];
+				const uint32_t c = collapse_target[result[i + 2]];
+
+				if (position_id[a] == position_id[b] || position_id[b] == position_id[c] || position_id[a] == position_id[c])
+					continue;
+
+				result[write++] = a;
+				result[write++] = b;
+				result[write++] = c;
+			}
+
+			result.resize(write);
+		}
+
+		if (result_error)
+		{
+			*result_error = static_cast<float>(sqrt(max_error));
+		}
+
+		return result;
+	}
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include "../RHI/RHI_Definition.h"
+
+namespace PlayGround
+{
+	// ޽ LOD ϳ ( ε   )
+	// LOD  ޽ ؽ ״ Ƿ ؽ   .
+	struct sMeshLod
+	{
+		//  ޽ LOD (LOD 0 ε )
+		uint32_t base_index_offset = 0;
+		uint32_t index_offset = 0;
+		uint32_t index_count = 0;
+		//  ũ(ȭ  )   ۾  LOD ׸.
+		float screen_size = 0.0f;
+	};
+
+	// Ʈ  ѹ ϴ ޽ ȭ
+	//  ޽ ϳ  ε(0 ) ٷ.
+	class MeshOptimizer
+	{
+	public:
+		// ȯ  ؽ ĳ ߷  ﰢ  ٲ۴. (Forsyth)
+		static void OptimizeVertexCache(std::vector<uint32_t>& indices, uint32_t vertex_count);
+
+		// ĳ ȭ     ٱ   ׸ ؼ ο츦 δ.
+		static void OptimizeOverdraw(std::vector<uint32_t>& indices, const std::vector<RHI_Vertex_PosTexNorTan>& vertices);
+
+		// ó Ǵ  ؽ ٽ ġؼ ؽ ġ  Ͼ Ѵ.
+		//  ʴ ؽ . lods ִٸ  ؽ  ٸ ε  ٲ۴.
+		// vertex_remap ִٸ  ؽ ->  ؽ ȣ ´. ( ʾ  ؽ UINT32_MAX)
+		static void OptimizeVertexFetch(std::vector<uint32_t>& indices, std::vector<RHI_Vertex_PosTexNorTan>& vertices, std::vector<std::vector<uint32_t>>* lods = nullptr, std::vector<uint32_t>* vertex_remap = nullptr);
+
+		//  (QEM)   ر target_index_count  ε ȯѴ.
+		// ؽ   ʰ  ؽ رŰǷ  ؽ ۸ ״   ִ.
+		// target_error ޽ ũ   ̸ ̸ Ѵ ر  ʴ´.
+		static std::vector<uint32_t> Simplify(const std::vector<uint32_t>& indices, const std::vector<RHI_Vertex_PosTexNorTan>& vertices, uint32_t target_index_count, float target_error, float* result_error = nullptr);
+	};
+}
@@ -3,6 +3,7 @@
 #include "Mesh.h"
 #include "Renderer.h"
 #include "../IO/FileStream.h"
+#include "../IO/AssetContainer.h"
 #include "../Core/Stopwatch.h"
 #include "../Resource/ResourceCache.h"
 #include "../Resource/Importer/ModelImporter.h"
@@ -19,6 +20,17 @@ using namespace PlayGround::Math;
 
 namespace PlayGround
 {
+    //   ûũ
+    static constexpr uint32_t MODEL_CHUNK_PATH = AssetChunkId('P', 'A', 'T', 'H');
+    static constexpr uint32_t MODEL_CHUNK_SCALE = AssetChunkId('S', 'C', 'A', 'L');
+    static constexpr uint32_t MODEL_CHUNK_INDICES = AssetChunkId('I', 'N', 'D', 'X');
+    static constexpr uint32_t MODEL_CHUNK_VERTICES = AssetChunkId('V', 'E', 'R', 'T');
+    static constexpr uint32_t MODEL_CHUNK_LODS = AssetChunkId('L', 'O', 'D', 'S');
+    static constexpr uint32_t MODEL_CHUNK_JOINTS = AssetChunkId('J', 'N', 'T', 'S');
+    static constexpr uint32_t MODEL_CHUNK_JOINT_NAMES = AssetChunkId('J', 'N', 'A', 'M');
+    static constexpr uint32_t MODEL_CHUNK_BONES = AssetChunkId('B', 'O', 'N', 'E');
+    static constexpr uint32_t MODEL_CHUNK_SKIN = AssetChunkId('S', 'K', 'I', 'N');
+
     //  ʱȭ
     Model::Model(Context* context) : IResource(context, EResourceType::Model)
     {
@@ -38,6 +50,9 @@ namespace PlayGround
         m_VertexBuffer.reset();
         m_IndexBuffer.reset();
         m_Mesh->Clear();
+        m_vecLods.clear();
+        m_Skeleton.Clear();
+        m_vecSkinWeights.clear();
         m_AABB.Undefine();
         m_NormalizedScale = 1.0f;
         m_IsAnimated = false;
@@ -56,15 +71,83 @@ namespace PlayGround
         //   ü ̸
         if (FileSystem::GetExtensionFromFilePath(file_path) == EXTENSION_MODEL)
         {
-            //  Ʈ ҷ´.
-            auto file = make_unique<FileStream>(file_path, FileStream_Read);
-            if (!file->IsOpen())
-                return false;
-
-            SetResourceFilePath(file->ReadAs<string>());
-            file->Read(&m_NormalizedScale);
-            file->Read(&m_Mesh->GetIndices());
-            file->Read(&m_Mesh->GetVertices());
+            // ûũ ̳ʶ ε ޸𸮿 ޽ ѹ Ѵ.
+            if (AssetContainer::IsAssetContainer(file_path))
+            {
+                AssetContainer container;
+                if (!container.Open(file_path))
+                    return false;
+
+                uint64_t path_length = 0;
+                uint64_t scale_count = 0;
+                uint64_t index_count = 0;
+                uint64_t vertex_count = 0;
+                const char* path = container.GetChunkData<char>(MODEL_CHUNK_PATH, &path_length);
+                const float* scale = container.GetChunkData<float>(MODEL_CHUNK_SCALE, &scale_count);
+                const uint32_t* indices = container.GetChunkData<uint32_t>(MODEL_CHUNK_INDICES, &index_count);
+                const RHI_Vertex_PosTexNorTan* vertices = container.GetChunkData<RHI_Vertex_PosTexNorTan>(MODEL_CHUNK_VERTICES, &vertex_count);
+
+                if (!indices || !vertices || index_count == 0 || vertex_count == 0)
+                {
+                    LOG_ERROR("\"%s\" is missing geometry chunks", file_path.c_str());
+                    return false;
+                }
+
+                SetResourceFilePath(path ? string(path, static_cast<size_t>(path_length)) : string());
+                m_NormalizedScale = scale_count != 0 ? *scale : 1.0f;
+                m_Mesh->GetIndices().assign(indices, indices + index_count);
+                m_Mesh->GetVertices().assign(vertices, vertices + vertex_count);
+
+                // LOD     ׸.
+                uint64_t lod_count = 0;
+                const sMeshLod* lods = container.GetChunkData<sMeshLod>(MODEL_CHUNK_LODS, &lod_count);
+                if (lods)
+                {
+                    m_vecLods.assign(lods, lods + lod_count);
+                }
+
+                // ̷ (ִϸ̼ 𵨸)
+                uint64_t joint_count = 0;
+                uint64_t joint_names_length = 0;
+                uint64_t bone_count = 0;
+                uint64_t skin_count = 0;
+                const sSkeletonJoint* joints = container.GetChunkData<sSkeletonJoint>(MODEL_CHUNK_JOINTS, &joint_count);
+                const char* joint_names = container.GetChunkData<char>(MODEL_CHUNK_JOINT_NAMES, &joint_names_length);
+                const sSkeletonBone* bones = container.GetChunkData<sSkeletonBone>(MODEL_CHUNK_BONES, &bone_count);
+                const sSkinWeight* skin = container.GetChunkData<sSkinWeight>(MODEL_CHUNK_SKIN, &skin_count);
+                if (joints && joint_count != 0)
+                {
+                    // ̸ '\0' еǾ ִ.
+                    vector<string> names;
+                    names.reserve(joint_count);
+                    for (const char* begin = joint_names, *end = joint_names + (joint_names ? joint_names_length : 0); begin < end;)
+                    {
+                        const char* name_end = find(begin, end, '\0');
+                        names.emplace_back(begin, name_end);
+                        begin = name_end + 1;
+                    }
+
+                    m_Skeleton.Set(vector<sSkeletonJoint>(joints, joints + joint_count), move(names), bones ? vector<sSkeletonBone>(bones, bones + bone_count) : vector<sSkeletonBone>());
+                    m_IsAnimated = true;
+
+                    if (skin && skin_count == vertex_count)
+                    {
+                        m_vecSkinWeights.assign(skin, skin + skin_count);
+                    }
+                }
+            }
+            //    Ʈ ҷ´.
+            else
+            {
+                auto file = make_unique<FileStream>(file_path, FileStream_Read);
+                if (!file->IsOpen())
+                    return false;
+
+                SetResourceFilePath(file->ReadAs<string>());
+                file->Read(&m_NormalizedScale);
+                file->Read(&m_Mesh->GetIndices());
+                file->Read(&m_Mesh->GetVertices());
+            }
 
             UpdateGeometry();
         }
@@ -104,21 +187,42 @@ namespace PlayGround
         return true;
     }
 
-    //  Ʈ 
+    // ûũ ̳ʷ 
     bool Model::SaveToFile(const string& file_path)
     {
-        auto file = make_unique<FileStream>(file_path, FileStream_Write);
-        if (!file->IsOpen())
+        AssetContainerWriter file(file_path);
+        if (!file.IsOpen())
             return false;
 
-        file->Write(GetResourceFilePath());
-        file->Write(m_NormalizedScale);
-        file->Write(m_Mesh->GetIndices());
-        file->Write(m_Mesh->GetVertices());
+        const string& resource_path = GetResourceFilePath();
+
+        file.AddChunk(MODEL_CHUNK_PATH, resource_path.data(), resource_path.size());
+        file.AddChunk(MODEL_CHUNK_SCALE, &m_NormalizedScale, sizeof(m_NormalizedScale));
+        file.AddChunk(MODEL_CHUNK_INDICES, m_Mesh->GetIndices());
+        file.AddChunk(MODEL_CHUNK_VERTICES, m_Mesh->GetVertices());
+        if (!m_vecLods.empty())
+        {
+            file.AddChunk(MODEL_CHUNK_LODS, m_vecLods);
+        }
+        if (!m_Skeleton.IsEmpty())
+        {
+            string joint_names;
+            for (const string& name : m_Skeleton.GetJointNames())
+            {
+                joint_names += name;
+                joint_names += '\0';
+            }
 
-        file->Close();
+            file.AddChunk(MODEL_CHUNK_JOINTS, m_Skeleton.GetJoints());
+            file.AddChunk(MODEL_CHUNK_JOINT_NAMES, joint_names.data(), joint_names.size());
+            file.AddChunk(MODEL_CHUNK_BONES, m_Skeleton.GetBones());
+            if (!m_vecSkinWeights.empty())
+            {
+                file.AddChunk(MODEL_CHUNK_SKIN, m_vecSkinWeights);
+            }
+        }
 
-        return true;
+        return file.Close();
     }
 
     void Model::AppendGeometry(const vector<uint32_t>& indices, const vector<RHI_Vertex_PosTexNorTan>& vertices, uint32_t* index_offset, uint32_t* vertex_offset) const
@@ -131,17 +235,75 @@ namespace PlayGround
         m_Mesh->VerticesAppend(vertices, vertex_offset);
     }
 
+    void Model::AppendSkinWeights(const uint32_t vertex_offset, const vector<sSkinWeight>& weights)
+    {
+        //   ޽ ġ 0 ä ؽ  .
+        if (m_vecSkinWeights.size() < vertex_offset + weights.size())
+        {
+            m_vecSkinWeights.resize(vertex_offset + weights.size());
+        }
+
+        copy(weights.begin(), weights.end(), m_vecSkinWeights.begin() + vertex_offset);
+    }
+
+    void Model::AppendLod(const uint32_t base_index_offset, const vector<uint32_t>& indices, const float screen_size)
+    {
+        ASSERT(!indices.empty());
+
+        sMeshLod lod;
+        lod.base_index_offset = base_index_offset;
+        lod.index_count = static_cast<uint32_t>(indices.size());
+        lod.screen_size = screen_size;
+
+        m_Mesh->IndicesAppend(indices, &lod.index_offset);
+        m_vecLods.push_back(lod);
+    }
+
+    void Model::GetLods(const uint32_t base_index_offset, vector<sMeshLod>* lods) const
+    {
+        lods->clear();
+
+        for (const sMeshLod& lod : m_vecLods)
+        {
+            if (lod.base_index_offset == base_index_offset)
+            {
+                lods->push_back(lod);
+            }
+        }
+
+        // ȭ鿡 ū ͺ ( LOD)
+        sort(lods->begin(), lods->end(), [](const sMeshLod& a, const sMeshLod& b)
+            {
+                return a.screen_size > b.screen_size;
+            });
+    }
+
     void Model::GetGeometry(const uint32_t index_offset, const uint32_t index_count, const uint32_t vertex_offset, const uint32_t vertex_count, vector<uint32_t>* indices, vector<RHI_Vertex_PosTexNorTan>* vertices) const
     {
         m_Mesh->GetGeometry(index_offset, index_count, vertex_offset, vertex_count, indices, vertices);
     }
 
+    float Model::RayCast(const Ray& ray, const uint32_t index_offset, const uint32_t index_count, const uint32_t vertex_offset) const
+    {
+        return m_Mesh->RayCast(ray, index_offset, index_count, vertex_offset);
+    }
+
     void Model::UpdateGeometry()
     {
         ASSERT(m_Mesh->IndicesCount() != 0);
         ASSERT(m_Mesh->VerticesCount() != 0);
 
+        // ۸  ä  Ƿ   BVH .
+        m_Mesh->InvalidateBVH();
+
         GeometryCreateBuffers();
+
+        //  ޽鿡  ٸ ġ ؽ ª.
+        if (!m_vecSkinWeights.empty())
+        {
+            m_vecSkinWeights.resize(m_Mesh->VerticesCount());
+        }
+
         m_NormalizedScale = GeometryComputeNormalizedScale();
         m_AABB = BoundingBox(m_Mesh->GetVertices().data(), static_cast<uint32_t>(m_Mesh->GetVertices().size()));
     }
@@ -187,8 +349,9 @@ namespace PlayGround
     {
         auto success = true;
 
-        const auto indices = m_Mesh->GetIndices();
-        const auto vertices = m_Mesh->GetVertices();
+        //  ʰ ޽ ۸ ״ ѱ.
+        const auto& indices = m_Mesh->GetIndices();
+        const auto& vertices = m_Mesh->GetVertices();
 
         // ε  
         if (!indices.empty())
@@ -3,6 +3,8 @@
 #include <memory>
 #include <vector>
 #include "Material.h"
+#include "MeshOptimizer.h"
+#include "Animation.h"
 #include "../RHI/RHI_Definition.h"
 #include "../Resource/IResource.h"
 #include "../Math/BoundingBox.h"
@@ -14,6 +16,11 @@ namespace PlayGround
 	class Entity;
 	class Mesh;
 
+	namespace Math
+	{
+		class Ray;
+	}
+
     //  Ŭ
 	class Model : public IResource, public std::enable_shared_from_this<Model>
 	{
@@ -41,14 +48,33 @@ namespace PlayGround
             std::vector<uint32_t>* indices,
             std::vector<RHI_Vertex_PosTexNorTan>* vertices
         ) const;
+        //    ޽   ﰢ Ÿ (ٸ INFINITY)
+        float RayCast(const Math::Ray& ray, uint32_t index_offset, uint32_t index_count, uint32_t vertex_offset) const;
         void UpdateGeometry();
+
+        // base_index_offset ޽ LOD ߰Ѵ. (ε ޽ ؽ  )
+        void AppendLod(uint32_t base_index_offset, const std::vector<uint32_t>& indices, float screen_size);
+        // ε ۿ ̹  ִ LOD  Ѵ.
+        inline void AddLod(const sMeshLod& lod) { m_vecLods.push_back(lod); }
+        // base_index_offset ޽  LOD  ͺ ä.
+        void GetLods(uint32_t base_index_offset, std::vector<sMeshLod>* lods) const;
+        inline const std::vector<sMeshLod>& GetLods() const { return m_vecLods; }
         inline const auto& GetAABB() const { return m_AABB; }
         inline const auto& GetMesh() const { return m_Mesh; }
 
         inline void SetRootEntity(const std::shared_ptr<Entity>& entity) { m_RootEntity = entity; }
+        inline std::shared_ptr<Entity> GetRootEntity() const { return m_RootEntity.lock(); }
         void AddMaterial(std::shared_ptr<Material>& material, const std::shared_ptr<Entity>& entity) const;
         void AddTexture(std::shared_ptr<Material>& material, Material_Property texture_type, const std::string& file_path);
 
+        // Ű (̷ ִ 𵨸)
+        // Ų ġ  ؽ  ̸   ޽ ġ  0̴.
+        void AppendSkinWeights(uint32_t vertex_offset, const std::vector<sSkinWeight>& weights);
+        inline const std::vector<sSkinWeight>& GetSkinWeights() const { return m_vecSkinWeights; }
+        inline Skeleton& GetSkeleton() { return m_Skeleton; }
+        inline const Skeleton& GetSkeleton()             const { return m_Skeleton; }
+        inline bool HasSkin()                            const { return m_Skeleton.GetBoneCount() != 0 && !m_vecSkinWeights.empty(); }
+
         inline bool IsAnimated()                         const { return m_IsAnimated; }
         inline void SetAnimated(const bool is_animated) { m_IsAnimated = is_animated; }
         inline const RHI_IndexBuffer* GetIndexBuffer()   const { return m_IndexBuffer.get(); }
@@ -63,6 +89,10 @@ namespace PlayGround
         std::shared_ptr<RHI_VertexBuffer> m_VertexBuffer;
         std::shared_ptr<RHI_IndexBuffer> m_IndexBuffer;
         std::shared_ptr<Mesh> m_Mesh;
+        //  ޽ LOD (LOD 0 ޽ ü̹Ƿ   ʴ.)
+        std::vector<sMeshLod> m_vecLods;
+        Skeleton m_Skeleton;
+        std::vector<sSkinWeight> m_vecSkinWeights;
         Math::BoundingBox m_AABB;
         float m_NormalizedScale = 1.0f;
         bool m_IsAnimated = false;
@@ -6,6 +6,7 @@
 #include "../Utils/Sampling.h"              
 #include "../Profiling/Profiler.h"              
 #include "../Resource/ResourceCache.h"          
+#include "../World/World.h"
 #include "../World/Entity.h"                    
 #include "../World/Components/Transform.h"      
 #include "../World/Components/Renderable.h"     
@@ -26,6 +27,7 @@
 #include "../Input/Input.h"                     
 #include "../World/Components/Environment.h"    
 #include "../Core/Context.h"
+#include "../Core/FrameStages.h"
 #include "../Core/Timer.h"
 #include "../Display/Display.h"
 
@@ -99,7 +101,9 @@ namespace PlayGround
         m_option_values[Renderer::OptionValue::Bloom_Intensity] = 0.2f;
         m_option_values[Renderer::OptionValue::Fog] = 0.08f;
 
-        SUBSCRIBE_TO_EVENT(EventType::WorldResolved, EVENT_HANDLER_VARIANT(OnRenderablesAcquire));
+        SUBSCRIBE_TO_EVENT(EventType::EntityRenderStateChanged, EVENT_HANDLER_VARIANT(OnEntityRenderStateChanged));
+        SUBSCRIBE_TO_EVENT(EventType::EntityRemoved, EVENT_HANDLER_VARIANT(OnEntityRemoved));
+        SUBSCRIBE_TO_EVENT(EventType::MaterialTransparencyChanged, EVENT_HANDLER_VARIANT(OnMaterialTransparencyChanged));
         SUBSCRIBE_TO_EVENT(EventType::WorldPreClear, EVENT_HANDLER(OnClear));
         SUBSCRIBE_TO_EVENT(EventType::WorldLoadEnd, EVENT_HANDLER(OnWorldLoaded));
         SUBSCRIBE_TO_EVENT(EventType::WindowOnFullScreenToggled, EVENT_HANDLER(OnFullScreenToggled));
@@ -111,7 +115,9 @@ namespace PlayGround
 
     Renderer::~Renderer()
     {
-        UNSUBSCRIBE_FROM_EVENT(EventType::WorldResolved, EVENT_HANDLER_VARIANT(OnRenderablesAcquire));
+        UNSUBSCRIBE_FROM_EVENT(EventType::EntityRenderStateChanged, EVENT_HANDLER_VARIANT(OnEntityRenderStateChanged));
+        UNSUBSCRIBE_FROM_EVENT(EventType::EntityRemoved, EVENT_HANDLER_VARIANT(OnEntityRemoved));
+        UNSUBSCRIBE_FROM_EVENT(EventType::MaterialTransparencyChanged, EVENT_HANDLER_VARIANT(OnMaterialTransparencyChanged));
         UNSUBSCRIBE_FROM_EVENT(EventType::WorldPreClear, EVENT_HANDLER(OnClear));
         UNSUBSCRIBE_FROM_EVENT(EventType::WorldLoadEnd, EVENT_HANDLER(OnWorldLoaded));
         UNSUBSCRIBE_FROM_EVENT(EventType::WindowOnFullScreenToggled, EVENT_HANDLER(OnFullScreenToggled));
@@ -183,6 +189,9 @@ namespace PlayGround
             Flush();
         }
 
+        // ̹ ӱ  ƼƼ   ݿѴ.
+        RenderListUpdate();
+
         {
             Window* window = m_Context->GetSubModule<Window>();
             uint32_t width = static_cast<uint32_t>(window->IsMinimized() ? 0 : window->GetWidth());
@@ -326,6 +335,9 @@ namespace PlayGround
             m_cb_frame_cpu.set_bit(GetOption(Renderer::Option::Ssao_Gi), 1 << 5);
         }
 
+        // н  ü ѹ Ѵ.
+        CullingUpdate();
+
         Lines_PreMain();
         Pass_Main(m_cmd_current);
         Lines_PostMain(delta_time);
@@ -334,6 +346,14 @@ namespace PlayGround
         m_cmd_current->Submit();
     }
 
+    bool Renderer::RegisterFrameStages(FrameGraph& graph, ETickType tick_group)
+    {
+        // RHI  忡 ϸ  ٸ ʴ´.
+        graph.AddStage(FrameStages::RENDERER, tick_group, [this](double delta_time) { Update(delta_time); });
+
+        return true;
+    }
+
     void Renderer::SetViewport(float width, float height)
     {
         if (IsCallingFromOtherThread())
@@ -500,65 +520,225 @@ namespace PlayGround
         cmd_list->SetConstantBuffer(Renderer::Bindings_Cb::material, RHI_Shader_Pixel, m_cb_material_gpu);
     }
 
-    void Renderer::OnRenderablesAcquire(const Variant& entities_variant)
+    void Renderer::OnEntityRenderStateChanged(const Variant& entity)
+    {
+        // ҷ  ٸ 忡   Ƿ Ƶΰ Update ݿѴ.
+        lock_guard<mutex> lock(m_entities_pending_mutex);
+        m_entities_pending.emplace(entity.Get<Entity*>());
+    }
+
+    void Renderer::OnEntityRemoved(const Variant& entity)
+    {
+        Entity* removed = entity.Get<Entity*>();
+
+        {
+            lock_guard<mutex> lock(m_entities_pending_mutex);
+            m_entities_pending.erase(removed);
+        }
+
+        // ƼƼ  ǹǷ ٷ .
+        RenderListRemove(removed);
+    }
+
+    void Renderer::OnMaterialTransparencyChanged(const Variant& material)
+    {
+        lock_guard<mutex> lock(m_entities_pending_mutex);
+        m_materials_pending.emplace(static_cast<Material*>(material.Get<void*>()));
+    }
+
+    void Renderer::RenderListRebuild()
     {
         SCOPED_TIME_BLOCK(m_profiler);
 
         m_entities.clear();
+        m_entity_indices.clear();
         m_camera = nullptr;
 
-        vector<shared_ptr<Entity>> entities = entities_variant.Get<vector<shared_ptr<Entity>>>();
-        for (const auto& entity : entities)
         {
-            if (!entity || !entity->IsActive())
-                continue;
+            lock_guard<mutex> lock(m_entities_pending_mutex);
+            m_entities_pending.clear();
+            m_materials_pending.clear();
+        }
 
-            if (Renderable* renderable = entity->GetComponent<Renderable>())
+        for (const auto& entity : m_Context->GetSubModule<World>()->EntityGetAll())
+        {
+            RenderListAdd(entity.get());
+        }
+
+        m_entities_sort_needed = true;
+    }
+
+    void Renderer::RenderListUpdate()
+    {
+        World* world = m_Context->GetSubModule<World>();
+
+        // ҷ ߿ ƼƼ  Ƿ   ٸ.
+        if (world->IsLoading())
+            return;
+
+        if (m_entities_rebuild.exchange(false))
+        {
+            RenderListRebuild();
+        }
+        else
+        {
+            unordered_set<Entity*> entities;
+            unordered_set<Material*> materials;
+
+            {
+                lock_guard<mutex> lock(m_entities_pending_mutex);
+                entities.swap(m_entities_pending);
+                materials.swap(m_materials_pending);
+            }
+
+            // Ƽ ٲٸ  Ƽ  ƼƼ ٽ зѴ.
+            if (!materials.empty())
             {
-                bool is_transparent = false;
-                bool is_visible = true;
+                world->Each<Renderable>([&entities, &materials](Renderable* renderable)
+                {
+                    if (materials.count(renderable->GetMaterial()))
+                        entities.emplace(renderable->GetEntity());
+                });
+            }
 
-                if (const Material* material = renderable->GetMaterial())
+            if (!entities.empty())
+            {
+                SCOPED_TIME_BLOCK(m_profiler);
+
+                for (Entity* entity : entities)
                 {
-                    is_transparent = material->GetColorAlbedo().w < 1.0f;
-                    is_visible = material->GetColorAlbedo().w != 0.0f;
+                    RenderListRemove(entity);
+                    RenderListAdd(entity);
                 }
+            }
+        }
+
+        //  ٲų ī޶   ٽ Ѵ.
+        if (m_camera && m_camera->GetTransform()->GetPosition() != m_entities_sort_camera_position)
+            m_entities_sort_needed = true;
+
+        if (m_entities_sort_needed)
+        {
+            for (const ObjectType type : { ObjectType::GeometryOpaque, ObjectType::GeometryTransparent })
+            {
+                vector<Entity*>& bucket = m_entities[type];
+                SortRenderables(&bucket);
 
-                if (is_visible)
+                // ķ ġ ٲǷ ٽ Ѵ.
+                unordered_map<Entity*, uint32_t>& indices = m_entity_indices[type];
+                for (uint32_t i = 0; i < static_cast<uint32_t>(bucket.size()); i++)
                 {
-                    m_entities[is_transparent ? ObjectType::GeometryTransparent : ObjectType::GeometryOpaque].emplace_back(entity.get());
+                    indices[bucket[i]] = i;
                 }
             }
 
-            if (Light* light = entity->GetComponent<Light>())
+            if (m_camera)
+                m_entities_sort_camera_position = m_camera->GetTransform()->GetPosition();
+
+            m_entities_sort_needed = false;
+        }
+    }
+
+    void Renderer::RenderListAdd(Entity* entity)
+    {
+        if (!entity || !entity->IsActive())
+            return;
+
+        const auto add = [this, entity](ObjectType type)
+        {
+            vector<Entity*>& bucket = m_entities[type];
+            m_entity_indices[type][entity] = static_cast<uint32_t>(bucket.size());
+            bucket.emplace_back(entity);
+        };
+
+        if (Renderable* renderable = entity->GetComponent<Renderable>())
+        {
+            bool is_transparent = false;
+            bool is_visible = true;
+
+            if (const Material* material = renderable->GetMaterial())
             {
-                m_entities[ObjectType::Light].emplace_back(entity.get());
+                is_transparent = material->GetColorAlbedo().w < 1.0f;
+                is_visible = material->GetColorAlbedo().w != 0.0f;
             }
 
-            if (Camera* camera = entity->GetComponent<Camera>())
+            if (is_visible)
             {
-                m_entities[ObjectType::Camera].emplace_back(entity.get());
-                m_camera = camera->GetSharedPtr<Camera>();
+                add(is_transparent ? ObjectType::GeometryTransparent : ObjectType::GeometryOpaque);
+                m_entities_sort_needed = true;
             }
+        }
 
-            if (ReflectionProbe* reflection_probe = entity->GetComponent<ReflectionProbe>())
+        if (entity->GetComponent<Light>())
+        {
+            add(ObjectType::Light);
+        }
+
+        if (Camera* camera = entity->GetComponent<Camera>())
+        {
+            add(ObjectType::Camera);
+            m_camera = camera->GetSharedPtr<Camera>();
+        }
+
+        if (entity->GetComponent<ReflectionProbe>())
+        {
+            add(ObjectType::ReflectionProbe);
+        }
+    }
+
+    void Renderer::RenderListRemove(Entity* entity)
+    {
+        for (auto& [type, indices] : m_entity_indices)
+        {
+            const auto it = indices.find(entity);
+            if (it == indices.end())
+                continue;
+
+            //  ƼƼ ڸ ٲ㼭 Ѵ.
+            vector<Entity*>& bucket = m_entities[type];
+            const uint32_t index = it->second;
+            indices.erase(it);
+
+            if (index != bucket.size() - 1)
             {
-                m_entities[ObjectType::ReflectionProbe].emplace_back(entity.get());
+                bucket[index] = bucket.back();
+                indices[bucket[index]] = index;
             }
+
+            bucket.pop_back();
+
+            if (type == ObjectType::GeometryOpaque || type == ObjectType::GeometryTransparent)
+                m_entities_sort_needed = true;
         }
 
-        SortRenderables(&m_entities[ObjectType::GeometryOpaque]);
-        SortRenderables(&m_entities[ObjectType::GeometryTransparent]);
+        // ī޶ Ǿٸ ִ ٸ ī޶ Ѵ.
+        if (m_camera && m_camera->GetEntity() == entity)
+        {
+            m_camera = nullptr;
+
+            for (Entity* camera_entity : m_entities[ObjectType::Camera])
+            {
+                if (Camera* camera = camera_entity->GetComponent<Camera>())
+                    m_camera = camera->GetSharedPtr<Camera>();
+            }
+        }
     }
 
     void Renderer::OnClear()
     {
         Flush();
         m_entities.clear();
+        m_entity_indices.clear();
+
+        lock_guard<mutex> lock(m_entities_pending_mutex);
+        m_entities_pending.clear();
+        m_materials_pending.clear();
     }
 
     void Renderer::OnWorldLoaded()
     {
+        // ҷ  ü   ѹ ٽ .
+        m_entities_rebuild = true;
         m_is_rendering_allowed = true;
     }
 
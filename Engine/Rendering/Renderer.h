@@ -1,6 +1,8 @@
 #pragma once
 
 #include <unordered_map>
+#include <unordered_set>
+#include <mutex>
 #include <array>
 #include <atomic>
 #include "Renderer_ConstantBuffers.h"
@@ -267,6 +269,7 @@ namespace PlayGround
 
         void OnInit() override;
         void Update(double delta_time) override;
+        bool RegisterFrameStages(FrameGraph& graph, ETickType tick_group) override;
 
         void DrawLine(const Math::Vector3& from, const Math::Vector3& to, const Math::Vector4& color_from = DEBUG_COLOR, const Math::Vector4& color_to = DEBUG_COLOR, const float duration = 0.0f, const bool depth = true);
         void DrawTriangle(const Math::Vector3& v0, const Math::Vector3& v1, const Math::Vector3& v2, const Math::Vector4& color = DEBUG_COLOR, const float duration = 0.0f, const bool depth = true);
@@ -382,12 +385,31 @@ namespace PlayGround
         void Pass_Copy(RHI_CommandList* cmd_list, RHI_Texture* tex_in, RHI_Texture* tex_out, const bool bilinear);
         void Pass_Generate_Mips();
 
-        void OnRenderablesAcquire(const Variant& renderables);
+        void OnEntityRenderStateChanged(const Variant& entity);
+        void OnEntityRemoved(const Variant& entity);
+        void OnMaterialTransparencyChanged(const Variant& material);
         void OnClear();
         void OnWorldLoaded();
         void OnFullScreenToggled();
 
+        //   ƼƼ   ٽ . ( ε  )
+        void RenderListRebuild();
+        // ٸ  ׾Ƶ  ׸  Ͽ ݿѴ.
+        void RenderListUpdate();
+        // ƼƼ  ¿ ´ Ŷ ߰Ѵ.
+        void RenderListAdd(Entity* entity);
+        // ƼƼ ִ  Ŷ .
+        void RenderListRemove(Entity* entity);
         void SortRenderables(std::vector<Entity*>* renderables);
+
+        // Ʈ Ŷ   AABB SoA 迭 ϰ ī޶ ü Ѵ. (Ӹ ѹ)
+        void CullingUpdate();
+        //  Ŷ ڽ Ұ ѹ ˻ؼ ü Ʈ ä.
+        void Cull(ObjectType type, const Math::Frustum& frustum, bool ignore_near_plane, std::vector<uint64_t>& visibility);
+        // ī޶󿡼  ũ  ׸ LOD .
+        void LodUpdate();
+        // ø Ŀ Ŷ þٸ ˻  ̹Ƿ δٰ óѴ.
+        static inline bool IsVisible(const std::vector<uint64_t>& visibility, uint32_t index) { return index / 64 >= visibility.size() || ((visibility[index / 64] >> (index % 64)) & 1) != 0; }
         bool IsCallingFromOtherThread();
 
         void Lines_PreMain();
@@ -506,6 +528,31 @@ namespace PlayGround
         std::shared_ptr<RHI_SwapChain> m_swap_chain;
 
         std::unordered_map<ObjectType, std::vector<Entity*>> m_entities;
+        // Ŷ ƼƼ ġ (ٷ ϱ  Ѵ.)
+        std::unordered_map<ObjectType, std::unordered_map<Entity*, uint32_t>> m_entity_indices;
+        // Ʈ Ŷ ٲ ٽ ؾ ϴ
+        bool m_entities_sort_needed = false;
+        Math::Vector3 m_entities_sort_camera_position;
+        // ٸ 峪 ̺Ʈ ׾Ƶ  
+        std::mutex m_entities_pending_mutex;
+        std::unordered_set<Entity*> m_entities_pending;
+        std::unordered_set<Material*> m_materials_pending;
+        std::atomic<bool> m_entities_rebuild = false;
+        // ø    AABB (Ŷ  )
+        struct CullingBounds
+        {
+            std::vector<float> center_x;
+            std::vector<float> center_y;
+            std::vector<float> center_z;
+            std::vector<float> extent_x;
+            std::vector<float> extent_y;
+            std::vector<float> extent_z;
+        };
+        std::unordered_map<ObjectType, CullingBounds> m_culling_bounds;
+        // Ŷ ī޶ ü
+        std::unordered_map<ObjectType, std::vector<uint64_t>> m_visibility_camera;
+        //  ĳ̵峪 κ 鸶 ٽ ä  ü
+        std::vector<uint64_t> m_visibility_view;
         std::array<Material*, m_max_material_instances> m_material_instances;
         std::shared_ptr<Camera> m_camera;
 
@@ -0,0 +1,147 @@
+#include "Common.h"
+#include "Renderer.h"
+#include "../Profiling/Profiler.h"
+#include "../World/World.h"
+#include "../World/SceneBVH.h"
+#include "../World/Entity.h"
+#include "../World/Components/Camera.h"
+#include "../World/Components/Renderable.h"
+#include "../World/Components/Transform.h"
+#include "../Math/Frustum.h"
+
+using namespace std;
+using namespace PlayGround::Math;
+
+namespace PlayGround
+{
+    // Ŷ ̸ŭ ũٸ  ڽ ȴ   BVH ̴ ͸ ã´.
+    static constexpr uint32_t CULLING_BVH_THRESHOLD = 4096;
+
+    void Renderer::CullingUpdate()
+    {
+        SCOPED_TIME_BLOCK(m_profiler);
+
+        for (const ObjectType type : { ObjectType::GeometryOpaque, ObjectType::GeometryTransparent })
+        {
+            const vector<Entity*>& entities = m_entities[type];
+            const uint32_t count = static_cast<uint32_t>(entities.size());
+
+            CullingBounds& bounds = m_culling_bounds[type];
+
+            // ū Ŷ BVH øϹǷ  ʿ䰡 .
+            const uint32_t packed_count = count < CULLING_BVH_THRESHOLD ? count : 0;
+            bounds.center_x.resize(packed_count);
+            bounds.center_y.resize(packed_count);
+            bounds.center_z.resize(packed_count);
+            bounds.extent_x.resize(packed_count);
+            bounds.extent_y.resize(packed_count);
+            bounds.extent_z.resize(packed_count);
+
+            // ƼƼ AABB ѹ ͼ صд.
+            //   ƼƼ н ɷǷ ƹ ̳ ־д.
+            for (uint32_t i = 0; i < packed_count; i++)
+            {
+                Vector3 center = Vector3::Zero;
+                Vector3 extent = Vector3::Zero;
+
+                if (Renderable* renderable = entities[i]->GetRenderable())
+                {
+                    const BoundingBox& box = renderable->GetAabb();
+                    center = box.GetCenter();
+                    extent = box.GetExtents();
+                }
+
+                bounds.center_x[i] = center.x;
+                bounds.center_y[i] = center.y;
+                bounds.center_z[i] = center.z;
+                bounds.extent_x[i] = extent.x;
+                bounds.extent_y[i] = extent.y;
+                bounds.extent_z[i] = extent.z;
+            }
+
+            vector<uint64_t>& visibility = m_visibility_camera[type];
+
+            if (m_camera)
+            {
+                Cull(type, m_camera->GetFrustum(), false, visibility);
+            }
+            else
+            {
+                visibility.assign((count + 63) / 64, 0);
+            }
+        }
+
+        LodUpdate();
+    }
+
+    void Renderer::LodUpdate()
+    {
+        if (!m_camera)
+            return;
+
+        //   Ÿ  ũⰡ  Ƿ ׻  ׸.
+        const bool perspective = m_camera->GetProjectionType() == Projection_Perspective;
+        const Vector3 camera_position = m_camera->GetTransform()->GetPosition();
+        const float tan_half_fov = tanf(m_camera->GetFovVerticalRad() * 0.5f);
+
+        // ׸ н  LOD Ƿ ī޶  ʴ ƼƼ .
+        for (const ObjectType type : { ObjectType::GeometryOpaque, ObjectType::GeometryTransparent })
+        {
+            for (Entity* entity : m_entities[type])
+            {
+                Renderable* renderable = entity->GetRenderable();
+                if (!renderable || renderable->GetLodCount() <= 1)
+                    continue;
+
+                if (!perspective)
+                {
+                    renderable->SelectLod(1.0f);
+                    continue;
+                }
+
+                // ٿ  ȭ ̿ ϴ 
+                const BoundingBox& box = renderable->GetAabb();
+                const float radius = box.GetExtents().Length();
+                const float distance = Vector3::Distance(camera_position, box.GetCenter());
+                const float screen_size = distance > radius ? radius / (distance * tan_half_fov) : 1.0f;
+
+                renderable->SelectLod(screen_size);
+            }
+        }
+    }
+
+    void Renderer::Cull(ObjectType type, const Frustum& frustum, bool ignore_near_plane, vector<uint64_t>& visibility)
+    {
+        const uint32_t entity_count = static_cast<uint32_t>(m_entities[type].size());
+        World* world = m_Context->GetSubModule<World>();
+
+        if (entity_count >= CULLING_BVH_THRESHOLD && !world->IsLoading())
+        {
+            visibility.assign((entity_count + 63) / 64, 0);
+
+            // BVH   Ƿ  Ŷ ִ ͸ ǥѴ.
+            const unordered_map<Entity*, uint32_t>& indices = m_entity_indices[type];
+            world->GetSceneBVH()->QueryFrustum(frustum, ignore_near_plane, [&indices, &visibility](Entity* entity)
+            {
+                const auto it = indices.find(entity);
+                if (it != indices.end())
+                    visibility[it->second / 64] |= static_cast<uint64_t>(1) << (it->second % 64);
+            });
+
+            return;
+        }
+
+        const CullingBounds& bounds = m_culling_bounds[type];
+        const uint32_t count = static_cast<uint32_t>(bounds.center_x.size());
+
+        visibility.resize((count + 63) / 64);
+
+        if (count == 0)
+            return;
+
+        frustum.IsVisibleBatch(
+            bounds.center_x.data(), bounds.center_y.data(), bounds.center_z.data(),
+            bounds.extent_x.data(), bounds.extent_y.data(), bounds.extent_z.data(),
+            count, visibility.data(), ignore_near_plane);
+    }
+}
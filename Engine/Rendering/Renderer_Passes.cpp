@@ -159,7 +159,8 @@ namespace PlayGround
         if (!shader_v->IsCompiled() || !shader_p->IsCompiled())
             return;
 
-        const vector<Entity*>& entities = m_entities[is_transparent_pass ? ObjectType::GeometryTransparent : ObjectType::GeometryOpaque];
+        const ObjectType object_type = is_transparent_pass ? ObjectType::GeometryTransparent : ObjectType::GeometryOpaque;
+        const vector<Entity*>& entities = m_entities[object_type];
         if (entities.empty())
             return;
 
@@ -214,6 +215,9 @@ namespace PlayGround
                     pso.rasterizer_state = m_rasterizer_light_point_spot.get();
                 }
 
+                // ⼺   ÷̾  ʴ  ׸ڸ    near plane Ѵ.
+                Cull(object_type, light->GetFrustum(array_index), light->GetLightType() == LightType::Directional, m_visibility_view);
+
                 bool render_pass_active = false;
                 uint64_t m_set_material_id = 0;
 
@@ -236,7 +240,7 @@ namespace PlayGround
                     if (!material)
                         continue;
 
-                    if (!light->IsInViewFrustum(renderable, array_index))
+                    if (!IsVisible(m_visibility_view, entity_index))
                         continue;
 
                     if (!render_pass_active)
@@ -257,12 +261,12 @@ namespace PlayGround
                     }
 
                     cmd_list->SetBufferIndex(model->GetIndexBuffer());
-                    cmd_list->SetBufferVertex(model->GetVertexBuffer());
+                    cmd_list->SetBufferVertex(renderable->GetVertexBuffer());
 
                     m_cb_uber_cpu.transform = entity->GetTransform()->GetMatrix() * view_projection;
                     Update_Cb_Uber(cmd_list);
 
-                    cmd_list->DrawIndexed(renderable->GeometryIndexCount(), renderable->GeometryIndexOffset(), renderable->GeometryVertexOffset());
+                    cmd_list->DrawIndexed(renderable->LodIndexCount(), renderable->LodIndexOffset(), renderable->GetVertexOffset());
                 }
 
                 if (render_pass_active)
@@ -323,10 +327,15 @@ namespace PlayGround
 
                 Matrix view_projection = probe->GetViewMatrix(face_index) * probe->GetProjectionMatrix();
 
+                Cull(ObjectType::GeometryOpaque, probe->GetFrustum(face_index), false, m_visibility_view);
+
                 for (uint32_t index_renderable = 0; index_renderable < static_cast<uint32_t>(renderables.size()); index_renderable++)
                 {
                     Entity* entity = renderables[index_renderable];
 
+                    if (!IsVisible(m_visibility_view, index_renderable))
+                        continue;
+
                     for (uint32_t index_light = 0; index_light < static_cast<uint32_t>(lights.size()); index_light++)
                     {
                         if (Light* light = lights[index_light]->GetComponent<Light>())
@@ -345,11 +354,8 @@ namespace PlayGround
                                 if (!model || !model->GetVertexBuffer() || !model->GetIndexBuffer())
                                     continue;
 
-                                if (!probe->IsInViewFrustum(renderable, face_index))
-                                    continue;
-
                                 cmd_list->SetBufferIndex(model->GetIndexBuffer());
-                                cmd_list->SetBufferVertex(model->GetVertexBuffer());
+                                cmd_list->SetBufferVertex(renderable->GetVertexBuffer());
 
                                 cmd_list->SetTexture(Renderer::Bindings_Srv::material_albedo, material->GetTexturePtr(Material_Color));
                                 cmd_list->SetTexture(Renderer::Bindings_Srv::material_roughness, material->GetTexturePtr(Material_Metallic));
@@ -366,7 +372,7 @@ namespace PlayGround
 
                                 Update_Cb_Light(cmd_list, light, RHI_Shader_Pixel);
 
-                                cmd_list->DrawIndexed(renderable->GeometryIndexCount(), renderable->GeometryIndexOffset(), renderable->GeometryVertexOffset());
+                                cmd_list->DrawIndexed(renderable->LodIndexCount(), renderable->LodIndexOffset(), renderable->GetVertexOffset());
                             }
                         }
                     }
@@ -388,6 +394,7 @@ namespace PlayGround
 
         RHI_Texture* tex_depth = RENDER_TARGET(RenderTarget::Gbuffer_Depth).get();
         const auto& entities = m_entities[ObjectType::GeometryOpaque];
+        const vector<uint64_t>& visibility = m_visibility_camera[ObjectType::GeometryOpaque];
 
         static RHI_PipelineState pso;
         pso.shader_vertex = shader_v;
@@ -405,8 +412,13 @@ namespace PlayGround
         {
             uint64_t currently_bound_geometry = 0;
 
-            for (const auto& entity : entities)
+            for (uint32_t i = 0; i < static_cast<uint32_t>(entities.size()); i++)
             {
+                if (!IsVisible(visibility, i))
+                    continue;
+
+                Entity* entity = entities[i];
+
                 Renderable* renderable = entity->GetRenderable();
                 if (!renderable)
                     continue;
@@ -423,14 +435,12 @@ namespace PlayGround
                 if (!transform)
                     continue;
 
-                if (!m_camera->IsInViewFrustum(renderable))
-                    continue;
-
-                if (currently_bound_geometry != model->GetObjectID())
+                // Ų  ڱ ؽ ۸ Ƿ  ̾ ٽ Ѵ.
+                if (currently_bound_geometry != model->GetObjectID() || renderable->IsSkinned())
                 {
                     cmd_list->SetBufferIndex(model->GetIndexBuffer());
-                    cmd_list->SetBufferVertex(model->GetVertexBuffer());
-                    currently_bound_geometry = model->GetObjectID();
+                    cmd_list->SetBufferVertex(renderable->GetVertexBuffer());
+                    currently_bound_geometry = renderable->IsSkinned() ? 0 : model->GetObjectID();
                 }
 
                 cmd_list->SetTexture(Renderer::Bindings_Srv::material_albedo, material->GetTexturePtr(Material_Color));
@@ -441,7 +451,7 @@ namespace PlayGround
                 m_cb_uber_cpu.is_transparent_pass = material->HasTexture(Material_AlphaMask);
                 Update_Cb_Uber(cmd_list);
 
-                cmd_list->DrawIndexed(renderable->GeometryIndexCount(), renderable->GeometryIndexOffset(), renderable->GeometryVertexOffset());
+                cmd_list->DrawIndexed(renderable->LodIndexCount(), renderable->LodIndexOffset(), renderable->GetVertexOffset());
             }
 
             cmd_list->EndRenderPass();
@@ -491,11 +501,15 @@ namespace PlayGround
         uint64_t material_bound_id = 0;
         m_material_instances.fill(nullptr);
         auto& entities = m_entities[is_transparent_pass ? ObjectType::GeometryTransparent : ObjectType::GeometryOpaque];
+        const vector<uint64_t>& visibility = m_visibility_camera[is_transparent_pass ? ObjectType::GeometryTransparent : ObjectType::GeometryOpaque];
 
         if (cmd_list->BeginRenderPass(pso))
         {
             for (uint32_t i = 0; i < static_cast<uint32_t>(entities.size()); i++)
             {
+                if (!IsVisible(visibility, i))
+                    continue;
+
                 Entity* entity = entities[i];
 
                 Renderable* renderable = entity->GetRenderable();
@@ -510,11 +524,8 @@ namespace PlayGround
                 if (!model || !model->GetVertexBuffer() || !model->GetIndexBuffer())
                     continue;
 
-                if (!m_camera->IsInViewFrustum(renderable))
-                    continue;
-
                 cmd_list->SetBufferIndex(model->GetIndexBuffer());
-                cmd_list->SetBufferVertex(model->GetVertexBuffer());
+                cmd_list->SetBufferVertex(renderable->GetVertexBuffer());
 
                 const bool firs_run = material_index == 0;
                 const bool new_material = material_bound_id != material->GetObjectID();
@@ -571,7 +582,7 @@ namespace PlayGround
                     Update_Cb_Uber(cmd_list);
                 }
 
-                cmd_list->DrawIndexed(renderable->GeometryIndexCount(), renderable->GeometryIndexOffset(), renderable->GeometryVertexOffset());
+                cmd_list->DrawIndexed(renderable->LodIndexCount(), renderable->LodIndexOffset(), renderable->GetVertexOffset());
 
                 if (m_profiler)
                 {
@@ -1931,9 +1942,9 @@ namespace PlayGround
 
                 cmd_list->SetTexture(Renderer::Bindings_Srv::gbuffer_depth, tex_depth);
                 cmd_list->SetTexture(Renderer::Bindings_Srv::gbuffer_normal, tex_normal);
-                cmd_list->SetBufferVertex(model->GetVertexBuffer());
+                cmd_list->SetBufferVertex(renderable->GetVertexBuffer());
                 cmd_list->SetBufferIndex(model->GetIndexBuffer());
-                cmd_list->DrawIndexed(renderable->GeometryIndexCount(), renderable->GeometryIndexOffset(), renderable->GeometryVertexOffset());
+                cmd_list->DrawIndexed(renderable->LodIndexCount(), renderable->LodIndexOffset(), renderable->GetVertexOffset());
                 cmd_list->EndRenderPass();
             }
         }
@@ -0,0 +1,228 @@
+#include "Common.h"
+#include "Skinning.h"
+#include "../Math/MathSimd.h"
+#include <cmath>
+#include <cstring>
+
+using namespace std;
+using namespace PlayGround::Math;
+
+namespace PlayGround
+{
+	namespace
+	{
+		inline void normalize3(float* v)
+		{
+			const float length_squared = v[0] * v[0] + v[1] * v[1] + v[2] * v[2];
+			if (length_squared <= 0.0f)
+				return;
+
+			const float length_inverse = 1.0f / sqrtf(length_squared);
+			v[0] *= length_inverse;
+			v[1] *= length_inverse;
+			v[2] *= length_inverse;
+		}
+	}
+
+	void Skinning::BindChannels(const Skeleton& skeleton, const Animation& clip, vector<int32_t>* channel_joints)
+	{
+		const vector<string>& channels = clip.GetChannelNames();
+		channel_joints->resize(channels.size());
+
+		for (uint32_t i = 0; i < static_cast<uint32_t>(channels.size()); i++)
+		{
+			(*channel_joints)[i] = skeleton.FindJoint(channels[i]);
+		}
+	}
+
+	void Skinning::SamplePose(const Skeleton& skeleton, const Animation* clip, const double time, const vector<int32_t>& channel_joints, vector<sAnimationCursor>* cursors,
+		vector<Vector3>* positions, vector<Quaternion>* rotations, vector<Vector3>* scales)
+	{
+		// ä   ε  .
+		const vector<sSkeletonJoint>& joints = skeleton.GetJoints();
+		for (uint32_t i = 0; i < static_cast<uint32_t>(joints.size()); i++)
+		{
+			(*positions)[i] = joints[i].bind_position;
+			(*rotations)[i] = joints[i].bind_rotation;
+			(*scales)[i] = joints[i].bind_scale;
+		}
+
+		if (!clip)
+			return;
+
+		for (uint32_t i = 0; i < static_cast<uint32_t>(channel_joints.size()); i++)
+		{
+			const int32_t joint = channel_joints[i];
+			if (joint < 0)
+				continue;
+
+			clip->SampleChannel(i, time, &(*cursors)[i], &(*positions)[joint], &(*rotations)[joint], &(*scales)[joint]);
+		}
+	}
+
+	void Skinning::BlendPose(const vector<Vector3>& from_positions, const vector<Quaternion>& from_rotations, const vector<Vector3>& from_scales, const float t,
+		vector<Vector3>* positions, vector<Quaternion>* rotations, vector<Vector3>* scales)
+	{
+		for (uint32_t i = 0; i < static_cast<uint32_t>(positions->size()); i++)
+		{
+			(*positions)[i] = Vector3::Lerp(from_positions[i], (*positions)[i], t);
+			(*rotations)[i] = Quaternion::Slerp(from_rotations[i], (*rotations)[i], t);
+			(*scales)[i] = Vector3::Lerp(from_scales[i], (*scales)[i], t);
+		}
+	}
+
+	void Skinning::ComputeBoneMatrices(const Skeleton& skeleton, const vector<Vector3>& positions, const vector<Quaternion>& rotations, const vector<Vector3>& scales,
+		vector<Matrix>* local, vector<Matrix>* global, vector<Matrix>* bone_matrices)
+	{
+		Matrix::ComposeTRS(positions, rotations, scales, *local);
+
+		// θ ׻ տ Ƿ ѹ 鼭    Ѵ.
+		const vector<sSkeletonJoint>& joints = skeleton.GetJoints();
+		for (uint32_t i = 0; i < static_cast<uint32_t>(joints.size()); i++)
+		{
+			(*global)[i] = joints[i].parent < 0 ? (*local)[i] : (*local)[i] * (*global)[joints[i].parent];
+		}
+
+		const vector<sSkeletonBone>& bones = skeleton.GetBones();
+		for (uint32_t i = 0; i < static_cast<uint32_t>(bones.size()); i++)
+		{
+			(*bone_matrices)[i] = bones[i].offset * (*global)[bones[i].joint];
+		}
+	}
+
+	void Skinning::ComputeSkinMatrices(const Skeleton& skeleton, const vector<Matrix>& bone_matrices, const uint32_t mesh_joint, vector<Matrix>* skin_matrices)
+	{
+		const Matrix& mesh_inverse = skeleton.GetBindGlobalInverse(mesh_joint);
+		for (uint32_t i = 0; i < static_cast<uint32_t>(bone_matrices.size()); i++)
+		{
+			(*skin_matrices)[i] = Matrix::Transpose(bone_matrices[i] * mesh_inverse);
+		}
+	}
+
+	// Ų  ġǾ ־ Data()    ִ. (v * M = x * 0 + y * 1 + z * 2 + 3)
+	void Skinning::SkinVertices(const Matrix* skin_matrices, const sSkinWeight* weights, const RHI_Vertex_PosTexNorTan* source, RHI_Vertex_PosTexNorTan* result, const uint32_t count, BoundingBox* aabb)
+	{
+		Vector3 min = Vector3::Inf;
+		Vector3 max = Vector3::NegInf;
+
+#if defined(MATH_SIMD_SSE)
+		__m128 min_v = _mm_set1_ps(Util::INFINITY_);
+		__m128 max_v = _mm_set1_ps(-Util::INFINITY_);
+
+		for (uint32_t i = 0; i < count; i++)
+		{
+			const sSkinWeight& weight = weights[i];
+			const RHI_Vertex_PosTexNorTan& in = source[i];
+			RHI_Vertex_PosTexNorTan& out = result[i];
+
+			//   ؽ ״ д.
+			if (GetWeightSum(weight) <= 0.0f)
+			{
+				out = in;
+				const __m128 position = _mm_set_ps(0.0f, in.pos[2], in.pos[1], in.pos[0]);
+				min_v = _mm_min_ps(min_v, position);
+				max_v = _mm_max_ps(max_v, position);
+				continue;
+			}
+
+			__m128 rows[4];
+			{
+				const float* m0 = skin_matrices[weight.bones[0]].Data();
+				const float* m1 = skin_matrices[weight.bones[1]].Data();
+				const float* m2 = skin_matrices[weight.bones[2]].Data();
+				const float* m3 = skin_matrices[weight.bones[3]].Data();
+				const __m128 w0 = _mm_set1_ps(weight.weights[0]);
+				const __m128 w1 = _mm_set1_ps(weight.weights[1]);
+				const __m128 w2 = _mm_set1_ps(weight.weights[2]);
+				const __m128 w3 = _mm_set1_ps(weight.weights[3]);
+
+				for (uint32_t r = 0; r < 4; r++)
+				{
+					__m128 row = _mm_mul_ps(w0, _mm_loadu_ps(m0 + r * 4));
+					row = _mm_add_ps(row, _mm_mul_ps(w1, _mm_loadu_ps(m1 + r * 4)));
+					row = _mm_add_ps(row, _mm_mul_ps(w2, _mm_loadu_ps(m2 + r * 4)));
+					row = _mm_add_ps(row, _mm_mul_ps(w3, _mm_loadu_ps(m3 + r * 4)));
+					rows[r] = row;
+				}
+			}
+
+			const auto transform = [&rows](const float* v)
+			{
+				__m128 t = _mm_mul_ps(_mm_set1_ps(v[0]), rows[0]);
+				t = _mm_add_ps(t, _mm_mul_ps(_mm_set1_ps(v[1]), rows[1]));
+				t = _mm_add_ps(t, _mm_mul_ps(_mm_set1_ps(v[2]), rows[2]));
+				return t;
+			};
+
+			float values[4];
+
+			const __m128 position = _mm_add_ps(transform(in.pos), rows[3]);
+			min_v = _mm_min_ps(min_v, position);
+			max_v = _mm_max_ps(max_v, position);
+			_mm_storeu_ps(values, position);
+			memcpy(out.pos, values, sizeof(out.pos));
+
+			// 븻 źƮ ̵  ϰ ٽ ȭѴ. (յ  Ѵ.)
+			_mm_storeu_ps(values, transform(in.nor));
+			memcpy(out.nor, values, sizeof(out.nor));
+			normalize3(out.nor);
+
+			_mm_storeu_ps(values, transform(in.tan));
+			memcpy(out.tan, values, sizeof(out.tan));
+			normalize3(out.tan);
+
+			memcpy(out.tex, in.tex, sizeof(out.tex));
+		}
+
+		if (count != 0)
+		{
+			float values[4];
+			_mm_storeu_ps(values, min_v);
+			min = Vector3(values[0], values[1], values[2]);
+			_mm_storeu_ps(values, max_v);
+			max = Vector3(values[0], values[1], values[2]);
+		}
+#else
+		for (uint32_t i = 0; i < count; i++)
+		{
+			const sSkinWeight& weight = weights[i];
+			const RHI_Vertex_PosTexNorTan& in = source[i];
+			RHI_Vertex_PosTexNorTan& out = result[i];
+
+			if (GetWeightSum(weight) <= 0.0f)
+			{
+				out = in;
+			}
+			else
+			{
+				float rows[16] = {};
+				for (uint32_t k = 0; k < 4; k++)
+				{
+					const float* m = skin_matrices[weight.bones[k]].Data();
+					for (uint32_t j = 0; j < 16; j++)
+					{
+						rows[j] += weight.weights[k] * m[j];
+					}
+				}
+
+				for (uint32_t j = 0; j < 3; j++)
+				{
+					out.pos[j] = in.pos[0] * rows[j] + in.pos[1] * rows[4 + j] + in.pos[2] * rows[8 + j] + rows[12 + j];
+					out.nor[j] = in.nor[0] * rows[j] + in.nor[1] * rows[4 + j] + in.nor[2] * rows[8 + j];
+					out.tan[j] = in.tan[0] * rows[j] + in.tan[1] * rows[4 + j] + in.tan[2] * rows[8 + j];
+				}
+
+				normalize3(out.nor);
+				normalize3(out.tan);
+				out.tex[0] = in.tex[0];
+				out.tex[1] = in.tex[1];
+			}
+
+			min = Vector3(std::min(min.x, out.pos[0]), std::min(min.y, out.pos[1]), std::min(min.z, out.pos[2]));
+			max = Vector3(std::max(max.x, out.pos[0]), std::max(max.y, out.pos[1]), std::max(max.z, out.pos[2]));
+		}
+#endif
+
+		*aabb = count != 0 ? BoundingBox(min, max) : BoundingBox();
+	}
+}
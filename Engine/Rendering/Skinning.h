@@ -0,0 +1,42 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include "Animation.h"
+#include "../Math/BoundingBox.h"
+#include "../RHI/RHI_Vertex.h"
+
+namespace PlayGround
+{
+	// ̷Ż ִϸ̼   CPU Ű
+	// Ʈ GPU ҽ  Ƿ ִϸ ۾  ׽Ʈ ״   ִ.
+	class Skinning
+	{
+	public:
+		static inline float GetWeightSum(const sSkinWeight& weight) { return weight.weights[0] + weight.weights[1] + weight.weights[2] + weight.weights[3]; }
+
+		// Ŭ ä -> ̷  (̷濡   -1)
+		static void BindChannels(const Skeleton& skeleton, const Animation& clip, std::vector<int32_t>* channel_joints);
+
+		// ε   Ŭ øѴ. (clip nullptr ε )
+		//  ۴  ŭ, cursors ä ŭ ־ Ѵ.
+		static void SamplePose(const Skeleton& skeleton, const Animation* clip, double time, const std::vector<int32_t>& channel_joints, std::vector<sAnimationCursor>* cursors,
+			std::vector<Math::Vector3>* positions, std::vector<Math::Quaternion>* rotations, std::vector<Math::Vector3>* scales);
+
+		//  (from)   tŭ Ѵ. (t 0̸ from, 1̸   ״)
+		static void BlendPose(const std::vector<Math::Vector3>& from_positions, const std::vector<Math::Quaternion>& from_rotations, const std::vector<Math::Vector3>& from_scales, float t,
+			std::vector<Math::Vector3>* positions, std::vector<Math::Quaternion>* rotations, std::vector<Math::Vector3>* scales);
+
+		//   ,   İ  offset *    Ѵ.
+		static void ComputeBoneMatrices(const Skeleton& skeleton, const std::vector<Math::Vector3>& positions, const std::vector<Math::Quaternion>& rotations, const std::vector<Math::Vector3>& scales,
+			std::vector<Math::Matrix>* local, std::vector<Math::Matrix>* global, std::vector<Math::Matrix>* bone_matrices);
+
+		// ޽   ؽ  Ų  (ε  ޽   ǵ.)
+		// SkinVertices   е ġؼ д.
+		static void ComputeSkinMatrices(const Skeleton& skeleton, const std::vector<Math::Matrix>& bone_matrices, uint32_t mesh_joint, std::vector<Math::Matrix>* skin_matrices);
+
+		// ؽ ִ 4 Ų  ġ  ġ, 븻, źƮ ϰ ڽ Ѵ.
+		//   ؽ ״ д.
+		static void SkinVertices(const Math::Matrix* skin_matrices, const sSkinWeight* weights, const RHI_Vertex_PosTexNorTan* source, RHI_Vertex_PosTexNorTan* result, uint32_t count, Math::BoundingBox* aabb);
+	};
+}
@@ -0,0 +1,243 @@
+#include "Common.h"
+#include "DerivedDataCache.h"
+#include "ResourceCache.h"
+#include "../IO/AssetContainer.h"
+#include <filesystem>
+#include <algorithm>
+#include <thread>
+#include <cstring>
+#include <cstdio>
+
+using namespace std;
+
+namespace PlayGround
+{
+	//   ûũ ( ؽ 迭, '\0'  ε)
+	static constexpr uint32_t DERIVED_CHUNK_DEPENDENCY_HASHES = AssetChunkId('D', 'E', 'P', 'H');
+	static constexpr uint32_t DERIVED_CHUNK_DEPENDENCY_PATHS = AssetChunkId('D', 'E', 'P', 'P');
+
+	DerivedDataCache::DerivedDataCache(Context* context)
+	{
+		m_Context = context;
+	}
+
+	uint64_t DerivedDataCache::Hash(const void* data, uint64_t size, uint64_t seed)
+	{
+		// Ʈ ƴ 8Ʈ   FNV-1a  (ū ҽ ϵ ޸ 뿪  ؽѴ.)
+		static constexpr uint64_t prime = 0x100000001b3ull;
+
+		const uint8_t* bytes = static_cast<const uint8_t*>(data);
+		uint64_t hash = 0xcbf29ce484222325ull ^ seed;
+		uint64_t i = 0;
+
+		for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t))
+		{
+			uint64_t word;
+			memcpy(&word, bytes + i, sizeof(word));
+
+			hash = (hash ^ word) * prime;
+			//   Ʈθ Ƿ  Ʈ ش.
+			hash ^= hash >> 29;
+		}
+
+		for (; i < size; i++)
+		{
+			hash = (hash ^ bytes[i]) * prime;
+		}
+
+		hash ^= size;
+		hash *= 0xff51afd7ed558ccdull;
+		hash ^= hash >> 33;
+
+		return hash;
+	}
+
+	uint64_t DerivedDataCache::ComputeKey(const string& source_path, uint64_t settings_hash, uint32_t importer_version)
+	{
+		if (!m_Enabled)
+			return 0;
+
+		const uint64_t content_hash = HashFile(source_path);
+		if (content_hash == 0)
+			return 0;
+
+		uint64_t key = Hash(&settings_hash, sizeof(settings_hash), content_hash);
+		key = Hash(&importer_version, sizeof(importer_version), key);
+
+		// 0 ĳø  ʴ´ٴ ̹Ƿ Ѵ.
+		return key != 0 ? key : 1;
+	}
+
+	bool DerivedDataCache::Open(uint64_t key, const char* extension, AssetContainer* container)
+	{
+		ASSERT(container != nullptr);
+
+		if (key == 0)
+			return false;
+
+		const string path = GetPath(key, extension);
+
+		if (!FileSystem::Exists(path))
+		{
+			m_MissCount++;
+			return false;
+		}
+
+		// ջ ̶  ٽ  Ѵ.
+		if (!container->Open(path))
+		{
+			LOG_WARNING("Derived data \"%s\" is corrupted and will be rebuilt", path.c_str());
+			FileSystem::Delete(path);
+			m_MissCount++;
+			return false;
+		}
+
+		// ҽ ״ ϴ  ٲٸ ٽ Ʈؼ  Ѵ.
+		if (!ValidateDependencies(*container))
+		{
+			container->Close();
+			m_MissCount++;
+			return false;
+		}
+
+		m_HitCount++;
+
+		return true;
+	}
+
+	void DerivedDataCache::AddDependencies(AssetContainerWriter& writer, const vector<string>& file_paths)
+	{
+		vector<uint64_t> hashes;
+		string paths;
+
+		for (const string& file_path : file_paths)
+		{
+			//   ϵ ؽ 0 ܼ ߿  ٽ ƮѴ.
+			hashes.emplace_back(HashFile(file_path));
+			paths += file_path;
+			paths += '\0';
+		}
+
+		writer.AddChunk(DERIVED_CHUNK_DEPENDENCY_HASHES, hashes);
+		writer.AddChunk(DERIVED_CHUNK_DEPENDENCY_PATHS, paths.data(), paths.size());
+	}
+
+	bool DerivedDataCache::Store(uint64_t key, const char* extension, const function<void(AssetContainerWriter&)>& write)
+	{
+		if (key == 0)
+			return false;
+
+		const string directory = GetDirectory();
+		if (!FileSystem::Exists(directory))
+		{
+			FileSystem::CreateDirectory_(directory);
+		}
+
+		const string path = GetPath(key, extension);
+		//  Ű  尡 ÿ   Ƿ ӽ  ̸ 带 ִ´.
+		const string temp_path = path + "." + to_string(hash<thread::id>{}(this_thread::get_id())) + ".tmp";
+
+		{
+			AssetContainerWriter writer(temp_path);
+			if (!writer.IsOpen())
+				return false;
+
+			write(writer);
+
+			if (!writer.Close())
+			{
+				FileSystem::Delete(temp_path);
+				return false;
+			}
+		}
+
+		error_code error;
+		filesystem::rename(temp_path, path, error);
+
+		// ٸ 尡  Űٸ   .
+		if (error)
+		{
+			FileSystem::Delete(temp_path);
+			return FileSystem::Exists(path);
+		}
+
+		return true;
+	}
+
+	string DerivedDataCache::GetDirectory() const
+	{
+		return m_Context->GetSubModule<ResourceCache>()->GetProjectDirectory() + "DerivedDataCache/";
+	}
+
+	string DerivedDataCache::GetPath(uint64_t key, const char* extension) const
+	{
+		char name[17];
+		snprintf(name, sizeof(name), "%016llx", static_cast<unsigned long long>(key));
+
+		return GetDirectory() + name + extension;
+	}
+
+	bool DerivedDataCache::ValidateDependencies(const AssetContainer& container)
+	{
+		uint64_t hash_count = 0;
+		uint64_t paths_length = 0;
+		const uint64_t* hashes = container.GetChunkData<uint64_t>(DERIVED_CHUNK_DEPENDENCY_HASHES, &hash_count);
+		const char* paths = container.GetChunkData<char>(DERIVED_CHUNK_DEPENDENCY_PATHS, &paths_length);
+
+		//    
+		if (!hashes)
+			return true;
+
+		const char* path = paths;
+		const char* end = paths ? paths + paths_length : nullptr;
+
+		for (uint64_t i = 0; i < hash_count; i++)
+		{
+			const char* path_end = path < end ? find(path, end, '\0') : end;
+			if (path >= end || path_end == end)
+				return false;
+
+			if (HashFile(string(path, path_end)) != hashes[i])
+				return false;
+
+			path = path_end + 1;
+		}
+
+		return true;
+	}
+
+	uint64_t DerivedDataCache::HashFile(const string& file_path)
+	{
+		error_code error;
+		const uint64_t size = static_cast<uint64_t>(filesystem::file_size(file_path, error));
+		if (error || size == 0)
+			return 0;
+
+		const int64_t write_time = static_cast<int64_t>(filesystem::last_write_time(file_path, error).time_since_epoch().count());
+		if (error)
+			return 0;
+
+		// Ʈ    ؽĸ   ϹǷ ѹ д´.
+		{
+			lock_guard<mutex> lock(m_Mutex);
+
+			const auto it = m_mapFileHashes.find(file_path);
+			if (it != m_mapFileHashes.end() && it->second.size == size && it->second.write_time == write_time)
+				return it->second.hash;
+		}
+
+		MappedFile file;
+		if (!file.Open(file_path))
+			return 0;
+
+		sFileStamp stamp;
+		stamp.size = size;
+		stamp.write_time = write_time;
+		stamp.hash = Hash(file.GetData(), file.GetSize());
+
+		lock_guard<mutex> lock(m_Mutex);
+		m_mapFileHashes[file_path] = stamp;
+
+		return stamp.hash;
+	}
+}
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <string>
+#include <atomic>
+#include <mutex>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+#include <cstdint>
+
+namespace PlayGround
+{
+	class Context;
+	class AssetContainer;
+	class AssetContainerWriter;
+
+	// Ͱ  (Ļ ) ҽ   ؽ÷ صδ ĳ
+	// Ű ҽ  ,  ,   Ƿ   ϳ ٲ ٽ ƮѴ.
+	//  γ  ð Ű  Ƿ  űų ٽ ޾Ƶ ĳø ״   ִ.
+	// ҽ ϴ (.mtl, .bin, ؽ ) Ʈ    Ƿ Ű   ο  ؽø  ϰ   ȮѴ.
+	class DerivedDataCache
+	{
+	public:
+		DerivedDataCache(Context* context);
+		~DerivedDataCache() = default;
+
+		// 64Ʈ ؽ (  ؽ  .)
+		static uint64_t Hash(const void* data, uint64_t size, uint64_t seed = 0);
+
+		// Ű . ҽ   ߰ų ĳð  ִٸ 0
+		uint64_t ComputeKey(const std::string& source_path, uint64_t settings_hash, uint32_t importer_version);
+
+		// Ű شϴ Ļ ͸ . ų ϴ  ٲٸ false
+		bool Open(uint64_t key, const char* extension, AssetContainer* container);
+		//  ϴ ϵ ο  ؽø . (Store write ȣѴ.)
+		void AddDependencies(AssetContainerWriter& writer, const std::vector<std::string>& file_paths);
+		// Ļ ͸ .
+		// ӽ Ͽ   ڿ űǷ ٸ 峪 ߰  Ⱑ     ʴ´.
+		bool Store(uint64_t key, const char* extension, const std::function<void(AssetContainerWriter&)>& write);
+
+		// Ʈ 丮 Ʒ ĳ 丮
+		std::string GetDirectory() const;
+
+		inline void SetEnabled(bool enabled) { m_Enabled = enabled; }
+		inline bool IsEnabled() const { return m_Enabled; }
+
+		inline uint32_t GetHitCount() const { return m_HitCount; }
+		inline uint32_t GetMissCount() const { return m_MissCount; }
+
+	private:
+		std::string GetPath(uint64_t key, const char* extension) const;
+		//    ϵ ݵ   ȮѴ.
+		bool ValidateDependencies(const AssetContainer& container);
+		//   ؽ ( ǿ ũ  ð ٸ ٽ  ʴ´.)
+		uint64_t HashFile(const std::string& file_path);
+
+		struct sFileStamp
+		{
+			uint64_t size = 0;
+			int64_t write_time = 0;
+			uint64_t hash = 0;
+		};
+
+		Context* m_Context = nullptr;
+		bool m_Enabled = true;
+
+		std::unordered_map<std::string, sFileStamp> m_mapFileHashes;
+		std::mutex m_Mutex;
+
+		std::atomic<uint32_t> m_HitCount = 0;
+		std::atomic<uint32_t> m_MissCount = 0;
+	};
+}
@@ -36,7 +36,7 @@ namespace PlayGround
         // ҽ  θ Ѵ.
         void SetResourceFilePath(const std::string& path)
         {
-            const bool is_native_file = FileSystem::IsEngineMaterialFile(path) || FileSystem::IsEngineModelFile(path);
+            const bool is_native_file = FileSystem::IsEngineMaterialFile(path) || FileSystem::IsEngineModelFile(path) || FileSystem::IsEngineAnimationFile(path);
             
             //   ü   üũ  ʴ´.
             if (!is_native_file)
@@ -89,12 +89,42 @@ namespace PlayGround
         // IResource  ޼
         virtual bool LoadFromFile(const std::string& file_path) { return true; }
 
+        // GPU ø   ̻ ʿ  CPU  ͸ ϰ  Ʈ  ȯѴ.
+        virtual uint64_t ReleaseCpuData() { return 0; }
+
+        // ҽ ĳÿ  ȸ  (޸  Ѿ   ͺ .)
+        inline void SetLastUsedFrame(uint64_t frame) { m_LastUsedFrame.store(frame, std::memory_order_relaxed); }
+        inline uint64_t GetLastUsedFrame() const { return m_LastUsedFrame.load(std::memory_order_relaxed); }
+
+        //  ͷ  ִ ( 𵨰 , ִϸ )     Ƿ
+        //  ִ  ؼ ޸    ʰ Ѵ.
+        inline void Pin() { m_PinCount.fetch_add(1, std::memory_order_relaxed); }
+        inline void Unpin() { m_PinCount.fetch_sub(1, std::memory_order_relaxed); }
+        inline bool IsPinned() const { return m_PinCount.load(std::memory_order_relaxed) != 0; }
+
+        //  ͸ ٲٸ鼭  ҽ ϰ ִ ҽ  Ǭ.
+        template <typename T>
+        static void Repin(T*& holder, T* resource)
+        {
+            if (holder == resource)
+                return;
+
+            if (resource)
+                resource->Pin();
+            if (holder)
+                holder->Unpin();
+
+            holder = resource;
+        }
+
         template <typename T>
         static constexpr EResourceType TypeToEnum();
 
     protected:
         EResourceType m_ResourceType = EResourceType::Unknown;
         std::atomic<bool> m_IsLoading = false;
+        std::atomic<uint64_t> m_LastUsedFrame = 0;
+        std::atomic<uint32_t> m_PinCount = 0;
 
     private:
         std::string m_ResourceName;
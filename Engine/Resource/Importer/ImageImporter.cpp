@@ -5,11 +5,33 @@
 #include <Utilities.h>
 #include "../../Threading/Threading.h"
 #include "../../RHI/RHI_Texture2D.h"
+#include "../../IO/AssetContainer.h"
+#include "../ResourceCache.h"
+#include "../DerivedDataCache.h"
 
 using namespace std;
 
 namespace PlayGround
 {
+	// ȯ  ٲ ÷  Ļ ͸  ʵ Ѵ.
+	static constexpr uint32_t IMAGE_IMPORTER_VERSION = 1;
+
+	// Ļ  ûũ
+	static constexpr uint32_t IMAGE_CHUNK_INFO = AssetChunkId('I', 'N', 'F', 'O');
+	static constexpr uint32_t IMAGE_CHUNK_BITS = AssetChunkId('B', 'I', 'T', 'S');
+
+	// ȯ  ̹ 
+	struct sCachedImage
+	{
+		uint32_t width = 0;
+		uint32_t height = 0;
+		uint32_t channel_count = 0;
+		uint32_t bits_per_channel = 0;
+		uint32_t format = 0;
+		// ̹ ˾Ƴ ؽ ÷ (, ׷ , sRGB)
+		uint32_t flags = 0;
+	};
+
 	static bool get_is_srgb(FIBITMAP* bitmap)
 	{
 		if (FIICCPROFILE* icc_profile = FreeImage_GetICCProfile(bitmap))
@@ -318,6 +340,20 @@ namespace PlayGround
 			return false;
 		}
 
+		//   ũ ȯ  ִٸ FreeImage ġ ʴ´.
+		DerivedDataCache* derived_data_cache = m_Context->GetSubModule<ResourceCache>()->GetDerivedDataCache();
+		uint64_t derived_data_key = 0;
+		{
+			const uint32_t settings[2] = { texture->GetWidth(), texture->GetHeight() };
+			uint64_t settings_hash = DerivedDataCache::Hash(settings, sizeof(settings));
+			settings_hash = DerivedDataCache::Hash(FreeImage_GetVersion(), strlen(FreeImage_GetVersion()), settings_hash);
+
+			derived_data_key = derived_data_cache->ComputeKey(file_path, settings_hash, IMAGE_IMPORTER_VERSION);
+		}
+
+		if (LoadCached(derived_data_key, slice_index, texture))
+			return true;
+
 		// ̹  ´.
 		FREE_IMAGE_FORMAT format = FIF_UNKNOWN;
 		{
@@ -395,6 +431,55 @@ namespace PlayGround
 			texture->SetFlags(flags);
 		}
 
+		// ȯ  Ѵ.
+		{
+			sCachedImage info;
+			info.width = width;
+			info.height = height;
+			info.channel_count = channel_count;
+			info.bits_per_channel = bits_per_channel;
+			info.format = static_cast<uint32_t>(image_format);
+			info.flags = texture->GetFlags() & (RHI_Texture_Transparent | RHI_Texture_Grayscale | RHI_Texture_Srgb);
+
+			derived_data_cache->Store(derived_data_key, EXTENSION_TEXTURE, [&info, &mip](AssetContainerWriter& writer)
+			{
+				writer.AddChunk(IMAGE_CHUNK_INFO, &info, sizeof(info));
+				writer.AddChunk(IMAGE_CHUNK_BITS, mip.bytes);
+			});
+		}
+
+		return true;
+	}
+
+	bool ImageImporter::LoadCached(uint64_t key, const uint32_t slice_index, RHI_Texture* texture)
+	{
+		AssetContainer container;
+		if (!m_Context->GetSubModule<ResourceCache>()->GetDerivedDataCache()->Open(key, EXTENSION_TEXTURE, &container))
+			return false;
+
+		uint64_t info_count = 0;
+		uint64_t byte_count = 0;
+		const sCachedImage* info = container.GetChunkData<sCachedImage>(IMAGE_CHUNK_INFO, &info_count);
+		const std::byte* bytes = container.GetChunkData<std::byte>(IMAGE_CHUNK_BITS, &byte_count);
+
+		if (!info || info_count != 1 || !bytes)
+			return false;
+
+		// ũⰡ  ʴ´ٸ ٽ ƮѴ.
+		const uint64_t expected_size = static_cast<uint64_t>(info->width) * info->height * info->channel_count * (info->bits_per_channel / 8);
+		if (expected_size == 0 || expected_size != byte_count)
+			return false;
+
+		RHI_Texture_Mip& mip = texture->CreateMip(slice_index);
+		mip.bytes.assign(bytes, bytes + byte_count);
+
+		texture->SetBitsPerChannel(info->bits_per_channel);
+		texture->SetWidth(info->width);
+		texture->SetHeight(info->height);
+		texture->SetChannelCount(info->channel_count);
+		texture->SetFormat(static_cast<RHI_Format>(info->format));
+		texture->SetFlags(texture->GetFlags() | info->flags);
+
 		return true;
 	}
 }
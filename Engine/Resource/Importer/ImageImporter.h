@@ -20,6 +20,9 @@ namespace PlayGround
 		bool Load(const std::string& file_path, const uint32_t slice_index, RHI_Texture* texture);
 
 	private:
+		// Ļ  ĳÿ ȯ ̹ ִٸ ؽĿ ä.
+		bool LoadCached(uint64_t key, const uint32_t slice_index, RHI_Texture* texture);
+
 		Context* m_Context = nullptr;
 	};
 }
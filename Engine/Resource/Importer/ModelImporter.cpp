@@ -2,14 +2,21 @@
 #include "ModelImporter.h"
 #include "../ProgressTracker.h"
 #include "../../RHI/RHI_Vertex.h"
-#include "../../RHI/RHI_Texture.h"
+#include "../../RHI/RHI_Texture2D.h"
 #include "../../Rendering/Model.h"
+#include "../../Rendering/Mesh.h"
+#include "../../Rendering/MeshOptimizer.h"
 #include "../../Rendering/Animation.h"
 #include "../../World/World.h"
 #include "../../World/Entity.h"
 #include "../../World/Components/Renderable.h"
 #include "../../World/Components/Transform.h"
+#include "../../World/Components/Animator.h"
 #include "../../Core/Settings.h"
+#include "../../Threading/Threading.h"
+#include "../../IO/AssetContainer.h"
+#include "../ResourceCache.h"
+#include "../DerivedDataCache.h"
 
 #include "assimp/color4.h"
 #include "assimp/matrix4x4.h"
@@ -19,6 +26,7 @@
 #include "assimp/ProgressHandler.hpp"
 #include "assimp/version.h"
 #include "assimp/Importer.hpp"
+#include "assimp/DefaultIOSystem.h"
 #include "assimp/postprocess.h"
 
 using namespace std;
@@ -27,6 +35,44 @@ using namespace Assimp;
 
 namespace PlayGround
 {
+    // Ʈ  ٲ ÷  Ļ ͸  ʵ Ѵ.
+    static constexpr uint32_t MODEL_IMPORTER_VERSION = 4;
+
+    // Ļ  ûũ
+    static constexpr uint32_t MODEL_CHUNK_INDICES = AssetChunkId('I', 'N', 'D', 'X');
+    static constexpr uint32_t MODEL_CHUNK_VERTICES = AssetChunkId('V', 'E', 'R', 'T');
+    static constexpr uint32_t MODEL_CHUNK_NODES = AssetChunkId('N', 'O', 'D', 'E');
+    static constexpr uint32_t MODEL_CHUNK_MESHES = AssetChunkId('M', 'E', 'S', 'H');
+    static constexpr uint32_t MODEL_CHUNK_STRINGS = AssetChunkId('S', 'T', 'R', 'S');
+    static constexpr uint32_t MODEL_CHUNK_LODS = AssetChunkId('L', 'O', 'D', 'S');
+
+    // ƼƼ ϳ (θ ׻ ڽĺ տ ´.)
+    struct sCachedNode
+    {
+        int32_t parent = -1;
+        int32_t mesh = -1;
+        uint32_t name_offset = 0;
+        uint32_t name_length = 0;
+        uint32_t active = 1;
+        float position[3] = {};
+        float rotation[4] = {};
+        float scale[3] = {};
+    };
+
+    // ƼƼ 
+    struct sCachedMesh
+    {
+        uint32_t index_offset = 0;
+        uint32_t index_count = 0;
+        uint32_t vertex_offset = 0;
+        uint32_t vertex_count = 0;
+        float aabb_min[3] = {};
+        float aabb_max[3] = {};
+        // ׸ ü   (̰ 0̸ )
+        uint32_t material_offset = 0;
+        uint32_t material_length = 0;
+    };
+
     // Assimp matrix -> Matrix
 	static Matrix convert_matrix(const aiMatrix4x4& transform)
 	{
@@ -146,6 +192,25 @@ namespace PlayGround
         string m_FileName;
     };
 
+    // Assimp   Ѵ. (.mtl, .binó ҽ ϴ  Ļ   Ϸ .)
+    class AssimpRecordingIOSystem : public DefaultIOSystem
+    {
+    public:
+        AssimpRecordingIOSystem(vector<string>* opened_files) : m_OpenedFiles(opened_files) {}
+
+        IOStream* Open(const char* file, const char* mode = "rb") override
+        {
+            IOStream* stream = DefaultIOSystem::Open(file, mode);
+            if (stream && find(m_OpenedFiles->begin(), m_OpenedFiles->end(), file) == m_OpenedFiles->end())
+                m_OpenedFiles->emplace_back(file);
+
+            return stream;
+        }
+
+    private:
+        vector<string>* m_OpenedFiles;
+    };
+
     //   Ȯڷ ؽ ҷ⸦ õѴ.
     static string texture_try_multiple_extensions(const string& file_path)
     {
@@ -204,31 +269,95 @@ namespace PlayGround
         return "";
     }
 
-    // ׸ ؽĸ ҷ´.
-    static bool load_material_texture(const sModelParams& params, shared_ptr<Material> material, const aiMaterial* material_assimp, const Material_Property texture_type, const aiTextureType texture_type_assimp_pbr, const aiTextureType texture_type_assimp_legacy)
+    // ۾ 忡 ȯ ޽
+    struct sImportedMesh
+    {
+        std::vector<RHI_Vertex_PosTexNorTan> vertices;
+        std::vector<uint32_t> indices;
+        // LOD 1 ε (  ؽ .)
+        std::vector<std::vector<uint32_t>> lods;
+        BoundingBox aabb;
+        // ޽  -> ̷  (۾  ä.)
+        std::vector<uint16_t> bones;
+        //  ִ ޽ ؽ ġ (ؽ  )
+        std::vector<sSkinWeight> skin_weights;
+    };
+
+    // ׸ Ӽ  Ӽ ã Assimp ؽ Ÿ (PBR, Ž)
+    struct sMaterialTextureSlot
+    {
+        Material_Property type;
+        aiTextureType type_assimp_pbr;
+        aiTextureType type_assimp_legacy;
+    };
+
+    static const sMaterialTextureSlot material_texture_slots[] =
+    {
+        { Material_Color,     aiTextureType_BASE_COLOR,        aiTextureType_DIFFUSE   },
+        { Material_Roughness, aiTextureType_DIFFUSE_ROUGHNESS, aiTextureType_SHININESS }, // Use specular as fallback
+        { Material_Metallic,  aiTextureType_METALNESS,         aiTextureType_AMBIENT   }, // Use ambient as fallback
+        { Material_Normal,    aiTextureType_NORMAL_CAMERA,     aiTextureType_NORMALS   },
+        { Material_Occlusion, aiTextureType_AMBIENT_OCCLUSION, aiTextureType_LIGHTMAP  },
+        { Material_Emission,  aiTextureType_EMISSION_COLOR,    aiTextureType_EMISSIVE  },
+        { Material_Height,    aiTextureType_HEIGHT,            aiTextureType_NONE      },
+        { Material_AlphaMask, aiTextureType_OPACITY,           aiTextureType_NONE      }
+    };
+
+    // ׸  ϴ ؽ θ ã´. (ų  ʴ ̶  ڿ)
+    static string get_material_texture_path(const sModelParams& params, const aiMaterial* material_assimp, const sMaterialTextureSlot& slot, aiTextureType* type)
     {
         aiTextureType type_assimp = aiTextureType_NONE;
         // ؽİ ϳ ϴ
-        type_assimp = material_assimp->GetTextureCount(texture_type_assimp_pbr) > 0 ? texture_type_assimp_pbr : type_assimp;
+        type_assimp = material_assimp->GetTextureCount(slot.type_assimp_pbr) > 0 ? slot.type_assimp_pbr : type_assimp;
         //  ؽ Ÿ NONE̶ Žø ȮѴ.
-        type_assimp = (type_assimp == aiTextureType_NONE) ? (material_assimp->GetTextureCount(texture_type_assimp_legacy) > 0 ? texture_type_assimp_legacy : type_assimp) : type_assimp;
+        type_assimp = (type_assimp == aiTextureType_NONE) ? (material_assimp->GetTextureCount(slot.type_assimp_legacy) > 0 ? slot.type_assimp_legacy : type_assimp) : type_assimp;
+        *type = type_assimp;
 
         // ؽó   0 ׳ ȯ
         if (material_assimp->GetTextureCount(type_assimp) == 0)
-            return true;
+            return "";
 
         // ؽĸ ҷ´.
         aiString texture_path;
         if (material_assimp->GetTexture(type_assimp, 0, &texture_path) != AI_SUCCESS)
-            return false;
+            return "";
 
         //     ƴ϶ ȯ
         const string deduced_path = texture_validate_path(texture_path.data, params.file_path);
         if (!FileSystem::IsSupportedImageFile(deduced_path))
-            return false;
+            return "";
 
-        // 𵨿 ؽ ߰
-        params.model->AddTexture(material, texture_type, texture_validate_path(texture_path.data, params.file_path));
+        return deduced_path;
+    }
+
+    // ׸ ؽĸ ҷ´.
+    static bool load_material_texture(const sModelParams& params, shared_ptr<Material> material, const aiMaterial* material_assimp, const sMaterialTextureSlot& slot)
+    {
+        const Material_Property texture_type = slot.type;
+
+        aiTextureType type_assimp = aiTextureType_NONE;
+        const string deduced_path = get_material_texture_path(params, material_assimp, slot, &type_assimp);
+        if (deduced_path.empty())
+            return type_assimp == aiTextureType_NONE || material_assimp->GetTextureCount(type_assimp) == 0;
+
+        // ۾ 忡 ̸ ҷԴٸ  ؽĸ .
+        shared_ptr<RHI_Texture> texture_preloaded;
+        if (params.textures)
+        {
+            const auto it = params.textures->find(deduced_path);
+            if (it != params.textures->end())
+                texture_preloaded = it->second;
+        }
+
+        if (texture_preloaded)
+        {
+            material->SetTextureSlot(texture_type, texture_preloaded);
+        }
+        else
+        {
+            // 𵨿 ؽ ߰
+            params.model->AddTexture(material, texture_type, deduced_path);
+        }
 
         // ؽ Ÿ BASE_COLOR Ǵ DIFFUSE 
         if(type_assimp == aiTextureType_BASE_COLOR || type_assimp == aiTextureType_DIFFUSE)
@@ -256,6 +385,192 @@ namespace PlayGround
         return true;
     }
 
+    // Assimp ޽   ε ȯѴ. (峪  ǵ帮 Ƿ ۾ 忡 Ѵ.)
+    static void convert_mesh(const aiMesh* assimp_mesh, sImportedMesh* mesh)
+    {
+        ASSERT(assimp_mesh != nullptr);
+
+        // ؽ, ε ī
+        const uint32_t vertex_count = assimp_mesh->mNumVertices;
+        const uint32_t index_count = assimp_mesh->mNumFaces * 3;
+
+        // ؽ ŭ  
+        vector<RHI_Vertex_PosTexNorTan>& vertices = mesh->vertices;
+        vertices.resize(vertex_count);
+        {
+            // ؽ ŭ ݺѴ.
+            for (uint32_t i = 0; i < vertex_count; i++)
+            {
+                RHI_Vertex_PosTexNorTan& vertex = vertices[i];
+
+                // ġ
+                const aiVector3D& pos = assimp_mesh->mVertices[i];
+                vertex.pos[0] = pos.x;
+                vertex.pos[1] = pos.y;
+                vertex.pos[2] = pos.z;
+
+
+                // 븻
+                if (assimp_mesh->mNormals)
+                {
+                    const aiVector3D& normal = assimp_mesh->mNormals[i];
+                    vertex.nor[0] = normal.x;
+                    vertex.nor[1] = normal.y;
+                    vertex.nor[2] = normal.z;
+                }
+
+                // źƮ
+                if (assimp_mesh->mTangents)
+                {
+                    const aiVector3D& tangent = assimp_mesh->mTangents[i];
+                    vertex.tan[0] = tangent.x;
+                    vertex.tan[1] = tangent.y;
+                    vertex.tan[2] = tangent.z;
+                }
+
+                // UV ǥ
+                const uint32_t uv_channel = 0;
+                if (assimp_mesh->HasTextureCoords(uv_channel))
+                {
+                    const auto& tex_coords = assimp_mesh->mTextureCoords[uv_channel][i];
+                    vertex.tex[0] = tex_coords.x;
+                    vertex.tex[1] = tex_coords.y;
+                }
+            }
+        }
+
+        // ε ߰
+        vector<uint32_t>& indices = mesh->indices;
+        indices.resize(index_count);
+        {
+            //  ŭ ݺѴ.
+            for (uint32_t face_index = 0; face_index < assimp_mesh->mNumFaces; face_index++)
+            {
+                const aiFace& face = assimp_mesh->mFaces[face_index];
+                // ּ  ﰢ̴  3 ش.
+                const uint32_t indices_index = (face_index * 3);
+                indices[indices_index + 0] = face.mIndices[0];
+                indices[indices_index + 1] = face.mIndices[1];
+                indices[indices_index + 2] = face.mIndices[2];
+            }
+        }
+
+        // ٿ ڽ 
+        mesh->aabb = BoundingBox(vertices.data(), static_cast<uint32_t>(vertices.size()));
+    }
+
+    //  ؽ ġ ؽ ġ ٲ۴. (LimitBoneWeights ؽ 4 ϴ.)
+    static void convert_skin_weights(const aiMesh* assimp_mesh, sImportedMesh* mesh)
+    {
+        if (!assimp_mesh->HasBones() || mesh->bones.size() != assimp_mesh->mNumBones)
+            return;
+
+        vector<sSkinWeight>& skin_weights = mesh->skin_weights;
+        skin_weights.assign(assimp_mesh->mNumVertices, sSkinWeight());
+
+        for (uint32_t bone_index = 0; bone_index < assimp_mesh->mNumBones; bone_index++)
+        {
+            const aiBone* bone = assimp_mesh->mBones[bone_index];
+
+            for (uint32_t i = 0; i < bone->mNumWeights; i++)
+            {
+                const aiVertexWeight& weight = bone->mWeights[i];
+                if (weight.mVertexId >= skin_weights.size() || weight.mWeight <= 0.0f)
+                    continue;
+
+                //   ġ ڸ ä.
+                sSkinWeight& skin_weight = skin_weights[weight.mVertexId];
+                uint32_t slot = 0;
+                for (uint32_t k = 1; k < 4; k++)
+                {
+                    if (skin_weight.weights[k] < skin_weight.weights[slot])
+                    {
+                        slot = k;
+                    }
+                }
+
+                if (weight.mWeight > skin_weight.weights[slot])
+                {
+                    skin_weight.bones[slot] = mesh->bones[bone_index];
+                    skin_weight.weights[slot] = weight.mWeight;
+                }
+            }
+        }
+
+        //  1 ǵ ȭѴ.
+        for (sSkinWeight& skin_weight : skin_weights)
+        {
+            const float sum = skin_weight.weights[0] + skin_weight.weights[1] + skin_weight.weights[2] + skin_weight.weights[3];
+            if (sum <= 0.0f)
+                continue;
+
+            for (float& weight : skin_weight.weights)
+            {
+                weight /= sum;
+            }
+        }
+    }
+
+    // ؽ ĳ, ο  ﰢ ϰ LOD   ؽ ġ  ؽ ٽ ġѴ.
+    static void optimize_mesh(const sModelParams& params, sImportedMesh* mesh)
+    {
+        vector<uint32_t>& indices = mesh->indices;
+        vector<RHI_Vertex_PosTexNorTan>& vertices = mesh->vertices;
+
+        if (indices.empty() || vertices.empty())
+            return;
+
+        const uint32_t vertex_count = static_cast<uint32_t>(vertices.size());
+
+        MeshOptimizer::OptimizeVertexCache(indices, vertex_count);
+        MeshOptimizer::OptimizeOverdraw(indices, vertices);
+
+        //  LOD  ʵ Ź  δ.
+        mesh->lods.clear();
+        if (indices.size() / 3 >= params.lod_min_triangles)
+        {
+            float ratio = 1.0f;
+
+            for (uint32_t i = 1; i < params.lod_count; i++)
+            {
+                ratio *= params.lod_reduction;
+
+                const uint32_t target_index_count = static_cast<uint32_t>(indices.size() * ratio) / 3 * 3;
+                const size_t previous_index_count = mesh->lods.empty() ? indices.size() : mesh->lods.back().size();
+
+                vector<uint32_t> lod = MeshOptimizer::Simplify(indices, vertices, target_index_count, params.lod_target_error * static_cast<float>(i));
+
+                //   Ѱ    ʾҴٸ   ׸  .
+                if (lod.empty() || lod.size() * 10 > previous_index_count * 9)
+                    break;
+
+                MeshOptimizer::OptimizeVertexCache(lod, vertex_count);
+                mesh->lods.emplace_back(move(lod));
+            }
+        }
+
+        // Ų ġ ؽ   ű.
+        vector<uint32_t> remap;
+        MeshOptimizer::OptimizeVertexFetch(indices, vertices, &mesh->lods, mesh->skin_weights.empty() ? nullptr : &remap);
+
+        if (!mesh->skin_weights.empty())
+        {
+            vector<sSkinWeight> skin_weights(vertices.size());
+            for (uint32_t i = 0; i < static_cast<uint32_t>(remap.size()); i++)
+            {
+                if (remap[i] != UINT32_MAX)
+                {
+                    skin_weights[remap[i]] = mesh->skin_weights[i];
+                }
+            }
+
+            mesh->skin_weights.swap(skin_weights);
+        }
+
+        //  ʴ ؽ   ִ.
+        mesh->aabb = BoundingBox(vertices.data(), static_cast<uint32_t>(vertices.size()));
+    }
+
     // ׸ ҷ´.
     static shared_ptr<Material> load_material(Context* context, const aiMaterial* material_assimp, const sModelParams& params)
     {
@@ -284,14 +599,10 @@ namespace PlayGround
 
 
         // ٸ ؽĵ ҷ´.
-        load_material_texture(params, material, material_assimp, Material_Color, aiTextureType_BASE_COLOR, aiTextureType_DIFFUSE);
-        load_material_texture(params, material, material_assimp, Material_Roughness, aiTextureType_DIFFUSE_ROUGHNESS, aiTextureType_SHININESS); // Use specular as fallback
-        load_material_texture(params, material, material_assimp, Material_Metallic, aiTextureType_METALNESS, aiTextureType_AMBIENT);   // Use ambient as fallback
-        load_material_texture(params, material, material_assimp, Material_Normal, aiTextureType_NORMAL_CAMERA, aiTextureType_NORMALS);
-        load_material_texture(params, material, material_assimp, Material_Occlusion, aiTextureType_AMBIENT_OCCLUSION, aiTextureType_LIGHTMAP);
-        load_material_texture(params, material, material_assimp, Material_Emission, aiTextureType_EMISSION_COLOR, aiTextureType_EMISSIVE);
-        load_material_texture(params, material, material_assimp, Material_Height, aiTextureType_HEIGHT, aiTextureType_NONE);
-        load_material_texture(params, material, material_assimp, Material_AlphaMask, aiTextureType_OPACITY, aiTextureType_NONE);
+        for (const sMaterialTextureSlot& slot : material_texture_slots)
+        {
+            load_material_texture(params, material, material_assimp, slot);
+        }
 
         return material;
     }
@@ -329,7 +640,58 @@ namespace PlayGround
         params.file_path = file_path;
         params.name = FileSystem::GetFileNameWithoutExtensionFromFilePath(file_path);
         params.model = model;
+        params.lod_count = 4;
+        params.lod_reduction = 0.5f;
+        params.lod_screen_size = 0.5f;
+        params.lod_min_triangles = 256;
+        params.lod_target_error = 0.01f;
 
+        // ĳ ȭ LOD  ϵ  ޽ ȭ Ѵ.
+        const auto importer_flags =
+            aiProcess_MakeLeftHanded |           // ̷Ʈ X ޼ǥ  ǥ ȯش.
+            aiProcess_FlipUVs |                  // ̷Ʈ X UV 
+            aiProcess_FlipWindingOrder |         // ̷Ʈ X  
+            aiProcess_CalcTangentSpace |
+            aiProcess_GenSmoothNormals |
+            aiProcess_GenUVCoords |
+            aiProcess_JoinIdenticalVertices |
+            aiProcess_LimitBoneWeights |
+            aiProcess_Triangulate |
+            aiProcess_SortByPType |              // ޽ ﰢ ɰ.
+            aiProcess_FindDegenerates |          // 
+            aiProcess_FindInvalidData |
+            aiProcess_FindInstances |
+            aiProcess_ValidateDataStructure;
+
+        // ҽ , Ʈ , Assimp  ٸ ó ٽ  ʴ´.
+        DerivedDataCache* derived_data_cache = m_Context->GetSubModule<ResourceCache>()->GetDerivedDataCache();
+        uint64_t derived_data_key = 0;
+        {
+            const uint32_t settings[] =
+            {
+                params.triangle_limit,
+                params.vertex_limit,
+                static_cast<uint32_t>(params.max_normal_smoothing_angle * 1000.0f),
+                static_cast<uint32_t>(params.max_tangent_smoothing_angle * 1000.0f),
+                static_cast<uint32_t>(importer_flags),
+                params.lod_count,
+                static_cast<uint32_t>(params.lod_reduction * 1000.0f),
+                static_cast<uint32_t>(params.lod_screen_size * 1000.0f),
+                params.lod_min_triangles,
+                static_cast<uint32_t>(params.lod_target_error * 100000.0f),
+                aiGetVersionMajor(),
+                aiGetVersionMinor(),
+                aiGetVersionRevision()
+            };
+
+            derived_data_key = derived_data_cache->ComputeKey(file_path, DerivedDataCache::Hash(settings, sizeof(settings)), MODEL_IMPORTER_VERSION);
+        }
+
+        if (LoadCached(derived_data_key, params))
+        {
+            LOG_INFO("\"%s\" was loaded from the derived data cache", FileSystem::GetFileNameFromFilePath(file_path).c_str());
+            return true;
+        }
 
         // Assimp   
         Importer importer;
@@ -348,23 +710,9 @@ namespace PlayGround
         // ൵  
         importer.SetPropertyBool(AI_CONFIG_GLOB_MEASURE_TIME, true);
         importer.SetProgressHandler(new AssimpProgress(file_path));
-
-        const auto importer_flags =
-            aiProcess_MakeLeftHanded |           // ̷Ʈ X ޼ǥ  ǥ ȯش.
-            aiProcess_FlipUVs |                  // ̷Ʈ X UV 
-            aiProcess_FlipWindingOrder |         // ̷Ʈ X  
-            aiProcess_CalcTangentSpace |
-            aiProcess_GenSmoothNormals |
-            aiProcess_GenUVCoords |
-            aiProcess_JoinIdenticalVertices |
-            aiProcess_ImproveCacheLocality |     // ﰢ ġؼ ĳ Ʈ δ.
-            aiProcess_LimitBoneWeights |
-            aiProcess_Triangulate |
-            aiProcess_SortByPType |              // ޽ ﰢ ɰ.
-            aiProcess_FindDegenerates |          // 
-            aiProcess_FindInvalidData |
-            aiProcess_FindInstances |
-            aiProcess_ValidateDataStructure;
+        // Ļ Ͱ ҽ   Ͽ ϴ Ѵ.
+        vector<string> opened_files;
+        importer.SetIOHandler(new AssimpRecordingIOSystem(&opened_files));
 
         //  ҷ´.
         const aiScene* scene = importer.ReadFile(file_path, importer_flags);
@@ -381,6 +729,14 @@ namespace PlayGround
             params.scene = scene;
             params.has_animation = scene->mNumAnimations != 0;
 
+            // ޽ ȯ ؽ Ʈ  ̹Ƿ ۾ 忡  д.
+            vector<sImportedMesh> meshes;
+            unordered_map<string, shared_ptr<RHI_Texture>> textures;
+            ImportParallel(params, &meshes, &textures);
+            params.meshes = &meshes;
+            params.textures = &textures;
+
+            // ƼƼ  带 ǵ帮Ƿ  忡 .
             const bool is_active = false;
             shared_ptr<Entity> new_entity = m_World->EntityCreate(is_active);
             new_entity->SetName(params.name);
@@ -389,11 +745,30 @@ namespace PlayGround
             //  Ľ
             ParseNode(scene->mRootNode, params, nullptr, new_entity.get());
 
+            // Ʈ Ʈ
+            model->UpdateGeometry();
+
             // ִϸ̼ Ľ
             ParseAnimations(params);
 
-            // Ʈ Ʈ
-            model->UpdateGeometry();
+            //  Ʈ ʵ  Ѵ.
+            // ̷ Ŭ Ļ Ϳ  Ƿ ִϸ̼  Ź ƮѴ.
+            if (!model->IsAnimated())
+            {
+                vector<string> dependencies;
+                for (const string& opened_file : opened_files)
+                {
+                    if (opened_file != file_path)
+                        dependencies.emplace_back(opened_file);
+                }
+
+                for (const auto& [texture_path, texture] : textures)
+                {
+                    dependencies.emplace_back(texture_path);
+                }
+
+                SaveCached(derived_data_key, params, dependencies);
+            }
         }
         else
         {
@@ -466,7 +841,7 @@ namespace PlayGround
             // ޽ ̸ ϰ ޽  εѴ.
             entity->SetName(_name);
 
-            LoadMesh(assimp_mesh, entity, params);
+            LoadMesh(assimp_node->mMeshes[i], entity, params);
             //  
             entity->SetActive(true);
         }
@@ -474,6 +849,14 @@ namespace PlayGround
 
     void ModelImporter::ParseAnimations(const sModelParams& params)
     {
+        shared_ptr<Entity> root = params.model->GetRootEntity();
+        if (!root || (params.scene->mNumAnimations == 0 && !params.model->HasSkin()))
+            return;
+
+        // Ŭ  Ʈ ִ ִϸͰ Ѵ.
+        Animator* animator = root->AddComponent<Animator>();
+        ResourceCache* resource_cache = m_Context->GetSubModule<ResourceCache>();
+
         //  ִϸ̼ ȸѴ.
         for (uint32_t i = 0; i < params.scene->mNumAnimations; i++)
         {
@@ -482,7 +865,9 @@ namespace PlayGround
             auto animation = make_shared<Animation>(m_Context);
 
             // ִϸ̼ ̸, ð, ƽ ð ´.
-            animation->SetName(assimp_animation->mName.C_Str());
+            // ̸  Ŭ ϹǷ  ̸  Ѵ.
+            const string name = assimp_animation->mName.C_Str();
+            animation->SetName(!name.empty() ? name : params.name + "_" + to_string(i));
             animation->SetDuration(assimp_animation->mDuration);
             animation->SetTicksPerSec(assimp_animation->mTicksPerSecond != 0.0f ? assimp_animation->mTicksPerSecond : 25.0f);
 
@@ -496,6 +881,7 @@ namespace PlayGround
                 animation_node.name = assimp_node_anim->mNodeName.C_Str();
 
                 // ġ Ű ҷ´.
+                animation_node.positionFrames.reserve(assimp_node_anim->mNumPositionKeys);
                 for (uint32_t k = 0; k < static_cast<uint32_t>(assimp_node_anim->mNumPositionKeys); k++)
                 {
                     // ð
@@ -508,100 +894,132 @@ namespace PlayGround
                 }
 
                 // ȸ Ű ҷ´.
+                animation_node.rotationFrames.reserve(assimp_node_anim->mNumRotationKeys);
                 for (uint32_t k = 0; k < static_cast<uint32_t>(assimp_node_anim->mNumRotationKeys); k++)
                 {
-                    const auto time = assimp_node_anim->mPositionKeys[k].mTime;
+                    const auto time = assimp_node_anim->mRotationKeys[k].mTime;
                     const auto value = convert_quaternion(assimp_node_anim->mRotationKeys[k].mValue);
 
                     animation_node.rotationFrames.emplace_back(KeyQuaternion{ time, value });
                 }
 
                 // ϸ Ű ҷ´.
+                animation_node.scaleFrames.reserve(assimp_node_anim->mNumScalingKeys);
                 for (uint32_t k = 0; k < static_cast<uint32_t>(assimp_node_anim->mNumScalingKeys); k++)
                 {
-                    const auto time = assimp_node_anim->mPositionKeys[k].mTime;
+                    const auto time = assimp_node_anim->mScalingKeys[k].mTime;
                     const auto value = convert_vector3(assimp_node_anim->mScalingKeys[k].mValue);
 
                     animation_node.scaleFrames.emplace_back(KeyVector{ time, value });
                 }
+
+                animation->AddChannel(move(animation_node));
             }
+
+            // Ű ̰ ȭ    Ŭ Ϸ Ѵ.
+            // ٸ   ̸ Ŭ ġ ʵ  ̸  ̸ δ.
+            animation->Compress();
+            animation->SetResourceFilePath(FileSystem::RemoveIllegalCharacters(FileSystem::GetDirectoryFromFilePath(params.file_path) + params.name + "_" + animation->GetName() + EXTENSION_ANIMATION));
+
+            const shared_ptr<Animation> cached = resource_cache->Cache(animation);
+            animator->AddClip(cached ? cached : animation);
+        }
+
+        // ù Ŭ ٷ Ѵ.
+        if (!animator->GetClips().empty())
+        {
+            animator->Play(animator->GetClips().front()->GetName());
         }
     }
 
-    void ModelImporter::LoadMesh(aiMesh* assimp_mesh, Entity* entity_parent, const sModelParams& params)
+    void ModelImporter::ImportParallel(const sModelParams& params, vector<sImportedMesh>* meshes, unordered_map<string, shared_ptr<RHI_Texture>>* textures)
     {
-        ASSERT(assimp_mesh != nullptr);
-        ASSERT(entity_parent != nullptr);
+        const aiScene* scene = params.scene;
+        ResourceCache* resource_cache = m_Context->GetSubModule<ResourceCache>();
 
-        // ؽ, ε ī
-        const uint32_t vertex_count = assimp_mesh->mNumVertices;
-        const uint32_t index_count = assimp_mesh->mNumFaces * 3;
-
-        // ؽ ŭ  
-        vector<RHI_Vertex_PosTexNorTan> vertices = vector<RHI_Vertex_PosTexNorTan>(vertex_count);
+        // ׸ ϴ ؽ θ ߺ  .
+        vector<string> texture_paths;
+        for (uint32_t i = 0; i < scene->mNumMaterials; i++)
         {
-            // ؽ ŭ ݺѴ.
-            for (uint32_t i = 0; i < vertex_count; i++)
+            for (const sMaterialTextureSlot& slot : material_texture_slots)
             {
-                RHI_Vertex_PosTexNorTan& vertex = vertices[i];
+                aiTextureType type_assimp = aiTextureType_NONE;
+                const string path = get_material_texture_path(params, scene->mMaterials[i], slot, &type_assimp);
 
-                // ġ
-                const aiVector3D& pos = assimp_mesh->mVertices[i];
-                vertex.pos[0] = pos.x;
-                vertex.pos[1] = pos.y;
-                vertex.pos[2] = pos.z;
-
-
-                // 븻
-                if (assimp_mesh->mNormals)
+                if (!path.empty() && textures->emplace(path, nullptr).second)
                 {
-                    const aiVector3D& normal = assimp_mesh->mNormals[i];
-                    vertex.nor[0] = normal.x;
-                    vertex.nor[1] = normal.y;
-                    vertex.nor[2] = normal.z;
+                    texture_paths.emplace_back(path);
                 }
+            }
+        }
 
-                // źƮ
-                if (assimp_mesh->mTangents)
+        meshes->resize(scene->mNumMeshes);
+        vector<shared_ptr<RHI_Texture>> loaded_textures(texture_paths.size());
+
+        // ̷  ǵ帮Ƿ ۾   忡 .
+        LoadSkeleton(params, meshes);
+
+        const uint32_t mesh_count = scene->mNumMeshes;
+        const uint32_t job_count = mesh_count + static_cast<uint32_t>(texture_paths.size());
+
+        // ޽ ȯ ؽ Ʈ ϳ ۾  .
+        const auto import = [&](uint32_t start, uint32_t end)
+        {
+            for (uint32_t i = start; i < end; i++)
+            {
+                if (i < mesh_count)
                 {
-                    const aiVector3D& tangent = assimp_mesh->mTangents[i];
-                    vertex.tan[0] = tangent.x;
-                    vertex.tan[1] = tangent.y;
-                    vertex.tan[2] = tangent.z;
+                    convert_mesh(scene->mMeshes[i], &(*meshes)[i]);
+                    convert_skin_weights(scene->mMeshes[i], &(*meshes)[i]);
+                    optimize_mesh(params, &(*meshes)[i]);
+                    continue;
                 }
 
-                // UV ǥ
-                const uint32_t uv_channel = 0;
-                if (assimp_mesh->HasTextureCoords(uv_channel))
+                const string& path = texture_paths[i - mesh_count];
+
+                // ٸ  ̹ ҷ ؽĶ ٽ ҷ ʴ´.
+                shared_ptr<RHI_Texture> texture = resource_cache->GetByName<RHI_Texture2D>(FileSystem::GetFileNameWithoutExtensionFromFilePath(path));
+                if (!texture)
                 {
-                    const auto& tex_coords = assimp_mesh->mTextureCoords[uv_channel][i];
-                    vertex.tex[0] = tex_coords.x;
-                    vertex.tex[1] = tex_coords.y;
+                    texture = make_shared<RHI_Texture2D>(m_Context, RHI_Texture_Srv | RHI_Texture_Mips | RHI_Texture_PerMipViews | RHI_Texture_Compressed);
+                    if (!texture->LoadFromFile(path))
+                        texture = nullptr;
                 }
+
+                loaded_textures[i - mesh_count] = texture;
             }
-        }
+        };
 
-        // ε ߰
-        vector<uint32_t> indices = vector<uint32_t>(index_count);
+        // ޽ ϳ, ؽ ϳ ۾ ̰ ũǷ ϳ ش.
+        m_Context->GetSubModule<Threading>()->ParallelFor(0, job_count, 1, import);
+
+        for (uint32_t i = 0; i < static_cast<uint32_t>(texture_paths.size()); i++)
         {
-            //  ŭ ݺѴ.
-            for (uint32_t face_index = 0; face_index < assimp_mesh->mNumFaces; face_index++)
-            {
-                const aiFace& face = assimp_mesh->mFaces[face_index];
-                // ּ  ﰢ̴  3 ش.
-                const uint32_t indices_index = (face_index * 3);
-                indices[indices_index + 0] = face.mIndices[0];
-                indices[indices_index + 1] = face.mIndices[1];
-                indices[indices_index + 2] = face.mIndices[2];
-            }
+            (*textures)[texture_paths[i]] = loaded_textures[i];
         }
+    }
 
-        // ٿ ڽ 
-        const BoundingBox aabb = BoundingBox(vertices.data(), static_cast<uint32_t>(vertices.size()));
+    void ModelImporter::LoadMesh(uint32_t mesh_index, Entity* entity_parent, const sModelParams& params)
+    {
+        ASSERT(entity_parent != nullptr);
+
+        const aiMesh* assimp_mesh = params.scene->mMeshes[mesh_index];
+        const sImportedMesh& mesh = (*params.meshes)[mesh_index];
+        const vector<uint32_t>& indices = mesh.indices;
+        const vector<RHI_Vertex_PosTexNorTan>& vertices = mesh.vertices;
+        const BoundingBox& aabb = mesh.aabb;
 
         uint32_t index_offset;
         uint32_t vertex_offset;
-        params.model->AppendGeometry(move(indices), move(vertices), &index_offset, &vertex_offset);
+        params.model->AppendGeometry(indices, vertices, &index_offset, &vertex_offset);
+
+        //  Ʈ   LOD Ƿ  ߰Ѵ.
+        float screen_size = params.lod_screen_size;
+        for (const vector<uint32_t>& lod : mesh.lods)
+        {
+            params.model->AppendLod(index_offset, lod, screen_size);
+            screen_size *= 0.5f;
+        }
 
         Renderable* renderable = entity_parent->AddComponent<Renderable>();
 
@@ -625,10 +1043,288 @@ namespace PlayGround
         }
 
         // 
-        LoadBones(assimp_mesh, params);
+        LoadBones(mesh, vertex_offset, params);
+    }
+
+    void ModelImporter::LoadSkeleton(const sModelParams& params, vector<sImportedMesh>* meshes)
+    {
+        const aiScene* scene = params.scene;
+
+        bool has_bones = false;
+        for (uint32_t i = 0; i < scene->mNumMeshes; i++)
+        {
+            has_bones |= scene->mMeshes[i]->HasBones();
+        }
+
+        if (!has_bones && scene->mNumAnimations == 0)
+            return;
+
+        // ִϸ̼ ä     Ƿ  带  .
+        Skeleton& skeleton = params.model->GetSkeleton();
+        skeleton.Clear();
+
+        vector<pair<const aiNode*, int32_t>> stack = { { scene->mRootNode, -1 } };
+        while (!stack.empty())
+        {
+            const auto [node, parent] = stack.back();
+            stack.pop_back();
+
+            const int32_t joint = static_cast<int32_t>(skeleton.AddJoint(node->mName.C_Str(), parent, convert_matrix(node->mTransformation)));
+
+            for (uint32_t i = node->mNumChildren; i > 0; i--)
+            {
+                stack.emplace_back(node->mChildren[i - 1], joint);
+            }
+        }
+
+        // ޽  ̷  ٲд. (   ޽ Ѵ.)
+        for (uint32_t i = 0; i < scene->mNumMeshes; i++)
+        {
+            const aiMesh* assimp_mesh = scene->mMeshes[i];
+            vector<uint16_t>& bones = (*meshes)[i].bones;
+
+            for (uint32_t j = 0; j < assimp_mesh->mNumBones; j++)
+            {
+                const aiBone* assimp_bone = assimp_mesh->mBones[j];
+
+                const int32_t joint = skeleton.FindJoint(assimp_bone->mName.C_Str());
+                if (joint < 0)
+                {
+                    LOG_WARNING("Bone \"%s\" doesn't match any node", assimp_bone->mName.C_Str());
+                    bones.clear();
+                    break;
+                }
+
+                const uint32_t bone = skeleton.AddBone(static_cast<uint32_t>(joint), convert_matrix(assimp_bone->mOffsetMatrix));
+                if (bone > UINT16_MAX)
+                {
+                    LOG_WARNING("\"%s\" has too many bones", params.name.c_str());
+                    bones.clear();
+                    break;
+                }
+
+                bones.push_back(static_cast<uint16_t>(bone));
+            }
+        }
+
+        params.model->SetAnimated(true);
+    }
+
+    void ModelImporter::LoadBones(const sImportedMesh& mesh, uint32_t vertex_offset, const sModelParams& params)
+    {
+        if (mesh.skin_weights.empty())
+            return;
+
+        params.model->AppendSkinWeights(vertex_offset, mesh.skin_weights);
     }
 
-    void ModelImporter::LoadBones(const aiMesh* assimp_mesh, const sModelParams& params)
+    bool ModelImporter::LoadCached(uint64_t key, const sModelParams& params)
     {
+        AssetContainer container;
+        if (!m_Context->GetSubModule<ResourceCache>()->GetDerivedDataCache()->Open(key, EXTENSION_MODEL, &container))
+            return false;
+
+        uint64_t index_count = 0;
+        uint64_t vertex_count = 0;
+        uint64_t node_count = 0;
+        uint64_t mesh_count = 0;
+        uint64_t string_length = 0;
+        uint64_t lod_count = 0;
+        const uint32_t* indices = container.GetChunkData<uint32_t>(MODEL_CHUNK_INDICES, &index_count);
+        const RHI_Vertex_PosTexNorTan* vertices = container.GetChunkData<RHI_Vertex_PosTexNorTan>(MODEL_CHUNK_VERTICES, &vertex_count);
+        const sCachedNode* nodes = container.GetChunkData<sCachedNode>(MODEL_CHUNK_NODES, &node_count);
+        const sCachedMesh* meshes = container.GetChunkData<sCachedMesh>(MODEL_CHUNK_MESHES, &mesh_count);
+        const char* strings = container.GetChunkData<char>(MODEL_CHUNK_STRINGS, &string_length);
+        const sMeshLod* lods = container.GetChunkData<sMeshLod>(MODEL_CHUNK_LODS, &lod_count);
+
+        if (!indices || !vertices || !nodes || index_count == 0 || vertex_count == 0 || node_count == 0)
+            return false;
+
+        const auto get_string = [strings, string_length](uint32_t offset, uint32_t length)
+        {
+            return strings && static_cast<uint64_t>(offset) + length <= string_length ? string(strings + offset, length) : string();
+        };
+
+        // ƼƼ    ˻ؼ ߰ ص 忡    Ѵ.
+        for (uint64_t i = 0; i < node_count; i++)
+        {
+            const sCachedNode& node = nodes[i];
+
+            if (node.parent >= static_cast<int32_t>(i) || (i != 0 && node.parent < 0) || node.mesh >= static_cast<int32_t>(mesh_count))
+                return false;
+        }
+
+        for (uint64_t i = 0; i < mesh_count; i++)
+        {
+            const sCachedMesh& mesh = meshes[i];
+
+            if (static_cast<uint64_t>(mesh.index_offset) + mesh.index_count > index_count || static_cast<uint64_t>(mesh.vertex_offset) + mesh.vertex_count > vertex_count)
+                return false;
+
+            // ׸  ٸ Ʈؼ ٽ  Ѵ.
+            if (mesh.material_length != 0 && !FileSystem::Exists(get_string(mesh.material_offset, mesh.material_length)))
+                return false;
+        }
+
+        for (uint64_t i = 0; i < (lods ? lod_count : 0); i++)
+        {
+            if (static_cast<uint64_t>(lods[i].index_offset) + lods[i].index_count > index_count)
+                return false;
+        }
+
+        uint32_t index_offset = 0;
+        uint32_t vertex_offset = 0;
+        params.model->AppendGeometry(vector<uint32_t>(indices, indices + index_count), vector<RHI_Vertex_PosTexNorTan>(vertices, vertices + vertex_count), &index_offset, &vertex_offset);
+
+        // LOD ̹ ε ۿ  Ƿ  Ѵ.
+        for (uint64_t i = 0; i < (lods ? lod_count : 0); i++)
+        {
+            sMeshLod lod = lods[i];
+            lod.base_index_offset += index_offset;
+            lod.index_offset += index_offset;
+            params.model->AddLod(lod);
+        }
+
+        vector<Entity*> entities(node_count, nullptr);
+
+        for (uint64_t i = 0; i < node_count; i++)
+        {
+            const sCachedNode& node = nodes[i];
+
+            const bool is_active = false;
+            shared_ptr<Entity> entity = m_World->EntityCreate(is_active);
+            entities[i] = entity.get();
+
+            if (i == 0)
+            {
+                entity->SetName(params.name);
+                params.model->SetRootEntity(entity);
+            }
+            else
+            {
+                entity->SetName(get_string(node.name_offset, node.name_length));
+                entity->GetTransform()->SetParent(entities[node.parent]->GetTransform());
+            }
+
+            entity->GetTransform()->SetLocalPosition(Vector3(node.position[0], node.position[1], node.position[2]));
+            entity->GetTransform()->SetLocalRotaion(Quaternion(node.rotation[0], node.rotation[1], node.rotation[2], node.rotation[3]));
+            entity->GetTransform()->SetLocalScale(Vector3(node.scale[0], node.scale[1], node.scale[2]));
+
+            if (node.mesh >= 0)
+            {
+                const sCachedMesh& mesh = meshes[node.mesh];
+
+                Renderable* renderable = entity->AddComponent<Renderable>();
+
+                renderable->GeometrySet(
+                    entity->GetObjectName(),
+                    index_offset + mesh.index_offset,
+                    mesh.index_count,
+                    vertex_offset + mesh.vertex_offset,
+                    mesh.vertex_count,
+                    BoundingBox(Vector3(mesh.aabb_min[0], mesh.aabb_min[1], mesh.aabb_min[2]), Vector3(mesh.aabb_max[0], mesh.aabb_max[1], mesh.aabb_max[2])),
+                    params.model
+                );
+
+                if (mesh.material_length != 0)
+                {
+                    renderable->SetMaterial(get_string(mesh.material_offset, mesh.material_length));
+                }
+            }
+
+            entity->SetActive(node.active != 0);
+        }
+
+        params.model->UpdateGeometry();
+
+        return true;
+    }
+
+    void ModelImporter::SaveCached(uint64_t key, const sModelParams& params, const vector<string>& dependencies)
+    {
+        shared_ptr<Entity> root = params.model->GetRootEntity();
+        if (key == 0 || !root)
+            return;
+
+        vector<sCachedNode> nodes;
+        vector<sCachedMesh> meshes;
+        string strings;
+
+        const auto add_string = [&strings](const string& text, uint32_t* offset, uint32_t* length)
+        {
+            *offset = static_cast<uint32_t>(strings.size());
+            *length = static_cast<uint32_t>(text.size());
+            strings += text;
+        };
+
+        // θ ڽĺ տ   켱 ȸѴ.
+        vector<pair<Transform*, int32_t>> stack = { { root->GetTransform(), -1 } };
+
+        while (!stack.empty())
+        {
+            const auto [transform, parent] = stack.back();
+            stack.pop_back();
+
+            Entity* entity = transform->GetEntity();
+            const int32_t index = static_cast<int32_t>(nodes.size());
+
+            sCachedNode& node = nodes.emplace_back();
+            node.parent = parent;
+            node.active = entity->IsActive() ? 1 : 0;
+            add_string(entity->GetObjectName(), &node.name_offset, &node.name_length);
+
+            const Vector3& position = transform->GetLocalPosition();
+            const Quaternion& rotation = transform->GetLocalRotation();
+            const Vector3& scale = transform->GetLocalScale();
+            node.position[0] = position.x; node.position[1] = position.y; node.position[2] = position.z;
+            node.rotation[0] = rotation.x; node.rotation[1] = rotation.y; node.rotation[2] = rotation.z; node.rotation[3] = rotation.w;
+            node.scale[0] = scale.x; node.scale[1] = scale.y; node.scale[2] = scale.z;
+
+            if (Renderable* renderable = entity->GetComponent<Renderable>())
+            {
+                if (renderable->GeometryModel() == params.model)
+                {
+                    node.mesh = static_cast<int32_t>(meshes.size());
+
+                    sCachedMesh& mesh = meshes.emplace_back();
+                    mesh.index_offset = renderable->GeometryIndexOffset();
+                    mesh.index_count = renderable->GeometryIndexCount();
+                    mesh.vertex_offset = renderable->GeometryVertexOffset();
+                    mesh.vertex_count = renderable->GeometryVertexCount();
+
+                    const BoundingBox& aabb = renderable->GetBoundingBox();
+                    mesh.aabb_min[0] = aabb.GetMin().x; mesh.aabb_min[1] = aabb.GetMin().y; mesh.aabb_min[2] = aabb.GetMin().z;
+                    mesh.aabb_max[0] = aabb.GetMax().x; mesh.aabb_max[1] = aabb.GetMax().y; mesh.aabb_max[2] = aabb.GetMax().z;
+
+                    if (Material* material = renderable->GetMaterial())
+                    {
+                        add_string(material->GetResourceFilePathNative(), &mesh.material_offset, &mesh.material_length);
+                    }
+                }
+            }
+
+            //  ־  ڽ  .
+            const vector<Transform*>& children = transform->GetChildren();
+            for (auto it = children.rbegin(); it != children.rend(); ++it)
+            {
+                stack.emplace_back(*it, index);
+            }
+        }
+
+        const vector<uint32_t>& indices = params.model->GetMesh()->GetIndices();
+        const vector<RHI_Vertex_PosTexNorTan>& vertices = params.model->GetMesh()->GetVertices();
+        const vector<sMeshLod>& lods = params.model->GetLods();
+
+        DerivedDataCache* derived_data_cache = m_Context->GetSubModule<ResourceCache>()->GetDerivedDataCache();
+        derived_data_cache->Store(key, EXTENSION_MODEL, [&](AssetContainerWriter& writer)
+        {
+            writer.AddChunk(MODEL_CHUNK_INDICES, indices);
+            writer.AddChunk(MODEL_CHUNK_VERTICES, vertices);
+            writer.AddChunk(MODEL_CHUNK_NODES, nodes);
+            writer.AddChunk(MODEL_CHUNK_MESHES, meshes);
+            writer.AddChunk(MODEL_CHUNK_STRINGS, strings.data(), strings.size());
+            writer.AddChunk(MODEL_CHUNK_LODS, lods);
+            derived_data_cache->AddDependencies(writer, dependencies);
+        });
     }
 }
\ No newline at end of file
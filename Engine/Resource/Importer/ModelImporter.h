@@ -2,7 +2,10 @@
 
 #include <memory>
 #include <string>
+#include <vector>
+#include <unordered_map>
 #include "../../EngineDefinition.h"
+#include "../../RHI/RHI_Definition.h"
 
 struct aiNode;
 struct aiScene;
@@ -17,6 +20,7 @@ namespace PlayGround
     class Entity;
     class Model;
     class World;
+    struct sImportedMesh;
 
     struct sModelParams
     {
@@ -34,10 +38,24 @@ namespace PlayGround
         std::string name;
         // ִϸ̼ 
         bool has_animation;
+        // LOD  ( , 1̸  ʴ´.)
+        uint32_t lod_count;
+        // LOD    ﰢ 
+        float lod_reduction;
+        // LOD 1 ٲ  ũ (ȭ  ,  LOD )
+        float lod_screen_size;
+        // ﰢ ̺  ޽ LOD  ʴ´.
+        uint32_t lod_min_triangles;
+        // LOD 1   (޽ ũ ,  LOD þ.)
+        float lod_target_error;
         // 
         Model* model = nullptr;
         // 
         const aiScene* scene = nullptr;
+        // ۾ 忡 ̸ ȯص ޽ (scene->mMeshes  )
+        const std::vector<sImportedMesh>* meshes = nullptr;
+        // ۾ 忡 ̸ ҷ ؽ ( -> ؽ)
+        const std::unordered_map<std::string, std::shared_ptr<RHI_Texture>>* textures = nullptr;
     };
 
     // Assimp  
@@ -57,10 +75,21 @@ namespace PlayGround
         // ִϸ̼ Ľ
         void ParseAnimations(const sModelParams& params);
         
+        // ޽ ؽĸ ۾ 忡 ѹ ȯϰ ҷ´.
+        void ImportParallel(const sModelParams& params, std::vector<sImportedMesh>* meshes, std::unordered_map<std::string, std::shared_ptr<RHI_Texture>>* textures);
+
         // ޽ ҷ
-        void LoadMesh(aiMesh* assimp_mesh, Entity* entity_parent, const sModelParams& params);
-        //  ҷ
-        void LoadBones(const aiMesh* assimp_mesh, const sModelParams& params);
+        void LoadMesh(uint32_t mesh_index, Entity* entity_parent, const sModelParams& params);
+        //   ̷  ޽  ̷  ٲд.
+        void LoadSkeleton(const sModelParams& params, std::vector<sImportedMesh>* meshes);
+        //  ҷ (޽ Ų ġ 𵨿 ߰Ѵ.)
+        void LoadBones(const sImportedMesh& mesh, uint32_t vertex_offset, const sModelParams& params);
+
+        // Ļ  ĳÿ Ʈ  ִٸ Ʈ ƼƼ  ״ .
+        bool LoadCached(uint64_t key, const sModelParams& params);
+        // Ʈ (Ʈ, ƼƼ , ׸ ) Ļ  ĳÿ Ѵ.
+        // dependencies ҽ  Ʈ  ϵ (.mtl, .bin, ؽ )
+        void SaveCached(uint64_t key, const sModelParams& params, const std::vector<std::string>& dependencies);
 
         Context* m_Context;
         World* m_World;
@@ -4,6 +4,7 @@
 #include "Importer/ImageImporter.h"
 #include "Importer/ModelImporter.h"
 #include "Importer/FontImporter.h"
+#include "DerivedDataCache.h"
 #include "../World/World.h"
 #include "../World/Entity.h"
 #include "../IO/FileStream.h"
@@ -12,12 +13,20 @@
 #include "../RHI/RHI_TextureCube.h"
 #include "../Audio/AudioClip.h"
 #include "../Rendering/Model.h"
+#include "../Rendering/Animation.h"
+#include "../Core/FrameStages.h"
+#include "../Rendering/Material.h"
 
 using namespace std;
 using namespace PlayGround::Math;
 
 namespace PlayGround
 {
+    // ޸   Ӹ ѹ ȮѴ.
+    static constexpr uint64_t BUDGET_CHECK_INTERVAL = 30;
+    // ֱٿ ȸ ҽ  ٽ  ɼ Ƿ  ʴ´.
+    static constexpr uint64_t MIN_IDLE_FRAMES = 120;
+
 	ResourceCache::ResourceCache(Context* context) : SubModule(context)
 	{
         // ҽ ⺻ 
@@ -36,7 +45,6 @@ namespace PlayGround
 
         // , ε, Ŭ ̺Ʈ ش ڵ鷯 ȣѴ.
         SUBSCRIBE_TO_EVENT(EventType::WorldSaveStart, EVENT_HANDLER(SaveResourcesToFiles));
-        SUBSCRIBE_TO_EVENT(EventType::WorldLoadStart, EVENT_HANDLER(LoadResourcesFromFiles));
         SUBSCRIBE_TO_EVENT(EventType::WorldClear, EVENT_HANDLER(Clear));
 	}
 
@@ -44,69 +52,284 @@ namespace PlayGround
     {
         //  
         UNSUBSCRIBE_FROM_EVENT(EventType::WorldSaveStart, EVENT_HANDLER(SaveResourcesToFiles));
-        UNSUBSCRIBE_FROM_EVENT(EventType::WorldLoadStart, EVENT_HANDLER(LoadResourcesFromFiles));
         UNSUBSCRIBE_FROM_EVENT(EventType::WorldClear, EVENT_HANDLER(Clear));
     }
 
     void ResourceCache::OnInit()
     {
+        m_DerivedDataCache = make_shared<DerivedDataCache>(m_Context);
         m_ImageImporter = make_shared<ImageImporter>(m_Context);
         m_ModelImporter = make_shared<ModelImporter>(m_Context);
         m_FontImporter = make_shared<FontImporter>(m_Context);
     }
 
-    bool ResourceCache::IsCached(const string& resource_name, const EResourceType resource_type)
+    bool ResourceCache::RegisterFrameStages(FrameGraph& graph, ETickType tick_group)
     {
-        ASSERT(!resource_name.empty());
+        // ݹ ƼƼ  ǵ帱  Ƿ  忡 Ѵ.
+        graph.AddStage(FrameStages::RESOURCE_CACHE, tick_group, [this](double delta_time) { Update(delta_time); });
+
+        return true;
+    }
+
+    void ResourceCache::Update(double delta_time)
+    {
+        const uint64_t frame = m_Frame.fetch_add(1, memory_order_relaxed) + 1;
 
-        // ĳ̵Ǿִ ҽ ȮѴ.
-        for (shared_ptr<IResource>& resource : m_vecResources)
+        if (frame % BUDGET_CHECK_INTERVAL == 0)
+            EnforceBudgets();
+
+        //  û ݹ鸸 .
+        vector<sLoadCallback> ready;
         {
-            if (resource->GetResourceType() != resource_type)
-                continue;
+            lock_guard<mutex> lock(m_Mutex_callbacks);
+
+            if (m_vecCallbacks.empty())
+                return;
+
+            const auto pending_end = stable_partition(m_vecCallbacks.begin(), m_vecCallbacks.end(), [](const sLoadCallback& callback) { return !callback.future.IsReady(); });
+            ready.assign(make_move_iterator(pending_end), make_move_iterator(m_vecCallbacks.end()));
+            m_vecCallbacks.erase(pending_end, m_vecCallbacks.end());
+        }
+
+        //  ӿ  ʵ     ӿ ȣѴ.
+        const StopWatch timer;
+        size_t called = 0;
+
+        for (; called < ready.size(); called++)
+        {
+            if (called != 0 && timer.GetElapsedTimeMS() > m_CallbackBudgetMS)
+                break;
 
-            if (resource_name == resource->GetResourceName())
-                return true;
+            sLoadCallback& callback = ready[called];
+            callback.callback(callback.future.Get());
         }
 
-        return false;
+        if (called < ready.size())
+        {
+            lock_guard<mutex> lock(m_Mutex_callbacks);
+            m_vecCallbacks.insert(m_vecCallbacks.begin(), make_move_iterator(ready.begin() + called), make_move_iterator(ready.end()));
+        }
+    }
+
+    shared_ptr<sResourceLoadRequest> ResourceCache::RequestLoad(const string& file_path, function<shared_ptr<IResource>(const string&)>&& load)
+    {
+        Threading* threading = m_Context->GetSubModule<Threading>();
+        shared_ptr<sResourceLoadRequest> request;
+
+        const auto run = [this, load = move(load)](const shared_ptr<sResourceLoadRequest>& request)
+        {
+            shared_ptr<IResource> resource = load(request->path);
+
+            // ĳ  ڿ û Ƿ   û ĳÿ ã´.
+            {
+                lock_guard<mutex> lock(m_Mutex_loads);
+                m_PendingLoads.erase(request->path);
+            }
+
+            request->promise.set_value(resource);
+        };
+
+        {
+            lock_guard<mutex> lock(m_Mutex_loads);
+
+            const auto it = m_PendingLoads.find(file_path);
+            if (it != m_PendingLoads.end())
+                return it->second;
+
+            request = make_shared<sResourceLoadRequest>();
+            request->path = file_path;
+            request->future = request->promise.get_future().share();
+            m_PendingLoads[file_path] = request;
+
+            //  û ϴ  ٷ ٸ  ֵ  ¿ ڵ صд.
+            if (threading)
+                request->job = threading->CreateTask([run, request]() { run(request); });
+        }
+
+        if (threading)
+            threading->Submit(request->job);
+        else
+            run(request);
+
+        return request;
+    }
+
+    void ResourceCache::QueueCallback(const ResourceFuture<IResource>& future, function<void(const shared_ptr<IResource>&)>&& callback)
+    {
+        lock_guard<mutex> lock(m_Mutex_callbacks);
+
+        sLoadCallback& entry = m_vecCallbacks.emplace_back();
+        entry.future = future;
+        entry.callback = move(callback);
+    }
+
+    bool ResourceCache::IsCached(const string& resource_name, const EResourceType resource_type)
+    {
+        ASSERT(!resource_name.empty());
+
+        return FindByName(resource_name, resource_type) != nullptr;
     }
 
     bool ResourceCache::IsCached(const uint64_t resource_id)
     {
+        shared_lock<shared_mutex> lock(m_Mutex);
+
         // ҽ ̵  ĳ̵Ǿ ִ ȮѴ.
-        for (shared_ptr<IResource>& resource : m_vecResources)
+        return m_TypeByID.find(resource_id) != m_TypeByID.end();
+    }
+
+    shared_ptr<IResource> ResourceCache::GetByName(const string& name, const EResourceType type)
+    {
+        //  ҽ ٽ ҷ  ٸ ۾  óϸ ٸ.
+        return GetByNameAsync(name, type).Get();
+    }
+
+    ResourceFuture<IResource> ResourceCache::GetByNameAsync(const string& name, const EResourceType type)
+    {
+        if (shared_ptr<IResource> resource = FindByName(name, type))
+            return ResourceFuture<IResource>(resource);
+
+        // ޸    ҽ ٽ ҷ´.
+        EResourceType evicted_type = EResourceType::Unknown;
+        string evicted_path;
+        {
+            shared_lock<shared_mutex> lock(m_Mutex);
+
+            const uint32_t first = type == EResourceType::Unknown ? 0 : static_cast<uint32_t>(type);
+            const uint32_t last = type == EResourceType::Unknown ? RESOURCE_TYPE_COUNT : first + 1;
+
+            for (uint32_t i = first; i < last && evicted_path.empty(); i++)
+            {
+                const auto it = m_Buckets[i].evicted.find(name);
+
+                if (it != m_Buckets[i].evicted.end())
+                {
+                    evicted_type = static_cast<EResourceType>(i);
+                    evicted_path = it->second;
+                }
+            }
+        }
+
+        if (evicted_path.empty())
+            return ResourceFuture<IResource>();
+
+        return Reload(evicted_type, name, evicted_path);
+    }
+
+    shared_ptr<IResource> ResourceCache::FindByName(const string& name, const EResourceType type)
+    {
+        shared_lock<shared_mutex> lock(m_Mutex);
+
+        // Ÿ 𸥴ٸ  Ÿ ε ȮѴ.
+        const uint32_t first = type == EResourceType::Unknown ? 0 : static_cast<uint32_t>(type);
+        const uint32_t last = type == EResourceType::Unknown ? RESOURCE_TYPE_COUNT : first + 1;
+
+        for (uint32_t i = first; i < last; i++)
         {
-            if (resource_id == resource->GetObjectID())
-                return true;
+            const sResourceBucket& bucket = m_Buckets[i];
+            const auto it = bucket.by_name.find(name);
+
+            if (it != bucket.by_name.end())
+            {
+                const shared_ptr<IResource>& resource = bucket.entries[it->second].resource;
+                resource->SetLastUsedFrame(GetFrame());
+
+                return resource;
+            }
         }
 
-        return false;
+        return nullptr;
     }
 
-    shared_ptr<IResource>& ResourceCache::GetByName(const string& name, const EResourceType type)
+    ResourceFuture<IResource> ResourceCache::Reload(EResourceType type, const string& name, const string& path)
     {
-        // ̸ ĳ Ǿ ִ ȮѴ.
-        for (shared_ptr<IResource>& resource : m_vecResources)
+        //   ٽ ĳ̵  . (  ȸ 嵵  û ٸ.)
+        // ҷ ߴٸ Ź ٽ õ ʵ  忡 Ͽ .
+        const auto forget_if_failed = [this, type, name](const shared_ptr<IResource>& resource)
+        {
+            if (resource)
+                return;
+
+            unique_lock<shared_mutex> lock(m_Mutex);
+            m_Buckets[static_cast<uint32_t>(type)].evicted.erase(name);
+        };
+
+        LOG_INFO("Reloading evicted resource \"%s\"", path.c_str());
+
+        ResourceFuture<IResource> future;
+
+        switch (type)
         {
-            if (name == resource->GetResourceName())
+        case EResourceType::Model:
+            future = LoadAsync<Model>(path);
+            break;
+        case EResourceType::Material:
+            future = LoadAsync<Material>(path);
+            break;
+        case EResourceType::Texture:
+            future = LoadAsync<RHI_Texture>(path);
+            break;
+        case EResourceType::Texture2d:
+            future = LoadAsync<RHI_Texture2D>(path);
+            break;
+        case EResourceType::Texture2dArray:
+            future = LoadAsync<RHI_Texture2DArray>(path);
+            break;
+        case EResourceType::TextureCube:
+            future = LoadAsync<RHI_TextureCube>(path);
+            break;
+        case EResourceType::Audio:
+            future = LoadAsync<AudioClip>(path);
+            break;
+        case EResourceType::Animation:
+            future = LoadAsync<Animation>(path);
+            break;
+        }
+
+        if (future.IsValid())
+            QueueCallback(future, forget_if_failed);
+
+        return future;
+    }
+
+    shared_ptr<IResource> ResourceCache::GetByPath(const string& path, const EResourceType type)
+    {
+        shared_lock<shared_mutex> lock(m_Mutex);
+
+        const uint32_t first = type == EResourceType::Unknown ? 0 : static_cast<uint32_t>(type);
+        const uint32_t last = type == EResourceType::Unknown ? RESOURCE_TYPE_COUNT : first + 1;
+
+        for (uint32_t i = first; i < last; i++)
+        {
+            const sResourceBucket& bucket = m_Buckets[i];
+            const auto it = bucket.by_path.find(path);
+
+            if (it != bucket.by_path.end())
+            {
+                const shared_ptr<IResource>& resource = bucket.entries[it->second].resource;
+                resource->SetLastUsedFrame(GetFrame());
+
                 return resource;
+            }
         }
 
-        static shared_ptr<IResource> empty;
-        return empty;
+        return nullptr;
     }
 
     vector<shared_ptr<IResource>> ResourceCache::GetByType(const EResourceType type)
     {
+        shared_lock<shared_mutex> lock(m_Mutex);
+
+        const uint32_t first = type == EResourceType::Unknown ? 0 : static_cast<uint32_t>(type);
+        const uint32_t last = type == EResourceType::Unknown ? RESOURCE_TYPE_COUNT : first + 1;
+
         vector<shared_ptr<IResource>> resources;
 
-        // ҽ Ÿ  ĳ̵Ǿ ִ Ȯ
-        for (shared_ptr<IResource>& resource : m_vecResources)
+        for (uint32_t i = first; i < last; i++)
         {
-            if (resource->GetResourceType() == type || type == EResourceType::Unknown)
+            for (const sResourceEntry& entry : m_Buckets[i].entries)
             {
-                resources.emplace_back(resource);
+                resources.emplace_back(entry.resource);
             }
         }
 
@@ -118,18 +341,9 @@ namespace PlayGround
         // CPU ũ⸦ Ѵ.
         uint64_t size = 0;
 
-        for (shared_ptr<IResource>& resource : m_vecResources)
+        for (const shared_ptr<IResource>& resource : GetByType(type))
         {
-            if (resource->GetResourceType() == type || type == EResourceType::Unknown)
-            {
-                EngineObject* object = dynamic_cast<EngineObject*>(resource.get());
-            
-                // ũ 
-                if (object)
-                {
-                    size += object->GetObjectSizeCPU();
-                }
-            }
+            size += resource->GetObjectSizeCPU();
         }
 
         return size;
@@ -140,21 +354,254 @@ namespace PlayGround
         // GPU ũ⸦ Ѵ.
         uint64_t size = 0;
 
-        for (shared_ptr<IResource>& resource : m_vecResources)
+        for (const shared_ptr<IResource>& resource : GetByType(type))
         {
-            if (resource->GetResourceType() == type || type == EResourceType::Unknown)
+            size += resource->GetObjectSizeGPU();
+        }
+
+        return size;
+    }
+
+    shared_ptr<IResource> ResourceCache::Insert(const shared_ptr<IResource>& resource)
+    {
+        unique_lock<shared_mutex> lock(m_Mutex);
+
+        const EResourceType type = resource->GetResourceType();
+        sResourceBucket& bucket = m_Buckets[static_cast<uint32_t>(type)];
+
+        // ױ  ٸ 尡  ҽ ĳ  ִ.
+        const auto it = bucket.by_name.find(resource->GetResourceName());
+        if (it != bucket.by_name.end())
+            return bucket.entries[it->second].resource;
+
+        const uint32_t index = static_cast<uint32_t>(bucket.entries.size());
+
+        sResourceEntry& entry = bucket.entries.emplace_back();
+        entry.resource = resource;
+        entry.name = resource->GetResourceName();
+        entry.path = resource->GetResourceFilePathNative();
+
+        bucket.by_name.emplace(entry.name, index);
+        bucket.by_path.emplace(entry.path, index);
+        bucket.by_id.emplace(resource->GetObjectID(), index);
+        bucket.evicted.erase(entry.name);
+        m_TypeByID[resource->GetObjectID()] = type;
+        resource->SetLastUsedFrame(GetFrame());
+
+        return resource;
+    }
+
+    bool ResourceCache::RemoveByID(uint64_t resource_id, bool evict)
+    {
+        unique_lock<shared_mutex> lock(m_Mutex);
+
+        //  ĳ̵Ǿִ ҽ ƴ϶ ȯ
+        const auto type_it = m_TypeByID.find(resource_id);
+        if (type_it == m_TypeByID.end())
+            return false;
+
+        sResourceBucket& bucket = m_Buckets[static_cast<uint32_t>(type_it->second)];
+        const auto id_it = bucket.by_id.find(resource_id);
+        const uint32_t index = id_it->second;
+
+        // ĺ  ڿ ٸ    ִ.
+        if (evict)
+        {
+            if (bucket.entries[index].resource.use_count() != 1 || bucket.entries[index].resource->IsPinned() || bucket.entries[index].path.empty())
+                return false;
+
+            bucket.evicted[bucket.entries[index].name] = bucket.entries[index].path;
+        }
+
+        m_TypeByID.erase(type_it);
+        bucket.by_id.erase(id_it);
+
+        //  Ű ٸ ҽ ϰ   Ƿ ڱ ڽ ų  .
+        const auto erase_key = [index](unordered_map<string, uint32_t>& map, const string& key)
+        {
+            const auto it = map.find(key);
+            if (it != map.end() && it->second == index)
+                map.erase(it);
+        };
+
+        sResourceEntry& entry = bucket.entries[index];
+        erase_key(bucket.by_name, entry.name);
+        erase_key(bucket.by_path, entry.path);
+
+        //  ҽ  ڸ ű ε ģ.
+        const uint32_t last = static_cast<uint32_t>(bucket.entries.size()) - 1;
+        if (index != last)
+        {
+            entry = move(bucket.entries[last]);
+
+            const auto relink = [index, last](unordered_map<string, uint32_t>& map, const string& key)
             {
-                EngineObject* object = dynamic_cast<EngineObject*>(resource.get());
+                const auto it = map.find(key);
+                if (it != map.end() && it->second == last)
+                    it->second = index;
+            };
+
+            relink(bucket.by_name, entry.name);
+            relink(bucket.by_path, entry.path);
+            bucket.by_id[entry.resource->GetObjectID()] = index;
+        }
+
+        bucket.entries.pop_back();
+
+        return true;
+    }
+
+    void ResourceCache::SetMemoryBudget(EResourceType type, uint64_t budget_cpu, uint64_t budget_gpu)
+    {
+        m_BudgetCPU[static_cast<uint32_t>(type)] = budget_cpu;
+        m_BudgetGPU[static_cast<uint32_t>(type)] = budget_gpu;
+    }
+
+    sResourceResidency ResourceCache::GetResidency(EResourceType type)
+    {
+        shared_lock<shared_mutex> lock(m_Mutex);
+
+        const uint32_t first = type == EResourceType::Unknown ? 0 : static_cast<uint32_t>(type);
+        const uint32_t last = type == EResourceType::Unknown ? RESOURCE_TYPE_COUNT : first + 1;
+
+        sResourceResidency residency;
+        residency.budget_cpu = m_BudgetCPU[static_cast<uint32_t>(type)];
+        residency.budget_gpu = m_BudgetGPU[static_cast<uint32_t>(type)];
+
+        for (uint32_t i = first; i < last; i++)
+        {
+            const sResourceBucket& bucket = m_Buckets[i];
+
+            residency.resident_count += static_cast<uint32_t>(bucket.entries.size());
+            residency.evicted_count += static_cast<uint32_t>(bucket.evicted.size());
 
-                //  
-                if (object)
+            for (const sResourceEntry& entry : bucket.entries)
+            {
+                residency.usage_cpu += entry.resource->GetObjectSizeCPU();
+                residency.usage_gpu += entry.resource->GetObjectSizeGPU();
+            }
+        }
+
+        return residency;
+    }
+
+    void ResourceCache::EnforceBudgets()
+    {
+        // ŸԺ 뷮 (0 ü)
+        array<uint64_t, RESOURCE_TYPE_COUNT> usage_cpu = {};
+        array<uint64_t, RESOURCE_TYPE_COUNT> usage_gpu = {};
+        {
+            shared_lock<shared_mutex> lock(m_Mutex);
+
+            for (uint32_t i = 1; i < RESOURCE_TYPE_COUNT; i++)
+            {
+                for (const sResourceEntry& entry : m_Buckets[i].entries)
                 {
-                    size += object->GetObjectSizeGPU();
+                    usage_cpu[i] += entry.resource->GetObjectSizeCPU();
+                    usage_gpu[i] += entry.resource->GetObjectSizeGPU();
                 }
+
+                usage_cpu[0] += usage_cpu[i];
+                usage_gpu[0] += usage_gpu[i];
             }
         }
 
-        return size;
+        const auto over_cpu = [&](uint32_t i) { return m_BudgetCPU[i] != 0 && usage_cpu[i] > m_BudgetCPU[i]; };
+        const auto over_gpu = [&](uint32_t i) { return m_BudgetGPU[i] != 0 && usage_gpu[i] > m_BudgetGPU[i]; };
+        const auto over = [&](uint32_t i) { return over_cpu(i) || over_gpu(i) || over_cpu(0) || over_gpu(0); };
+
+        const auto any_over = [&]()
+        {
+            for (uint32_t i = 1; i < RESOURCE_TYPE_COUNT; i++)
+            {
+                if (over(i))
+                    return true;
+            }
+
+            return false;
+        };
+
+        if (!any_over())
+            return;
+
+        // CPU 길 Ѿٸ GPU ö ҽ CPU 纻 ϴ    ִ.
+        if (m_ReleaseCpuData)
+        {
+            for (const shared_ptr<IResource>& resource : GetByType())
+            {
+                const uint32_t i = static_cast<uint32_t>(resource->GetResourceType());
+
+                if (!over_cpu(i) && !over_cpu(0))
+                    continue;
+
+                const uint64_t released = resource->ReleaseCpuData();
+                usage_cpu[i] -= min(usage_cpu[i], released);
+                usage_cpu[0] -= min(usage_cpu[0], released);
+            }
+
+            if (!any_over())
+                return;
+        }
+
+        struct sCandidate
+        {
+            uint64_t id;
+            uint32_t type;
+            uint64_t last_used;
+            uint64_t size_cpu;
+            uint64_t size_gpu;
+        };
+
+        vector<sCandidate> candidates;
+        const uint64_t frame = GetFrame();
+        {
+            shared_lock<shared_mutex> lock(m_Mutex);
+
+            for (uint32_t i = 1; i < RESOURCE_TYPE_COUNT; i++)
+            {
+                if (!over(i))
+                    continue;
+
+                for (const sResourceEntry& entry : m_Buckets[i].entries)
+                {
+                    const IResource* resource = entry.resource.get();
+
+                    // ĳø ϰ    ҽ ƹ  ʴ ҽ.
+                    //  ͸  ִ  ִϸʹ ϰ,       ٽ .
+                    // Ͱ  ִ  Ʈ  ڿ ĳ̵ǹǷ  ⿡ .
+                    if (entry.resource.use_count() != 1 || resource->IsPinned() || resource->IsLoading())
+                        continue;
+
+                    if (resource->GetLastUsedFrame() + MIN_IDLE_FRAMES > frame)
+                        continue;
+
+                    candidates.push_back({ resource->GetObjectID(), i, resource->GetLastUsedFrame(), resource->GetObjectSizeCPU(), resource->GetObjectSizeGPU() });
+                }
+            }
+        }
+
+        //   ȸ  ҽ .
+        sort(candidates.begin(), candidates.end(), [](const sCandidate& a, const sCandidate& b) { return a.last_used < b.last_used; });
+
+        uint32_t evicted = 0;
+
+        for (const sCandidate& candidate : candidates)
+        {
+            if (!over(candidate.type))
+                continue;
+
+            if (!RemoveByID(candidate.id, true))
+                continue;
+
+            usage_cpu[candidate.type] -= min(usage_cpu[candidate.type], candidate.size_cpu);
+            usage_gpu[candidate.type] -= min(usage_gpu[candidate.type], candidate.size_gpu);
+            usage_cpu[0] -= min(usage_cpu[0], candidate.size_cpu);
+            usage_gpu[0] -= min(usage_gpu[0], candidate.size_gpu);
+            evicted++;
+        }
+
+        if (evicted != 0)
+            LOG_INFO("%d unused resources have been evicted to stay within the memory budget", evicted);
     }
 
     void ResourceCache::SaveResourcesToFiles()
@@ -175,21 +622,35 @@ namespace PlayGround
             return;
         }
 
+        // ü  ҽ Ѵ.
+        // ϴ  ĳø װ  ʵ ؼ Ѵ.
+        vector<shared_ptr<IResource>> resources = GetByType();
+        resources.erase(remove_if(resources.begin(), resources.end(), [](const shared_ptr<IResource>& resource) { return !resource->HasFilePathNative(); }), resources.end());
+
+        //    ִ ҽ  ҽ̹Ƿ Ͽ .
+        vector<pair<string, EResourceType>> evicted;
+        {
+            shared_lock<shared_mutex> lock(m_Mutex);
+
+            for (uint32_t i = 0; i < RESOURCE_TYPE_COUNT; i++)
+            {
+                for (const auto& [name, path] : m_Buckets[i].evicted)
+                {
+                    evicted.emplace_back(path, static_cast<EResourceType>(i));
+                }
+            }
+        }
+
         // ҽ  ´.
-        const uint32_t resource_count = GetResourceCount();
+        const uint32_t resource_count = static_cast<uint32_t>(resources.size() + evicted.size());
         ProgressTracker::Get().SetJobCount(EProgressType::ResoruceCache, resource_count);
 
         // ҽ 
         file->Write(resource_count);
 
-        for (shared_ptr<IResource>& resource : m_vecResources)
+        for (shared_ptr<IResource>& resource : resources)
         {
-            // ü  ƴҰ 
-            if (!resource->HasFilePathNative())
-                continue;
-
             //  
-
             file->Write(resource->GetResourceFilePathNative());
 
             file->Write(static_cast<uint32_t>(resource->GetResourceType()));
@@ -199,22 +660,36 @@ namespace PlayGround
             ProgressTracker::Get().IncrementJobsDone(EProgressType::ResoruceCache);
         }
 
+        for (const auto& [path, type] : evicted)
+        {
+            file->Write(path);
+            file->Write(static_cast<uint32_t>(type));
+
+            ProgressTracker::Get().IncrementJobsDone(EProgressType::ResoruceCache);
+        }
+
         // ƮĿ 
         ProgressTracker::Get().SetIsLoading(EProgressType::ResoruceCache, false);
     }
 
-    void ResourceCache::LoadResourcesFromFiles()
+    vector<ResourceFuture<IResource>> ResourceCache::LoadResourcesFromFiles()
     {
         // ҽ  ҷ´.
         string file_path = GetProjectDirectoryAbsolute() + m_Context->GetSubModule<World>()->GetName() + "_resources.dat";
         unique_ptr<FileStream> file = make_unique<FileStream>(file_path, FileStream_Read);
 
+        vector<ResourceFuture<IResource>> futures;
+
         if (!file->IsOpen())
-            return;
+            return futures;
 
         // ҽ   ´.
         const uint32_t resource_count = file->ReadAs<uint32_t>();
 
+        //  ҽ ۾ 忡 ÿ ҷ´.
+        //  ؽó   ûϹǷ   ϴ ؽó ѹ ҷ´.
+        futures.reserve(resource_count);
+
         // ҽ ŭ ݺѴ.
         for (uint32_t i = 0; i < resource_count; i++)
         {
@@ -225,36 +700,49 @@ namespace PlayGround
             switch (type)
             {
             case EResourceType::Model:
-                Load<Model>(file_path);
+                futures.emplace_back(LoadAsync<Model>(file_path));
                 break;
             case EResourceType::Material:
-                Load<Material>(file_path);
+                futures.emplace_back(LoadAsync<Material>(file_path));
                 break;
             case EResourceType::Texture:
-                Load<RHI_Texture>(file_path);
+                futures.emplace_back(LoadAsync<RHI_Texture>(file_path));
                 break;
             case EResourceType::Texture2d:
-                Load<RHI_Texture2D>(file_path);
+                futures.emplace_back(LoadAsync<RHI_Texture2D>(file_path));
                 break;
             case EResourceType::Texture2dArray:
-                Load<RHI_Texture2DArray>(file_path);
+                futures.emplace_back(LoadAsync<RHI_Texture2DArray>(file_path));
                 break;
             case EResourceType::TextureCube:
-                Load<RHI_TextureCube>(file_path);
+                futures.emplace_back(LoadAsync<RHI_TextureCube>(file_path));
                 break;
             case EResourceType::Audio:
-                Load<AudioClip>(file_path);
+                futures.emplace_back(LoadAsync<AudioClip>(file_path));
+                break;
+            case EResourceType::Animation:
+                futures.emplace_back(LoadAsync<Animation>(file_path));
                 break;
             }
         }
+
+        return futures;
     }
 
     void ResourceCache::Clear()
     {
+        unique_lock<shared_mutex> lock(m_Mutex);
+
         //  Ŭ
-        uint32_t resource_count = static_cast<uint32_t>(m_vecResources.size());
+        uint32_t resource_count = 0;
 
-        m_vecResources.clear();
+        for (sResourceBucket& bucket : m_Buckets)
+        {
+            resource_count += static_cast<uint32_t>(bucket.entries.size());
+            bucket = sResourceBucket();
+        }
+
+        m_TypeByID.clear();
 
         LOG_INFO("%d resources have been cleared", resource_count);
     }
@@ -262,7 +750,18 @@ namespace PlayGround
     // ҽ  ´.
     uint32_t ResourceCache::GetResourceCount(const EResourceType type)
     {
-        return static_cast<uint32_t>(GetByType(type).size());
+        shared_lock<shared_mutex> lock(m_Mutex);
+
+        if (type != EResourceType::Unknown)
+            return static_cast<uint32_t>(m_Buckets[static_cast<uint32_t>(type)].entries.size());
+
+        uint32_t count = 0;
+        for (const sResourceBucket& bucket : m_Buckets)
+        {
+            count += static_cast<uint32_t>(bucket.entries.size());
+        }
+
+        return count;
     }
 
     // ҽ 丮 ߰
@@ -1,9 +1,14 @@
 #pragma once
 
 #include <unordered_map>
+#include <shared_mutex>
+#include <array>
+#include <future>
+#include <functional>
 #include "IResource.h"
 #include "../Core/SubModule.h"
 #include "../Rendering/Model.h"
+#include "../Threading/Threading.h"
 
 
 namespace PlayGround
@@ -11,6 +16,7 @@ namespace PlayGround
 	class FontImporter;
 	class ImageImporter;
 	class ModelImporter;
+	class DerivedDataCache;
 
 	// ҽ 
 	enum class EResourceDirectory
@@ -23,7 +29,79 @@ namespace PlayGround
 		Textures
 	};
 
+	// 񵿱 ε û ( θ ÿ ûϸ ϳ Ѵ.)
+	struct sResourceLoadRequest
+	{
+		std::string path;
+		JobHandle job;
+		std::promise<std::shared_ptr<IResource>> promise;
+		std::shared_future<std::shared_ptr<IResource>> future;
+	};
+
+	// LoadAsync 
+	template <typename T>
+	class ResourceFuture
+	{
+	public:
+		ResourceFuture() = default;
+		ResourceFuture(const std::shared_ptr<sResourceLoadRequest>& request, Threading* threading) : m_Request(request), m_Threading(threading) {}
+		// ̹ ĳ̵Ǿ ִ ҽ
+		ResourceFuture(const std::shared_ptr<T>& resource) : m_Resource(resource) {}
+
+		// ٸ ҽ Ÿ  IResource   Ÿ   Ѵ.
+		template <typename U>
+		ResourceFuture(const ResourceFuture<U>& other) : m_Request(other.m_Request), m_Threading(other.m_Threading), m_Resource(other.m_Resource) {}
+
+		inline bool IsValid() const { return m_Request || m_Resource; }
+
+		bool IsReady() const
+		{
+			return !m_Request || m_Request->future.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+		}
+
+		// ε  ٸ ۾  óϸ ٸ. (ߴٸ nullptr)
+		// ۾ 忡 ȣص  Ƿ ε ߿ ϴ ҽ ٸ  ִ.
+		std::shared_ptr<T> Get()
+		{
+			if (m_Request)
+			{
+				if (m_Threading)
+					m_Threading->Wait(m_Request->job);
+
+				m_Resource = std::static_pointer_cast<T>(m_Request->future.get());
+				m_Request.reset();
+			}
+
+			return m_Resource;
+		}
+
+	private:
+		template <typename U>
+		friend class ResourceFuture;
+
+		std::shared_ptr<sResourceLoadRequest> m_Request;
+		Threading* m_Threading = nullptr;
+		std::shared_ptr<T> m_Resource;
+	};
+
+	static constexpr uint32_t RESOURCE_TYPE_COUNT = static_cast<uint32_t>(EResourceType::Shader) + 1;
+
+	//  Ÿ(Ǵ ü) ޸ 뷮 
+	struct sResourceResidency
+	{
+		uint32_t resident_count = 0;
+		//    ִ ҽ 
+		uint32_t evicted_count = 0;
+		uint64_t usage_cpu = 0;
+		uint64_t usage_gpu = 0;
+		// 0̸  
+		uint64_t budget_cpu = 0;
+		uint64_t budget_gpu = 0;
+	};
+
 	// ҽ ü  Ŭ
+	// ŸԺ ̸, , ̵ ؽ ε ξ ȸ ҽ    ð̴.
+	// ȸ    忡 ÿ   ִ.
 	class ResourceCache : public SubModule
 	{
 	public:
@@ -32,26 +110,26 @@ namespace PlayGround
 
 		//    ޼
 		void OnInit() override;
-
-		std::shared_ptr<IResource>& GetByName(const std::string& name, EResourceType type);
+		// 񵿱 ε  ҽ ݹ ȣѴ.
+		void Update(double delta_time) override;
+		bool RegisterFrameStages(FrameGraph& graph, ETickType tick_group) override;
+
+		// type Unknown̶  ŸԿ ã´.
+		// ޸    ҽ ۾ 忡 ٽ ҷ  ٸ ۾  óϸ ٸ.
+		//  尡  ҽ ȸص ε û ϹǷ ѹ ҷ´.
+		std::shared_ptr<IResource> GetByName(const std::string& name, EResourceType type);
+		// ٸ ʴ GetByName ( 忡    ̰ .  ҽ ȿ ʴ.)
+		ResourceFuture<IResource> GetByNameAsync(const std::string& name, EResourceType type);
+		std::shared_ptr<IResource> GetByPath(const std::string& path, EResourceType type);
 
 		template <typename T>
-		constexpr std::shared_ptr<T> GetByName(const std::string& name) { return std::static_pointer_cast<T>(GetByName(name, IResource::TypeToEnum<T>())); }
+		std::shared_ptr<T> GetByName(const std::string& name) { return std::static_pointer_cast<T>(GetByName(name, IResource::TypeToEnum<T>())); }
 
 		std::vector<std::shared_ptr<IResource>> GetByType(EResourceType type = EResourceType::Unknown);
 
 		// TŸ ش θ  ִ ҽ ȯѴ.
 		template <typename T>
-		std::shared_ptr<T> GetByPath(const std::string& path)
-		{
-			for (std::shared_ptr<IResource>& resource : m_vecResources)
-			{
-				if (path == resource->GetResourceFilePathNative())
-					return std::static_pointer_cast<T>(resource);
-			}
-
-			return nullptr;
-		}
+		std::shared_ptr<T> GetByPath(const std::string& path) { return std::static_pointer_cast<T>(GetByPath(path, IResource::TypeToEnum<T>())); }
 
 		// ҽ ĳ
 		template <typename T>
@@ -75,16 +153,14 @@ namespace PlayGround
 			}
 
 			// ̹ ĳ̵Ǿִ Ȯ
-			if (IsCached(resource->GetResourceName(), resource->GetResourceType()))
-				return GetByName<T>(resource->GetResourceName());
-
-			std::lock_guard<std::mutex> guard(m_Mutex);
+			if (std::shared_ptr<IResource> cached = FindByName(resource->GetResourceName(), resource->GetResourceType()))
+				return std::static_pointer_cast<T>(cached);
 
 			// ҽ  
 			resource->SaveToFile(resource->GetResourceFilePathNative());
 
-			// ĳ 
-			return std::static_pointer_cast<T>(m_vecResources.emplace_back(resource));
+			// ĳ  ( ̿ ٸ 尡  ĳߴٸ  ҽ ȯѴ.)
+			return std::static_pointer_cast<T>(Insert(resource));
 		}
 
 		template <typename T>
@@ -100,8 +176,8 @@ namespace PlayGround
 			//  ̸
 			const std::string name = FileSystem::GetFileNameWithoutExtensionFromFilePath(file_path);
 			// ̹ ĳ Ǿִ ȮѴ.
-			if (IsCached(name, IResource::TypeToEnum<T>()))
-				return GetByName<T>(name);
+			if (std::shared_ptr<IResource> cached = FindByName(name, IResource::TypeToEnum<T>()))
+				return std::static_pointer_cast<T>(cached);
 
 			auto typed = std::make_shared<T>(m_Context);
 
@@ -115,28 +191,77 @@ namespace PlayGround
 				return nullptr;
 			}
 
+			// ü   ҷԴٸ ٽ  ʿ  ٷ Ѵ.
+			if (FileSystem::IsEngineFile(file_path))
+				return std::static_pointer_cast<T>(Insert(typed));
+
 			// ĳ
 			return Cache<T>(typed);
 		}
 
-		// ҽ 
+		// ۾ 忡 ҽ ҷ´.
+		//  θ ε û ִٸ  û ϰ ̹ ĳ̵Ǿ ִٸ ٷ Ϸȴ.
+		// on_loaded ε    忡 Ӵ ð  ȿ ȣȴ.
 		template <typename T>
-		void Remove(std::shared_ptr<T>& resource)
+		ResourceFuture<T> LoadAsync(const std::string& file_path, std::function<void(const std::shared_ptr<T>&)> on_loaded = nullptr)
 		{
-			if (!resource)
-				return;
+			ResourceFuture<T> future;
 
-			//  ĳ̵Ǿִ ҽ ƴ϶ ȯ
-			if (!IsCached(resource->GetResourceName(), resource->GetResourceType()))
-				return;
+			const std::string name = FileSystem::GetFileNameWithoutExtensionFromFilePath(file_path);
+
+			if (std::shared_ptr<IResource> cached = FindByName(name, IResource::TypeToEnum<T>()))
+			{
+				future = ResourceFuture<T>(std::static_pointer_cast<T>(cached));
+			}
+			else
+			{
+				std::shared_ptr<sResourceLoadRequest> request = RequestLoad(file_path, [this](const std::string& path) { return std::static_pointer_cast<IResource>(Load<T>(path)); });
+				future = ResourceFuture<T>(request, m_Context->GetSubModule<Threading>());
+			}
 
-			// Ǿִ ҽ ش ҽ ãƼ Ѵ.
-			m_vecResources.erase(std::remove_if(m_vecResources.begin(), m_vecResources.end(), [](std::shared_ptr<IResource> resource)
+			if (on_loaded)
 			{
-				return dynamic_cast<EngineObject*>(resource.get())->GetObjectID() == resource->GetObjectID();
-			}), m_vecResources.end());
+				QueueCallback(future, [on_loaded](const std::shared_ptr<IResource>& resource) { on_loaded(std::static_pointer_cast<T>(resource)); });
+			}
+
+			return future;
+		}
+
+		//    ҽ  ۾ 忡 ҷ Ѵ.
+		// ٸ Ƿ ȯ future  Ȳ ȮѴ. (  ٸ ִ.)
+		std::vector<ResourceFuture<IResource>> LoadResourcesFromFiles();
+
+		inline uint32_t GetPendingLoadCount()
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex_loads);
+			return static_cast<uint32_t>(m_PendingLoads.size());
 		}
 
+		//  忡  ӿ ε ݹ ȣϴµ   ִ ð
+		inline void SetCallbackBudgetMS(float budget) { m_CallbackBudgetMS = budget; }
+
+		// ҽ ĳÿ . ٸ   ִ  ״   ִ.
+		// ̵ ãǷ ĳ̵ ڿ ̸̳ ΰ ٲ . ĳ̵Ǿ  ʾҴٸ false
+		template <typename T>
+		bool Remove(const std::shared_ptr<T>& resource)
+		{
+			if (!resource)
+				return false;
+
+			return RemoveByID(resource->GetObjectID());
+		}
+
+		// ŸԺ ޸  (0̸  , Unknown  Ÿ տ  )
+		// ⺻  0̹Ƿ ϱ  ƹ͵  ʴ´.
+		//   ƹ ϰų (IResource::Pin)  ҽ  ȸ   .
+		void SetMemoryBudget(EResourceType type, uint64_t budget_cpu, uint64_t budget_gpu);
+		//  Ѿ  ҽ   GPU ö ҽ CPU 纻  (⺻ false)
+		//  ؽĴ CPU ͸ д (ؽ ,  )   Ƿ ʿ ʿ Ҵ.
+		inline void SetReleaseCpuData(bool release) { m_ReleaseCpuData = release; }
+		sResourceResidency GetResidency(EResourceType type = EResourceType::Unknown);
+		// ҽ ĳ  ȣ (IResource::GetLastUsedFrame Ѵ.)
+		inline uint64_t GetFrame() const { return m_Frame.load(std::memory_order_relaxed); }
+
 		uint64_t GetMemoryUsageCPU(EResourceType type = EResourceType::Unknown);
 		uint64_t GetMemoryUsageGPU(EResourceType type = EResourceType::Unknown);
 		uint32_t GetResourceCount(EResourceType type = EResourceType::Unknown);
@@ -156,15 +281,73 @@ namespace PlayGround
 
 		inline FontImporter* GetFontImporter() const { return m_FontImporter.get(); }
 
+		// Ͱ ҽ  ٽ Ʈ ʵ  صδ ĳ
+		inline DerivedDataCache* GetDerivedDataCache() const { return m_DerivedDataCache.get(); }
+
 	private:
 		bool IsCached(const uint64_t resource_id);
 		bool IsCached(const std::string& resource_name, const EResourceType resource_type);
 
+		// ٽ ҷ ʰ ĳÿ ã´.
+		std::shared_ptr<IResource> FindByName(const std::string& name, EResourceType type);
+		//  ҽ ۾ 忡 ٽ ҷ´.
+		ResourceFuture<IResource> Reload(EResourceType type, const std::string& name, const std::string& path);
+		//   Ÿ ҽ .
+		void EnforceBudgets();
+
+		// ε ߰Ѵ.  ŸԿ  ̸ ̹ ִٸ ִ ҽ ȯѴ.
+		std::shared_ptr<IResource> Insert(const std::shared_ptr<IResource>& resource);
+		// evict ٸ      ٽ ҷ  ֵ θ ܵд.
+		bool RemoveByID(uint64_t resource_id, bool evict = false);
+
+		//  ε û ãų   ۾ 忡 ִ´.
+		std::shared_ptr<sResourceLoadRequest> RequestLoad(const std::string& file_path, std::function<std::shared_ptr<IResource>(const std::string&)>&& load);
+		void QueueCallback(const ResourceFuture<IResource>& future, std::function<void(const std::shared_ptr<IResource>&)>&& callback);
+
 		void SaveResourcesToFiles();
-		void LoadResourcesFromFiles();
 
-		std::vector<std::shared_ptr<IResource>> m_vecResources;
-		std::mutex m_Mutex;
+		struct sResourceEntry
+		{
+			std::shared_ptr<IResource> resource;
+			// ĳ̵ ڿ ҽ ΰ ٲ ε   ֵ Ű   ִ´.
+			std::string name;
+			std::string path;
+		};
+
+		//  Ÿ ҽ (  ҽ ڸ ٲ۴.)
+		struct sResourceBucket
+		{
+			std::vector<sResourceEntry> entries;
+			std::unordered_map<std::string, uint32_t> by_name;
+			std::unordered_map<std::string, uint32_t> by_path;
+			std::unordered_map<uint64_t, uint32_t> by_id;
+			//    ҽ ̸ -> ü  
+			std::unordered_map<std::string, std::string> evicted;
+		};
+
+		std::array<sResourceBucket, RESOURCE_TYPE_COUNT> m_Buckets;
+		// ̵ -> Ÿ
+		std::unordered_map<uint64_t, EResourceType> m_TypeByID;
+		mutable std::shared_mutex m_Mutex;
+
+		//  -> ε û
+		std::unordered_map<std::string, std::shared_ptr<sResourceLoadRequest>> m_PendingLoads;
+		std::mutex m_Mutex_loads;
+
+		struct sLoadCallback
+		{
+			ResourceFuture<IResource> future;
+			std::function<void(const std::shared_ptr<IResource>&)> callback;
+		};
+		std::vector<sLoadCallback> m_vecCallbacks;
+		std::mutex m_Mutex_callbacks;
+		float m_CallbackBudgetMS = 2.0f;
+
+		// ŸԺ  (0(Unknown) ü)
+		std::array<uint64_t, RESOURCE_TYPE_COUNT> m_BudgetCPU = {};
+		std::array<uint64_t, RESOURCE_TYPE_COUNT> m_BudgetGPU = {};
+		bool m_ReleaseCpuData = false;
+		std::atomic<uint64_t> m_Frame = 1;
 
 		std::unordered_map<EResourceDirectory, std::string> m_mapStandard_resource_directories;
 		std::string m_ProjectDirectory;
@@ -172,6 +355,7 @@ namespace PlayGround
 		std::shared_ptr<ModelImporter> m_ModelImporter;
 		std::shared_ptr<ImageImporter> m_ImageImporter;
 		std::shared_ptr<FontImporter> m_FontImporter;
+		std::shared_ptr<DerivedDataCache> m_DerivedDataCache;
 	};
 }
 
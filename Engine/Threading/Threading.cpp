@@ -5,6 +5,9 @@ using namespace std;
 
 namespace PlayGround
 {
+	//  尡   ε (Ŀ ƴ  UINT32_MAX)
+	static thread_local uint32_t t_QueueIndex = UINT32_MAX;
+
 	Threading::Threading(Context* context) : SubModule(context)
 	{
 		m_Stopping = false;
@@ -14,9 +17,21 @@ namespace PlayGround
 		m_ThreadCount = m_ThreadCount_support - 1;
 		m_Thread_names[this_thread::get_id()] = "main";
 
+		//  Ǯ 
+		m_JobPool = make_unique<Job[]>(JOB_POOL_SIZE);
+
+		//   + Ŀ  ŭ  .
+		for (uint32_t i = 0; i < m_ThreadCount + 1; i++)
+		{
+			m_vecQueues.emplace_back(make_unique<WorkStealingQueue>(JOB_POOL_SIZE));
+		}
+
+		//   0  Ѵ.
+		t_QueueIndex = 0;
+
 		for (uint32_t i = 0; i < m_ThreadCount; i++)
 		{
-			m_vecThreads.emplace_back(thread(&Threading::ThreadLoop, this));
+			m_vecThreads.emplace_back(thread(&Threading::ThreadLoop, this, i + 1));
 			m_Thread_names[m_vecThreads.back().get_id()] = "worker_" + to_string(i);
 		}
 
@@ -46,59 +61,316 @@ namespace PlayGround
 		m_vecThreads.clear();
 	}
 
-	uint32_t Threading::GetThreadsAvailable() const
+	JobHandle Threading::CreateTaskGroup(const JobHandle& parent /*= JobHandle()*/)
 	{
-		uint32_t available_threads = m_ThreadCount;
+		Job* job = AllocateJob(parent);
+
+		return JobHandle(job, job->generation.load(memory_order_relaxed));
+	}
+
+	void Threading::Submit(const JobHandle& handle)
+	{
+		Job* job = handle.job;
+
+		if (!job)
+			return;
+
+		//  ִ 尡 ٸ
+		if (m_vecThreads.empty())
+		{
+			LOG_WARNING("No available threads, function will execute in the same thread");
+			//  忡 Ѵ.
+			m_RunningJobs.fetch_add(1);
+			Execute(job);
+			return;
+		}
 
-		for (const auto& task : m_Tasks)
+		//     ø.
+		m_PendingJobs.fetch_add(1);
+
+		// Ŀ   ڽ  ְ ƴ϶ ܺ ť ִ´.
+		const uint32_t index = t_QueueIndex;
+		if (index >= m_vecQueues.size() || !m_vecQueues[index]->Push(job))
 		{
-			available_threads -= task->IsExecuting() ? 1 : 0;
+			lock_guard<mutex> lock(m_Mutex_injected);
+			m_InjectedJobs.push_back(job);
+			m_InjectedCount.fetch_add(1);
 		}
 
-		return available_threads;
+		//  ִ 尡 ִٸ ϳ .
+		if (m_SleepingThreads.load() > 0)
+		{
+			lock_guard<mutex> lock(m_Mutex_tasks);
+			m_Condition_var.notify_one();
+		}
+	}
+
+	bool Threading::IsDone(const JobHandle& handle) const
+	{
+		if (!handle.job)
+			return true;
+
+		//  Ǿٸ ̹  ̴.
+		if (handle.job->generation.load(memory_order_acquire) != handle.generation)
+			return true;
+
+		return handle.job->unfinished.load(memory_order_acquire) == 0;
+	}
+
+	void Threading::Wait(const JobHandle& handle)
+	{
+		while (!IsDone(handle))
+		{
+			// ٸ  ٸ   óѴ.
+			if (!ExecutePendingJob())
+				this_thread::yield();
+		}
+	}
+
+	uint32_t Threading::GetThreadsAvailable() const
+	{
+		const uint32_t running = static_cast<uint32_t>(max(m_RunningJobs.load(), 0));
+
+		return running >= m_ThreadCount ? 0 : m_ThreadCount - running;
 	}
 
 	void Threading::Flush(bool remove_queued /*= false*/)
 	{
-		// ½ũ Ŭ
+		//    ʰ .
 		if (remove_queued)
-			m_Tasks.clear();
+		{
+			while (Job* job = GetJob())
+			{
+				if (job->destroy)
+					job->destroy(job->storage);
+
+				job->invoke = nullptr;
+				job->destroy = nullptr;
+
+				m_RunningJobs.fetch_sub(1);
+				Finish(job);
+			}
+		}
 
-		//   ư ִ 尡 ÿ  
+		//   ư ִ 尡 ÿ 
 		while (AreTasksRunning())
 		{
-			std::this_thread::sleep_for(std::chrono::milliseconds(16));
+			// ִ  ִٸ  óѴ.
+			if (!ExecutePendingJob())
+				this_thread::yield();
 		}
 	}
 
 	//  
-	void Threading::ThreadLoop()
+	void Threading::ThreadLoop(uint32_t queue_index)
 	{
-		shared_ptr<Task> task;
+		t_QueueIndex = queue_index;
 
 		while (true)
 		{
+			//  ϳ  Ѵ.
+			if (Job* job = GetJob())
+			{
+				Execute(job);
+				continue;
+			}
+
+			// ٷ  ʰ  纸ϸ鼭 ο  ٸ.
+			bool found = false;
+			for (uint32_t i = 0; i < 64 && !found; i++)
+			{
+				this_thread::yield();
+				found = m_PendingJobs.load(memory_order_relaxed) > 0;
+			}
+
+			if (found)
+				continue;
+
 			// 
 			unique_lock<mutex> lock(m_Mutex_tasks);
 
+			m_SleepingThreads.fetch_add(1);
+
 			// 尡 ߷ ϰų ½ũ ٸ ٸ.
 			m_Condition_var.wait(lock, [this] {
-				return !m_Tasks.empty() || m_Stopping;
+				return m_PendingJobs.load() > 0 || m_Stopping;
 			});
 
+			m_SleepingThreads.fetch_sub(1);
+
 			//   
-			if (m_Stopping && m_Tasks.empty())
+			if (m_Stopping && m_PendingJobs.load() <= 0)
 				return;
+		}
+	}
+
+	Job* Threading::AllocateJob(const JobHandle& parent)
+	{
+		// 帶 ٸ ġ   ã Ѵ.
+		static thread_local uint32_t cursor = static_cast<uint32_t>(hash<thread::id>{}(this_thread::get_id()));
+
+		while (true)
+		{
+			for (uint32_t i = 0; i < JOB_POOL_SIZE; i++)
+			{
+				Job& job = m_JobPool[(cursor++) & (JOB_POOL_SIZE - 1)];
+
+				bool expected = false;
+				if (job.used.load(memory_order_relaxed) || !job.used.compare_exchange_strong(expected, true, memory_order_acquire))
+					continue;
+
+				job.invoke = nullptr;
+				job.destroy = nullptr;
+				job.parent = nullptr;
+				job.unfinished.store(1, memory_order_relaxed);
 
-			// ½ũ ϳ .
-			task = m_Tasks.front();
+				// θ   ʾҴٸ ڽ Ѵ.
+				if (parent.job)
+				{
+					if (AttachToParent(parent))
+						job.parent = parent.job;
+					else
+						LOG_WARNING("Parent job has already finished");
+				}
 
-			m_Tasks.pop_front();
+				return &job;
+			}
 
-			lock.unlock();
+			// Ǯ  áٸ ٸ  óϸ鼭 ڸ  ٸ.
+			//   ⸸ Ǯ  áٸ ڸ  Ƿ ѹ Ѵ.
+			static thread_local bool warned = false;
+			if (!warned)
+			{
+				LOG_WARNING("Job pool is full (%u live jobs), waiting for jobs to finish", JOB_POOL_SIZE);
+				warned = true;
+			}
 
-			// ½ũ 
-			task->Execute();
+			if (!ExecutePendingJob())
+				this_thread::yield();
 		}
 	}
+
+	bool Threading::AttachToParent(const JobHandle& parent)
+	{
+		Job* job = parent.job;
+
+		//   (unfinished > 0) īƮ ø.
+		// Ȯ  fetch_add ϸ  ̿ θ    ִ.
+		int32_t unfinished = job->unfinished.load(memory_order_acquire);
+		while (true)
+		{
+			if (unfinished <= 0 || job->generation.load(memory_order_acquire) != parent.generation)
+				return false;
+
+			if (job->unfinished.compare_exchange_weak(unfinished, unfinished + 1, memory_order_acq_rel, memory_order_acquire))
+				break;
+		}
+
+		// ø īƮ  ٸ  ̶ ǵ.
+		// īƮ  ִ ȿ    Ƿ 밡 ٸ  θ.
+		if (job->generation.load(memory_order_acquire) != parent.generation)
+		{
+			Finish(job);
+			return false;
+		}
+
+		return true;
+	}
+
+	Job* Threading::GetJob()
+	{
+		const uint32_t index = t_QueueIndex;
+		const uint32_t queue_count = static_cast<uint32_t>(m_vecQueues.size());
+		Job* job = nullptr;
+
+		//  ڽ  ȮѴ.
+		if (index < queue_count)
+			job = m_vecQueues[index]->Pop();
+
+		// ܺ 忡   ȮѴ.
+		if (!job && m_InjectedCount.load(memory_order_relaxed) > 0)
+		{
+			lock_guard<mutex> lock(m_Mutex_injected);
+
+			if (!m_InjectedJobs.empty())
+			{
+				job = m_InjectedJobs.front();
+				m_InjectedJobs.pop_front();
+				m_InjectedCount.fetch_sub(1);
+			}
+		}
+
+		// ٸ   Ŀ´.
+		if (!job)
+		{
+			const uint32_t start = index < queue_count ? index : 0;
+
+			for (uint32_t i = 1; i <= queue_count && !job; i++)
+			{
+				const uint32_t victim = (start + i) % queue_count;
+
+				if (victim == index)
+					continue;
+
+				job = m_vecQueues[victim]->Steal();
+			}
+		}
+
+		//  ->  ű.
+		if (job)
+		{
+			m_RunningJobs.fetch_add(1);
+			m_PendingJobs.fetch_sub(1);
+		}
+
+		return job;
+	}
+
+	void Threading::Execute(Job* job)
+	{
+		// ݹ Լ 
+		if (job->invoke)
+		{
+			job->invoke(job->storage);
+			job->destroy(job->storage);
+		}
+
+		job->invoke = nullptr;
+		job->destroy = nullptr;
+
+		Finish(job);
+
+		// ۾ 
+		m_RunningJobs.fetch_sub(1);
+	}
+
+	bool Threading::ExecutePendingJob()
+	{
+		Job* job = GetJob();
+
+		if (!job)
+			return false;
+
+		Execute(job);
+
+		return true;
+	}
+
+	void Threading::Finish(Job* job)
+	{
+		// ڽĵ  ִٸ  ڽ  óȴ.
+		if (job->unfinished.fetch_sub(1) - 1 != 0)
+			return;
+
+		Job* parent = job->parent;
+
+		// Ǯ ȯѴ.
+		job->parent = nullptr;
+		job->generation.fetch_add(1, memory_order_release);
+		job->used.store(false, memory_order_release);
+
+		// θ𿡰 
+		if (parent)
+			Finish(parent);
+	}
 }
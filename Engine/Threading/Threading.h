@@ -4,120 +4,182 @@
 #include <thread>
 #include <mutex>
 #include <deque>
+#include <atomic>
+#include <condition_variable>
 #include <unordered_map>
-#include <functional>
+#include <type_traits>
+#include <new>
+#include <cstddef>
 #include "../Log/Logger.h"
 #include "../Core/SubModule.h"
+#include "WorkStealingQueue.h"
 
 
 namespace PlayGround
 {
-	//  Ǯ ߰Ǵ ½ũ
-	class Task
+	//  Ǯ ҴǴ ۾ 
+	// ݹ Լ  Ҵ   ۿ  Ѵ.
+	struct alignas(64) Job
 	{
-	public:
-		typedef std::function<void()> function_type;
+		static constexpr size_t STORAGE_SIZE = 80;
 
-		Task(function_type&& function)
-		{
-			// move semantic ̿
-			m_Function = std::forward<function_type>(function);
-		}
-		
-		// ݹԼ Ѵ.
-		void Execute()
+		typedef void(*function_type)(void*);
+
+		// ݹ Լ  ۿ Ѵ.
+		template <typename Function>
+		void Store(Function&& function)
 		{
-			// ۾ 
-			m_IsExecuting = true;
-			// ݹ Լ 
-			m_Function();
-			// ۾ 
-			m_IsExecuting = false;
+			typedef std::decay_t<Function> function_t;
+
+			// ۿ  ũ ״ 
+			if constexpr (sizeof(function_t) <= STORAGE_SIZE && alignof(function_t) <= alignof(std::max_align_t))
+			{
+				new (storage) function_t(std::forward<Function>(function));
+				invoke = [](void* data) { (*static_cast<function_t*>(data))(); };
+				destroy = [](void* data) { static_cast<function_t*>(data)->~function_t(); };
+			}
+			// ʹ ū ĸó ¿    Ѵ.
+			else
+			{
+				*reinterpret_cast<function_t**>(storage) = new function_t(std::forward<Function>(function));
+				invoke = [](void* data) { (**static_cast<function_t**>(data))(); };
+				destroy = [](void* data) { delete *static_cast<function_t**>(data); };
+			}
 		}
 
-		inline bool IsExecuting() const { return m_IsExecuting; }
+		function_type invoke = nullptr;
+		function_type destroy = nullptr;
+		// θ  (ڽ   θ .)
+		Job* parent = nullptr;
+		// ڱ ڽ +   ڽ 
+		std::atomic<int32_t> unfinished = 0;
+		//   ϸ ڵ ȿ ǴѴ.
+		std::atomic<uint32_t> generation = 0;
+		// Ǯ  
+		std::atomic<bool> used = false;
+		alignas(std::max_align_t) unsigned char storage[STORAGE_SIZE];
+	};
+
+	//  ٸų θ   ϴ ڵ
+	struct JobHandle
+	{
+		JobHandle() = default;
+		JobHandle(Job* job, uint32_t generation) : job(job), generation(generation) {}
 
-	private:
-		bool m_IsExecuting = false;
-		function_type m_Function;
+		inline bool IsValid() const { return job != nullptr; }
+
+		Job* job = nullptr;
+		uint32_t generation = 0;
 	};
 
 	//  ӹ޴  Ŭ
+	// 帶 ۾ ġ       ٸ  ۾ Ŀ´.
 	class Threading : public SubModule
 	{
 	public:
 		Threading(Context* context);
 		~Threading();
 
+		// Ʈ Ƿ  ׷   ʴ´.
+		bool RegisterFrameStages(FrameGraph& graph, ETickType tick_group) override { return true; }
+
 		// Function ½ũ ߰Ѵ.
+		// θ ڵ ־ θ  ½ũ   ʴ´.
 		template <typename Function>
-		void AddTask(Function&& function)
+		JobHandle AddTask(Function&& function, const JobHandle& parent = JobHandle())
 		{
-			//  ִ 尡 ٸ
-			if (m_vecThreads.empty())
-			{
-				LOG_WARNING("No available threads, function will execute in the same thread");
-				//  忡 Ѵ.
-				function();
-				return;
-			}
-
-			// 
-			std::unique_lock<std::mutex> lock(m_Mutex_tasks);
+			JobHandle handle = CreateTask(std::forward<Function>(function), parent);
+			Submit(handle);
 
-			// ½ũ ߰Ѵ.
-			m_Tasks.push_back(std::make_shared<Task>(std::bind(std::forward<Function>(function))));
+			return handle;
+		}
 
-			//  
-			lock.unlock();
+		// ½ũ  ϰ  Submit ȣҶ Ѵ.
+		// ڽ ½ũ      Ѵ.
+		template <typename Function>
+		JobHandle CreateTask(Function&& function, const JobHandle& parent = JobHandle())
+		{
+			Job* job = AllocateJob(parent);
+			job->Store(std::forward<Function>(function));
 
-			// 带 .
-			m_Condition_var.notify_one();
+			return JobHandle(job, job->generation.load(std::memory_order_relaxed));
 		}
 
-		// ݺǴ ½ũ  忡  й
+		// ƹ ϵ  ʴ ½ũ .
+		// ڽ ½ũ  ѹ ٸ  Ѵ.
+		JobHandle CreateTaskGroup(const JobHandle& parent = JobHandle());
+
+		//  ½ũ ť ִ´.
+		void Submit(const JobHandle& handle);
+
+		// ½ũ  ȮѴ.
+		bool IsDone(const JobHandle& handle) const;
+
+		// ½ũ( ڽĵ)  ٸ ½ũ  óϸ ٸ.
+		void Wait(const JobHandle& handle);
+
+		// [begin, end)  grain ũ ûũ  鿡 йѴ.
+		// grain 0̶    ڵ Ѵ.
+		// ȣ 嵵  ûũ óϸ  ûũ  ȯ ʴ´.
 		template <typename Function>
-		void AddTaskLoop(Function&& function, uint32_t range)
+		void ParallelFor(uint32_t begin, uint32_t end, uint32_t grain, Function&& function)
 		{
-			//     üũѴ.
-			uint32_t available_threads = GetThreadsAvailable();
-			// ½ũ Ϸ 
-			std::vector<bool> tasks_done = std::vector<bool>(available_threads, false);
-			//    + 1
-			const uint32_t task_count = available_threads + 1;
+			if (begin >= end)
+				return;
 
-			uint32_t start = 0;
-			uint32_t end = 0;
+			const uint32_t range = end - begin;
 
-			for (uint32_t i = 0; i < available_threads; i++)
-			{
-				start = (range / task_count) * i;
-				end = start + (range / task_count);
+			//  ϳ 4  ûũ ư ؼ ۾  δ.
+			if (grain == 0)
+				grain = std::max(1u, range / ((m_ThreadCount + 1) * 4));
 
-				//  
-				AddTask([&function, &tasks_done, i, start, end] {
-					function(start, end);
-					tasks_done[i] = true;
-				});
-			}
+			const uint32_t chunk_count = (range - 1) / grain + 1;
 
-			//  ۾ Ѵ.
-			function(end, range);
+			//  ʿ䰡 ٸ  忡 ٷ Ѵ.
+			if (chunk_count == 1 || m_vecThreads.empty())
+			{
+				function(begin, end);
+				return;
+			}
 
-			uint32_t tasks = 0;
+			//  ó ûũ
+			std::atomic<uint32_t> next_chunk = 0;
 
-			//  ½ũ  ٸ.
-			while (tasks != tasks_done.size())
+			const auto run_chunks = [&]()
 			{
-				tasks = 0;
-
-				//   īƮ ø.
-				for (const bool job_done : tasks_done)
+				uint32_t chunk = 0;
+				while ((chunk = next_chunk.fetch_add(1, std::memory_order_relaxed)) < chunk_count)
 				{
-					tasks += job_done ? 1 : 0;
+					// ū  grain  32Ʈ  ʵ 64Ʈ ϰ end ڸ.
+					const uint64_t offset = static_cast<uint64_t>(chunk) * grain;
+					const uint32_t chunk_begin = static_cast<uint32_t>(std::min<uint64_t>(begin + offset, end));
+					const uint32_t chunk_end = static_cast<uint32_t>(std::min<uint64_t>(static_cast<uint64_t>(chunk_begin) + grain, end));
+
+					function(chunk_begin, chunk_end);
 				}
+			};
 
-				std::this_thread::sleep_for(std::chrono::milliseconds(16));
+			//  Ŀ ŭ īƮ ٿ ġ Ѵ.
+			const uint32_t helper_count = std::min(m_ThreadCount, chunk_count - 1);
+			std::atomic<uint32_t> helpers_running = helper_count;
+
+			for (uint32_t i = 0; i < helper_count; i++)
+			{
+				AddTask([&run_chunks, &helpers_running]
+				{
+					run_chunks();
+					helpers_running.fetch_sub(1, std::memory_order_release);
+				});
+			}
+
+			// ȣ 嵵  óѴ.
+			run_chunks();
+
+			// ִ    ϹǷ   ٸ  óϸ ٸ.
+			while (helpers_running.load(std::memory_order_acquire) != 0)
+			{
+				if (!ExecutePendingJob())
+					std::this_thread::yield();
 			}
 		}
 
@@ -127,21 +189,53 @@ namespace PlayGround
 
 		uint32_t GetThreadsAvailable() const;
 
-		inline bool AreTasksRunning() const { return GetThreadsAvailable() != GetThreadCount(); }
+		inline bool AreTasksRunning() const { return m_PendingJobs.load() > 0 || m_RunningJobs.load() > 0; }
 
 		void Flush(bool removed_queue = false);
 
 	private:
-		void ThreadLoop();
+		void ThreadLoop(uint32_t queue_index);
+
+		// Ǯ   ´.
+		Job* AllocateJob(const JobHandle& parent);
+		// θ  ʾҴٸ īƮ ø true ȯѴ.
+		bool AttachToParent(const JobHandle& parent);
+		// ť   ´. (ڽ  -> ܺ ť -> ٸ  )
+		Job* GetJob();
+		//  
+		void Execute(Job* job);
+		//   ִٸ ϳ Ѵ.
+		bool ExecutePendingJob();
+		//  Ϸ ó  θ𿡰 Ѵ.
+		void Finish(Job* job);
+
+		//  Ǯ ũ (2 ŵ)
+		// ÿ ִ(  )  ִ ̸ ü    ƴϴ.
+		// Ǯ   AllocateJob    óϸ ڸ ٸǷ
+		// 100 ⵵  ϸ ó Submit  ⸸ Ǯ ä .
+		static constexpr uint32_t JOB_POOL_SIZE = 16384;
 
 		uint32_t m_ThreadCount = 0;
 		uint32_t m_ThreadCount_support = 0;
 		std::vector<std::thread> m_vecThreads;
-		std::deque<std::shared_ptr<Task>> m_Tasks;
+		//  Ǯ
+		std::unique_ptr<Job[]> m_JobPool;
+		// 帶 ϳ (0  )
+		std::vector<std::unique_ptr<WorkStealingQueue>> m_vecQueues;
+		// Ŀ ƴ ܺ 忡 ߰ 
+		std::deque<Job*> m_InjectedJobs;
+		std::mutex m_Mutex_injected;
+		std::atomic<uint32_t> m_InjectedCount = 0;
+		// ť   
+		std::atomic<int32_t> m_PendingJobs = 0;
+		//   
+		std::atomic<int32_t> m_RunningJobs = 0;
+		//  ִ Ŀ 
+		std::atomic<uint32_t> m_SleepingThreads = 0;
 		std::mutex m_Mutex_tasks;
 		std::condition_variable m_Condition_var;
 		std::unordered_map<std::thread::id, std::string> m_Thread_names;
-		bool m_Stopping;
+		std::atomic<bool> m_Stopping;
 	};
 }
 
@@ -0,0 +1,99 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <cstdint>
+
+namespace PlayGround
+{
+	struct Job;
+
+	// Chase-Lev ۾ ġ 
+	//  常 Push/Pop ȣϸ ٸ  Steal ݴ ۾ .
+	// 뷮  Ǯ ũ  Ƿ ũ Ҵ ʿ .
+	class WorkStealingQueue
+	{
+	public:
+		WorkStealingQueue(uint32_t capacity)
+		{
+			// 뷮 2 ŵ̾ Ѵ.
+			m_Capacity = capacity;
+			m_Mask = capacity - 1;
+			m_Buffer = std::make_unique<std::atomic<Job*>[]>(capacity);
+		}
+
+		//  忡 ȣ
+		bool Push(Job* job)
+		{
+			const int64_t bottom = m_Bottom.load(std::memory_order_relaxed);
+			const int64_t top = m_Top.load(std::memory_order_acquire);
+
+			//   áٸ 
+			if (bottom - top >= static_cast<int64_t>(m_Capacity))
+				return false;
+
+			m_Buffer[bottom & m_Mask].store(job, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_release);
+			m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+
+			return true;
+		}
+
+		//  忡 ȣ (LIFO)
+		Job* Pop()
+		{
+			const int64_t bottom = m_Bottom.load(std::memory_order_relaxed) - 1;
+			m_Bottom.store(bottom, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			int64_t top = m_Top.load(std::memory_order_relaxed);
+
+			// ִٸ  ǵ.
+			if (top > bottom)
+			{
+				m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+				return nullptr;
+			}
+
+			Job* job = m_Buffer[bottom & m_Mask].load(std::memory_order_relaxed);
+
+			//  ϳ Ҵٸ ġ  Ѵ.
+			if (top == bottom)
+			{
+				if (!m_Top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+					job = nullptr;
+
+				m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+			}
+
+			return job;
+		}
+
+		// ٸ 忡 ȣ (FIFO)
+		Job* Steal()
+		{
+			int64_t top = m_Top.load(std::memory_order_acquire);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			const int64_t bottom = m_Bottom.load(std::memory_order_acquire);
+
+			if (top >= bottom)
+				return nullptr;
+
+			Job* job = m_Buffer[top & m_Mask].load(std::memory_order_relaxed);
+
+			// ٸ 尡  ٸ 
+			if (!m_Top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+				return nullptr;
+
+			return job;
+		}
+
+		inline bool IsEmpty() const { return m_Bottom.load(std::memory_order_relaxed) <= m_Top.load(std::memory_order_relaxed); }
+
+	private:
+		alignas(64) std::atomic<int64_t> m_Top = 0;
+		alignas(64) std::atomic<int64_t> m_Bottom = 0;
+		std::unique_ptr<std::atomic<Job*>[]> m_Buffer;
+		uint32_t m_Capacity = 0;
+		uint32_t m_Mask = 0;
+	};
+}
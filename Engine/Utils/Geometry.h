@@ -301,4 +301,86 @@ namespace PlayGround::Utility::Geometry
         //     0  .
         CreateCylinder(vertices, indices, 0.0f, radius, height);
     }
+
+    //    [x_begin, x_begin + quad_count_x] x [y_begin, y_begin + quad_count_y]  ؽ ( )
+    // height(x, y)   ǥ ̸  ٱ ̿ ̵ д´.
+    // ؽ ֺ ̸ Ƿ ؽ  ϴ ð .
+    template <typename HeightFunction>
+    static void CreateTerrainGrid(const uint32_t map_width, const uint32_t map_height, const uint32_t x_begin, const uint32_t y_begin, const uint32_t quad_count_x, const uint32_t quad_count_y, const HeightFunction& height, std::vector<RHI_Vertex_PosTexNorTan>* vertices)
+    {
+        using namespace Math;
+
+        // 븻 ؽ ѷ (ִ 6) 븻 ̴.
+        // 簢 (Ʒ , Ʒ ,  ), (Ʒ ,  ,  )   
+        //   1̹Ƿ Ⱑ (a, b)  븻 (-a, 1, -b)̴.
+        for (uint32_t y = 0; y <= quad_count_y; y++)
+        {
+            for (uint32_t x = 0; x <= quad_count_x; x++)
+            {
+                const uint32_t gx = x_begin + x;
+                const uint32_t gy = y_begin + y;
+
+                float slope_x_sum = 0.0f;
+                float slope_z_sum = 0.0f;
+                float face_count = 0.0f;
+
+                const auto accumulate = [&slope_x_sum, &slope_z_sum, &face_count](const float slope_x, const float slope_z)
+                {
+                    slope_x_sum += slope_x;
+                    slope_z_sum += slope_z;
+                    face_count++;
+                };
+
+                const bool has_left = gx > 0;
+                const bool has_right = gx < map_width - 1;
+                const bool has_below = gy > 0;
+                const bool has_above = gy < map_height - 1;
+
+                //  簢 ( ؽ Ʒ  δ.)
+                if (has_above)
+                {
+                    if (has_right)
+                    {
+                        accumulate(height(gx + 1, gy) - height(gx, gy), height(gx, gy + 1) - height(gx, gy));
+                    }
+
+                    if (has_left)
+                    {
+                        accumulate(height(gx, gy) - height(gx - 1, gy), height(gx - 1, gy + 1) - height(gx - 1, gy));
+                        accumulate(height(gx, gy + 1) - height(gx - 1, gy + 1), height(gx, gy + 1) - height(gx, gy));
+                    }
+                }
+
+                // Ʒ 簢 ( ؽ   δ.)
+                if (has_below)
+                {
+                    if (has_right)
+                    {
+                        accumulate(height(gx + 1, gy - 1) - height(gx, gy - 1), height(gx, gy) - height(gx, gy - 1));
+                        accumulate(height(gx + 1, gy) - height(gx, gy), height(gx + 1, gy) - height(gx + 1, gy - 1));
+                    }
+
+                    if (has_left)
+                    {
+                        accumulate(height(gx, gy) - height(gx - 1, gy), height(gx, gy) - height(gx, gy - 1));
+                    }
+                }
+
+                Vector3 normal = Vector3(-slope_x_sum, face_count, -slope_z_sum);
+                normal.Normalize();
+
+                // u x  þǷ źƮ x  ⸦ .
+                Vector3 tangent = Vector3(face_count, slope_x_sum, 0.0f);
+                tangent.Normalize();
+
+                //  ߽ Ѵ.
+                const Vector3 position = Vector3(static_cast<float>(gx) - map_width * 0.5f, height(gx, gy), static_cast<float>(gy) - map_height * 0.5f);
+
+                // ؽĴ 簢 ϳ ݺǹǷ ûũ  ǥ Ἥ ū  е Ѵ.
+                const Vector2 uv = Vector2(static_cast<float>(x), static_cast<float>(quad_count_y - y));
+
+                vertices->emplace_back(position, uv, normal, tangent);
+            }
+        }
+    }
 }
\ No newline at end of file
@@ -0,0 +1,434 @@
+#include "Common.h"
+#include "Animator.h"
+#include "Renderable.h"
+#include "Transform.h"
+#include "../Entity.h"
+#include "../../IO/FileStream.h"
+#include "../../Rendering/Model.h"
+#include "../../Rendering/Mesh.h"
+#include "../../Rendering/Renderer.h"
+#include "../../Rendering/Skinning.h"
+#include "../../Resource/ResourceCache.h"
+#include "../../RHI/RHI_VertexBuffer.h"
+#include <cmath>
+#include <cstring>
+
+using namespace std;
+using namespace PlayGround::Math;
+
+namespace PlayGround
+{
+    Animator::Animator(Context* context, Entity* entity, uint64_t id /*= 0*/) : IComponent(context, entity, id)
+    {
+        REGISTER_ATTRIBUTE_VALUE_VALUE(m_Speed, float);
+        REGISTER_ATTRIBUTE_VALUE_VALUE(m_IsLooping, bool);
+    }
+
+    Animator::~Animator()
+    {
+        ReleaseRenderables();
+        IResource::Repin(m_Model, static_cast<Model*>(nullptr));
+    }
+
+    void Animator::OnRemove()
+    {
+        ReleaseRenderables();
+    }
+
+    void Animator::Update(double delta_time)
+    {
+        if (!m_IsPlaying || m_Current.clip < 0)
+            return;
+
+        const double scaled_delta_time = delta_time * static_cast<double>(m_Speed);
+        AdvanceClip(&m_Current, scaled_delta_time);
+
+        if (m_Previous.clip >= 0)
+        {
+            AdvanceClip(&m_Previous, scaled_delta_time);
+
+            //  ð  ӵ  帥.
+            m_FadeTime += static_cast<float>(delta_time);
+            if (m_FadeTime >= m_FadeDuration)
+            {
+                m_Previous.clip = -1;
+            }
+        }
+
+        // ݺ ʴ Ŭ   ѹ  ϰ .
+        if (!m_IsLooping && m_Previous.clip < 0 && m_Current.time >= m_vecClips[m_Current.clip]->GetDurationSec())
+        {
+            m_IsPlaying = false;
+        }
+
+        m_NeedsEvaluate = true;
+    }
+
+    void Animator::Serialize(FileStream* stream)
+    {
+        // Ŭ θ Ѵ. (Ŭ  ҽ ĳð Ѵ.)
+        vector<string> clip_paths;
+        for (const shared_ptr<Animation>& clip : m_vecClips)
+        {
+            if (clip->HasFilePathNative())
+            {
+                clip_paths.push_back(clip->GetResourceFilePathNative());
+            }
+        }
+
+        stream->Write(static_cast<uint32_t>(clip_paths.size()));
+        for (const string& clip_path : clip_paths)
+        {
+            stream->Write(clip_path);
+        }
+
+        stream->Write(m_Speed);
+        stream->Write(m_IsLooping);
+        stream->Write(m_IsPlaying);
+        stream->Write(GetClipName());
+    }
+
+    void Animator::Deserialize(FileStream* stream)
+    {
+        ResourceCache* resource_cache = m_Context->GetSubModule<ResourceCache>();
+
+        m_vecClips.clear();
+        m_Current.clip = -1;
+        m_Previous.clip = -1;
+
+        const uint32_t clip_count = stream->ReadAs<uint32_t>();
+        for (uint32_t i = 0; i < clip_count; i++)
+        {
+            AddClip(resource_cache->Load<Animation>(stream->ReadAs<string>()));
+        }
+
+        stream->Read(&m_Speed);
+        stream->Read(&m_IsLooping);
+        const bool is_playing = stream->ReadAs<bool>();
+        const string clip_name = stream->ReadAs<string>();
+
+        // Ŭ  ٸ ߰  Ѵ.
+        if (is_playing && !clip_name.empty() && !Play(clip_name))
+        {
+            m_PendingClip = clip_name;
+        }
+
+        m_IsDirty = true;
+    }
+
+    void Animator::AddClip(const shared_ptr<Animation>& clip)
+    {
+        if (!clip)
+            return;
+
+        m_vecClips.push_back(clip);
+
+        if (!m_PendingClip.empty() && clip->GetName() == m_PendingClip)
+        {
+            m_PendingClip.clear();
+            Play(clip->GetName());
+        }
+    }
+
+    bool Animator::Play(const string& clip_name, const float fade_time)
+    {
+        int32_t clip = -1;
+        for (uint32_t i = 0; i < static_cast<uint32_t>(m_vecClips.size()); i++)
+        {
+            if (m_vecClips[i]->GetName() == clip_name)
+            {
+                clip = static_cast<int32_t>(i);
+                break;
+            }
+        }
+
+        if (clip < 0)
+        {
+            LOG_WARNING("\"%s\" doesn't have a clip named \"%s\"", GetEntityName().c_str(), clip_name.c_str());
+            return false;
+        }
+
+        //   Ŭ ִٸ    Ѿ.
+        if (fade_time > 0.0f && m_Current.clip >= 0)
+        {
+            m_Previous = move(m_Current);
+            m_FadeTime = 0.0f;
+            m_FadeDuration = fade_time;
+        }
+        else
+        {
+            m_Previous.clip = -1;
+        }
+
+        BindClip(&m_Current, clip);
+        m_Current.time = 0.0;
+        m_IsPlaying = true;
+        m_NeedsEvaluate = true;
+
+        return true;
+    }
+
+    void Animator::Stop()
+    {
+        m_IsPlaying = false;
+        m_Previous.clip = -1;
+    }
+
+    string Animator::GetClipName() const
+    {
+        return m_Current.clip >= 0 ? m_vecClips[m_Current.clip]->GetName() : string();
+    }
+
+    bool Animator::PrepareEvaluate()
+    {
+        if (m_IsDirty)
+        {
+            CollectRenderables();
+        }
+
+        if (!m_NeedsEvaluate || !m_Model || m_vecSkinned.empty() || !m_Entity->IsActive())
+            return false;
+
+        //   ִٸ  ӿ ٽ ã´.
+        for (sSkinnedRenderable& skinned : m_vecSkinned)
+        {
+            if (skinned.renderable.expired())
+            {
+                m_IsDirty = true;
+                return false;
+            }
+
+            if (!skinned.vertex_buffer)
+            {
+                skinned.vertex_buffer = make_shared<RHI_VertexBuffer>(m_Context->GetSubModule<Renderer>()->GetRhiDevice(), true, "skinned");
+                if (!skinned.vertex_buffer->CreateDynamic<RHI_Vertex_PosTexNorTan>(skinned.vertex_count))
+                {
+                    LOG_ERROR("Failed to create skinned vertex buffer for \"%s\"", GetEntityName().c_str());
+                    skinned.vertex_buffer.reset();
+                    return false;
+                }
+            }
+        }
+
+        m_NeedsEvaluate = false;
+
+        return true;
+    }
+
+    void Animator::Evaluate()
+    {
+        const Skeleton& skeleton = m_Model->GetSkeleton();
+
+        //  ( ̶  Ŭ   Ŭ  Ѵ.)
+        SamplePose(&m_Current, &m_vecPosePositions, &m_vecPoseRotations, &m_vecPoseScales);
+
+        if (m_Previous.clip >= 0 && m_FadeDuration > 0.0f)
+        {
+            SamplePose(&m_Previous, &m_vecBlendPositions, &m_vecBlendRotations, &m_vecBlendScales);
+            Skinning::BlendPose(m_vecBlendPositions, m_vecBlendRotations, m_vecBlendScales, Util::Saturate(m_FadeTime / m_FadeDuration), &m_vecPosePositions, &m_vecPoseRotations, &m_vecPoseScales);
+        }
+
+        Skinning::ComputeBoneMatrices(skeleton, m_vecPosePositions, m_vecPoseRotations, m_vecPoseScales, &m_vecPoseLocal, &m_vecPoseGlobal, &m_vecBoneMatrices);
+
+        for (sSkinnedRenderable& skinned : m_vecSkinned)
+        {
+            SkinRenderable(&skinned);
+        }
+
+        m_NeedsUpload = true;
+    }
+
+    void Animator::Upload()
+    {
+        if (!m_NeedsUpload)
+            return;
+
+        for (sSkinnedRenderable& skinned : m_vecSkinned)
+        {
+            shared_ptr<Renderable> renderable = skinned.renderable.lock();
+            if (!renderable || !skinned.vertex_buffer)
+                continue;
+
+            void* data = skinned.vertex_buffer->Map();
+            if (!data)
+                continue;
+
+            memcpy(data, skinned.vertices.data(), skinned.vertices.size() * sizeof(RHI_Vertex_PosTexNorTan));
+            skinned.vertex_buffer->Unmap();
+
+            if (renderable->GetVertexBuffer() != skinned.vertex_buffer.get())
+            {
+                renderable->SetSkinnedVertexBuffer(skinned.vertex_buffer.get());
+            }
+
+            renderable->SetSkinnedBoundingBox(skinned.aabb);
+        }
+
+        m_NeedsUpload = false;
+    }
+
+    void Animator::CollectRenderables()
+    {
+        ReleaseRenderables();
+        m_vecSkinned.clear();
+        IResource::Repin(m_Model, static_cast<Model*>(nullptr));
+        m_IsDirty = false;
+
+        vector<Transform*> stack = { GetTransform() };
+        while (!stack.empty())
+        {
+            Transform* transform = stack.back();
+            stack.pop_back();
+
+            for (Transform* child : transform->GetChildren())
+            {
+                stack.push_back(child);
+            }
+
+            Renderable* renderable = transform->GetEntity()->GetComponent<Renderable>();
+            Model* model = renderable ? renderable->GeometryModel() : nullptr;
+
+            // ִϸ ϳ ̷ ϳ δ.
+            if (!model || !model->HasSkin() || (m_Model && model != m_Model))
+                continue;
+
+            const vector<sSkinWeight>& weights = model->GetSkinWeights();
+            const uint32_t vertex_offset = renderable->GeometryVertexOffset();
+            const uint32_t vertex_count = renderable->GeometryVertexCount();
+            if (vertex_count == 0 || static_cast<uint64_t>(vertex_offset) + vertex_count > weights.size())
+                continue;
+
+            //   ޽  ʴ´.
+            bool has_weights = false;
+            for (uint32_t i = vertex_offset; i < vertex_offset + vertex_count && !has_weights; i++)
+            {
+                has_weights = Skinning::GetWeightSum(weights[i]) > 0.0f;
+            }
+
+            if (!has_weights)
+                continue;
+
+            // ޽  ƼƼ ̸ ã´. ( 忡 ޽ ̸  Ʒ ƼƼ ִ.)
+            const Skeleton& skeleton = model->GetSkeleton();
+            int32_t mesh_joint = -1;
+            for (Transform* node = transform; node && mesh_joint < 0; node = node->GetParent())
+            {
+                //  Ʈ ƼƼ  ̸ Ƿ Ʈ ̴.
+                mesh_joint = node == GetTransform() ? 0 : skeleton.FindJoint(node->GetEntity()->GetObjectName());
+
+                if (node == GetTransform())
+                    break;
+            }
+
+            if (mesh_joint < 0)
+                continue;
+
+            IResource::Repin(m_Model, model);
+
+            sSkinnedRenderable& skinned = m_vecSkinned.emplace_back();
+            skinned.renderable = renderable->GetSharedPtr<Renderable>();
+            skinned.vertex_offset = vertex_offset;
+            skinned.vertex_count = vertex_count;
+            skinned.mesh_joint = static_cast<uint32_t>(mesh_joint);
+            skinned.vertices.resize(vertex_count);
+        }
+
+        if (!m_Model)
+            return;
+
+        const Skeleton& skeleton = m_Model->GetSkeleton();
+        const uint32_t joint_count = skeleton.GetJointCount();
+
+        m_vecPosePositions.resize(joint_count);
+        m_vecPoseRotations.resize(joint_count);
+        m_vecPoseScales.resize(joint_count);
+        m_vecBlendPositions.resize(joint_count);
+        m_vecBlendRotations.resize(joint_count);
+        m_vecBlendScales.resize(joint_count);
+        m_vecPoseLocal.resize(joint_count);
+        m_vecPoseGlobal.resize(joint_count);
+        m_vecBoneMatrices.resize(skeleton.GetBoneCount());
+        m_vecSkinMatrices.resize(skeleton.GetBoneCount());
+
+        // ä Ű  ٲ  ִ.
+        BindClip(&m_Current, m_Current.clip);
+        BindClip(&m_Previous, m_Previous.clip);
+        m_NeedsEvaluate = true;
+    }
+
+    void Animator::ReleaseRenderables()
+    {
+        // ؽ ۴ ִϸͰ  Ƿ   ۷ ׸ ´.
+        for (sSkinnedRenderable& skinned : m_vecSkinned)
+        {
+            if (shared_ptr<Renderable> renderable = skinned.renderable.lock())
+            {
+                if (renderable->GetVertexBuffer() == skinned.vertex_buffer.get())
+                {
+                    renderable->SetSkinnedVertexBuffer(nullptr);
+                }
+            }
+        }
+    }
+
+    void Animator::BindClip(sClipState* state, const int32_t clip) const
+    {
+        state->clip = clip;
+        state->cursors.clear();
+        state->channel_joints.clear();
+
+        if (clip < 0)
+            return;
+
+        const Animation& animation = *m_vecClips[clip];
+        state->cursors.resize(animation.GetChannelCount());
+
+        if (m_Model)
+        {
+            Skinning::BindChannels(m_Model->GetSkeleton(), animation, &state->channel_joints);
+        }
+        else
+        {
+            state->channel_joints.assign(animation.GetChannelCount(), -1);
+        }
+    }
+
+    void Animator::AdvanceClip(sClipState* state, const double delta_time) const
+    {
+        const double duration = m_vecClips[state->clip]->GetDurationSec();
+        if (duration <= 0.0)
+        {
+            state->time = 0.0;
+            return;
+        }
+
+        state->time += delta_time;
+
+        if (m_IsLooping)
+        {
+            state->time = fmod(state->time, duration);
+            state->time = state->time < 0.0 ? state->time + duration : state->time;
+        }
+        else
+        {
+            state->time = Util::Clamp(0.0, duration, state->time);
+        }
+    }
+
+    void Animator::SamplePose(sClipState* state, vector<Vector3>* positions, vector<Quaternion>* rotations, vector<Vector3>* scales) const
+    {
+        const Animation* clip = state->clip >= 0 ? m_vecClips[state->clip].get() : nullptr;
+        Skinning::SamplePose(m_Model->GetSkeleton(), clip, state->time, state->channel_joints, &state->cursors, positions, rotations, scales);
+    }
+
+    void Animator::SkinRenderable(sSkinnedRenderable* skinned)
+    {
+        // ؽ ޽   Ƿ ε  ޽   ǵ.
+        Skinning::ComputeSkinMatrices(m_Model->GetSkeleton(), m_vecBoneMatrices, skinned->mesh_joint, &m_vecSkinMatrices);
+
+        const vector<RHI_Vertex_PosTexNorTan>& vertices = m_Model->GetMesh()->GetVertices();
+        const vector<sSkinWeight>& weights = m_Model->GetSkinWeights();
+
+        Skinning::SkinVertices(m_vecSkinMatrices.data(), &weights[skinned->vertex_offset], &vertices[skinned->vertex_offset], skinned->vertices.data(), skinned->vertex_count, &skinned->aabb);
+    }
+}
@@ -0,0 +1,128 @@
+#pragma once
+
+#include "IComponent.h"
+#include <vector>
+#include "../../Math/Matrix.h"
+#include "../../Math/BoundingBox.h"
+#include "../../Rendering/Animation.h"
+#include "../../RHI/RHI_Definition.h"
+#include "../../RHI/RHI_Vertex.h"
+
+namespace PlayGround
+{
+	class Model;
+	class Renderable;
+
+	// ִϸͰ Űϴ  ϳ
+	struct sSkinnedRenderable
+	{
+		std::weak_ptr<Renderable> renderable;
+		//  ؽ    
+		uint32_t vertex_offset = 0;
+		uint32_t vertex_count = 0;
+		// ޽   (޽ ؽ    ִ.)
+		uint32_t mesh_joint = 0;
+		//  ؽ  ڽ (۾ 忡 ä  忡 ø.)
+		std::vector<RHI_Vertex_PosTexNorTan> vertices;
+		Math::BoundingBox aabb;
+		std::shared_ptr<RHI_VertexBuffer> vertex_buffer;
+	};
+
+	// ̷Ż ִϸ̼ Ʈ
+	// Ŭ øؼ    Ʒ  Ų  ؽ Ѵ.
+	//  ƼƼ Ʈ ǵ帮 Ƿ  ĳ͵ Ʈ    ʴ´.
+	class Animator : public IComponent
+	{
+	public:
+		Animator(Context* context, Entity* entity, uint64_t id = 0);
+		~Animator();
+
+		// IComponent  ޼ ̵
+		void OnRemove() override;
+		void Update(double delta_time) override;
+		void Serialize(FileStream* stream) override;
+		void Deserialize(FileStream* stream) override;
+
+		void AddClip(const std::shared_ptr<Animation>& clip);
+		inline const std::vector<std::shared_ptr<Animation>>& GetClips() const { return m_vecClips; }
+
+		// ̸ Ŭ Ѵ. fade_time()   Ŭ  Ѿ.
+		bool Play(const std::string& clip_name, float fade_time = 0.0f);
+		void Stop();
+		inline bool IsPlaying() const { return m_IsPlaying; }
+		std::string GetClipName() const;
+
+		inline float GetSpeed() const { return m_Speed; }
+		inline void SetSpeed(float speed) { m_Speed = speed; }
+
+		inline bool GetLooping() const { return m_IsLooping; }
+		inline void SetLooping(bool looping) { m_IsLooping = looping; }
+
+		//  ٲ  Ų  ٽ ã Ѵ.
+		inline void SetDirty() { m_IsDirty = true; }
+
+		//  Ű ܰ (World::UpdateAnimators)
+		//  : Ų  ؽ ۸ غѴ. ̹ ӿ   ٸ false
+		bool PrepareEvaluate();
+		// ۾ :  øϰ ؽ Ѵ. ִϸͳ ϴ ¸  ʴ´.
+		void Evaluate();
+		//  :  ؽ ؽ ۿ ø  ڽ Ѵ.
+		void Upload();
+
+	private:
+		//   Ŭ ϳ
+		struct sClipState
+		{
+			int32_t clip = -1;
+			// 
+			double time = 0.0;
+			std::vector<sAnimationCursor> cursors;
+			// ä ->  (̷濡   -1)
+			std::vector<int32_t> channel_joints;
+		};
+
+		// Ʒ  Ų  ã´.
+		void CollectRenderables();
+		//  ٽ  ؽ ۷ ׸ Ѵ.
+		void ReleaseRenderables();
+		void BindClip(sClipState* state, int32_t clip) const;
+		void AdvanceClip(sClipState* state, double delta_time) const;
+		// ε   Ŭ øѴ.
+		void SamplePose(sClipState* state, std::vector<Math::Vector3>* positions, std::vector<Math::Quaternion>* rotations, std::vector<Math::Vector3>* scales) const;
+		void SkinRenderable(sSkinnedRenderable* skinned);
+
+		std::vector<std::shared_ptr<Animation>> m_vecClips;
+		sClipState m_Current;
+		sClipState m_Previous;
+		float m_FadeTime = 0.0f;
+		float m_FadeDuration = 0.0f;
+		float m_Speed = 1.0f;
+		bool m_IsLooping = true;
+		bool m_IsPlaying = false;
+		bool m_IsDirty = true;
+		//     ٲ
+		bool m_NeedsEvaluate = true;
+		bool m_NeedsUpload = false;
+		// ҷ   Ŭ (Ŭ    ִ.)
+		std::string m_PendingClip;
+
+		// ̷   (Ų  ,  ִ  Ѵ.)
+		Model* m_Model = nullptr;
+		std::vector<sSkinnedRenderable> m_vecSkinned;
+
+		//   ()
+		std::vector<Math::Vector3> m_vecPosePositions;
+		std::vector<Math::Quaternion> m_vecPoseRotations;
+		std::vector<Math::Vector3> m_vecPoseScales;
+		//    Ŭ 
+		std::vector<Math::Vector3> m_vecBlendPositions;
+		std::vector<Math::Quaternion> m_vecBlendRotations;
+		std::vector<Math::Vector3> m_vecBlendScales;
+		//  ,   
+		std::vector<Math::Matrix> m_vecPoseLocal;
+		std::vector<Math::Matrix> m_vecPoseGlobal;
+		//  offset *  ,  ޽    Ų  (ġؼ   д.)
+		std::vector<Math::Matrix> m_vecBoneMatrices;
+		std::vector<Math::Matrix> m_vecSkinMatrices;
+	};
+}
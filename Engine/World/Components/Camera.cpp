@@ -4,6 +4,7 @@
 #include "Renderable.h"
 #include "../Entity.h"
 #include "../World.h"
+#include "../SceneBVH.h"
 #include "../../Input/Input.h"
 #include "../../IO/FileStream.h"
 #include "../../Rendering/Renderer.h"
@@ -155,71 +156,21 @@ namespace PlayGround
         Vector3 ray_direction = ScreenToWorldCoordinates(m_input->GetMousePositionRelativeToEditorViewport(), 1.0f);
         m_ray = Ray(ray_start, ray_direction);
 
-        vector<RayHit> hits;
-        {
-            const auto& entities = m_Context->GetSubModule<World>()->EntityGetAll();
-            for (const auto& entity : entities)
-            {
-                if (!entity->HasComponent<Renderable>())
-                    continue;
-
-                const BoundingBox& aabb = entity->GetComponent<Renderable>()->GetAabb();
-
-                float distance = m_ray.HitDistance(aabb);
-
-                if (distance == Util::INFINITY_)
-                    continue;
-
-                hits.emplace_back(
-                    entity,                                             
-                    m_ray.GetStart() + m_ray.GetDirection() * distance, 
-                    distance,                                         
-                    distance == 0.0f                                    
-                );
-            }
-
-            std::sort(hits.begin(), hits.end(), [](const RayHit& a, const RayHit& b) { return a.m_Distance < b.m_Distance; });
-        }
+        // BVH ڽ   ﰢ ˻ϰ ̹ ã ͺ  ڽ ǳʶڴ.
+        // ﰢ   BVH   ˻Ѵ.
+        const SceneBVH* bvh = m_Context->GetSubModule<World>()->GetSceneBVH();
 
-        if (hits.empty())
-            return false;
-
-        if (hits.size() == 1)
+        Entity* closest = bvh->RayCast(m_ray, [this](Entity* entity, float box_distance)
         {
-            picked = hits.front().m_Entity;
-            return true;
-        }
+            Renderable* renderable = entity->GetRenderable();
 
-        float distance_min = numeric_limits<float>::max();
-        for (RayHit& hit : hits)
-        {
-            Renderable* renderable = hit.m_Entity->GetRenderable();
-            vector<uint32_t> indicies;
-            vector<RHI_Vertex_PosTexNorTan> vertices;
-            renderable->GeometryGet(&indicies, &vertices);
-            if (indicies.empty() || vertices.empty())
-            {
-                LOG_ERROR("Failed to get geometry of entity %s, skipping intersection test.");
-                continue;
-            }
-
-            Matrix vertex_transform = hit.m_Entity->GetTransform()->GetMatrix();
-
-            for (uint32_t i = 0; i < indicies.size(); i += 3)
-            {
-                Vector3 p1_world = Vector3(vertices[indicies[i]].pos) * vertex_transform;
-                Vector3 p2_world = Vector3(vertices[indicies[i + 1]].pos) * vertex_transform;
-                Vector3 p3_world = Vector3(vertices[indicies[i + 2]].pos) * vertex_transform;
+            return renderable ? renderable->RayCast(m_ray) : Util::INFINITY_;
+        });
 
-                float distance = m_ray.HitDistance(p1_world, p2_world, p3_world);
+        if (!closest)
+            return false;
 
-                if (distance < distance_min)
-                {
-                    picked = hit.m_Entity;
-                    distance_min = distance;
-                }
-            }
-        }
+        picked = closest->GetSharedPtr();
 
         return picked != nullptr;
     }
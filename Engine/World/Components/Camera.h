@@ -80,6 +80,7 @@ namespace PlayGround
 
         bool IsInViewFrustum(Renderable* renderable) const;
         bool IsInViewFrustum(const Math::Vector3& center, const Math::Vector3& extents) const;
+        inline const Math::Frustum& GetFrustum() const { return m_frustum; }
 
         inline const Math::Vector4& GetClearColor() const { return m_clear_color; }
         inline void SetClearColor(const Math::Vector4& color) { m_clear_color = color; }
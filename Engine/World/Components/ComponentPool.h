@@ -0,0 +1,112 @@
+#pragma once
+
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <cstddef>
+
+namespace PlayGround
+{
+	// T ϳ   ûũ  Ҵصΰ ִ Ǯ
+	// ŸԸ Ǯ  Ƿ  Ÿ Ʈ鸸  ûũ ̰ Ʈ  Ҵ  ʴ´.
+	// (ũⰡ  ٸ Ÿ԰ ûũ   ʴ´.)
+	// ûũ Ǯ   ǹǷ  ּҴ ٲ ʴ´.
+	template <typename T>
+	class ComponentPool
+	{
+	public:
+		static constexpr size_t BLOCKS_PER_CHUNK = 64;
+
+		static ComponentPool& Get()
+		{
+			static ComponentPool instance;
+			return instance;
+		}
+
+		void* Allocate()
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+
+			// ִ  ٸ ûũ ϳ  .
+			if (!m_FreeList)
+			{
+				m_vecChunks.emplace_back(std::make_unique<Block[]>(BLOCKS_PER_CHUNK));
+				Block* chunk = m_vecChunks.back().get();
+
+				for (size_t i = 0; i < BLOCKS_PER_CHUNK; i++)
+				{
+					chunk[i].next = i + 1 < BLOCKS_PER_CHUNK ? &chunk[i + 1] : nullptr;
+				}
+
+				m_FreeList = chunk;
+			}
+
+			Block* block = m_FreeList;
+			m_FreeList = block->next;
+
+			return block->storage;
+		}
+
+		void Deallocate(void* pointer)
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+
+			Block* block = reinterpret_cast<Block*>(pointer);
+			block->next = m_FreeList;
+			m_FreeList = block;
+		}
+
+	private:
+		ComponentPool() = default;
+
+		union Block
+		{
+			Block* next;
+			alignas(T) unsigned char storage[sizeof(T)];
+		};
+
+		std::vector<std::unique_ptr<Block[]>> m_vecChunks;
+		Block* m_FreeList = nullptr;
+		std::mutex m_Mutex;
+	};
+
+	// std::allocate_shared Ѱܼ Ʈ   Բ Ǯ Ҵϴ Ҵ
+	// allocate_shared   Ÿ εؼ ҴϹǷ T Ʈ ٸ   Ÿ ȴ.
+	template <typename T>
+	class ComponentAllocator
+	{
+	public:
+		typedef T value_type;
+
+		ComponentAllocator() = default;
+
+		template <typename U>
+		ComponentAllocator(const ComponentAllocator<U>&) {}
+
+		T* allocate(size_t count)
+		{
+			// allocate_shared ׻ ϳ ҴѴ.
+			if (count != 1)
+				return static_cast<T*>(::operator new(count * sizeof(T)));
+
+			return static_cast<T*>(ComponentPool<T>::Get().Allocate());
+		}
+
+		void deallocate(T* pointer, size_t count)
+		{
+			if (count != 1)
+			{
+				::operator delete(pointer);
+				return;
+			}
+
+			ComponentPool<T>::Get().Deallocate(pointer);
+		}
+
+		template <typename U>
+		inline bool operator==(const ComponentAllocator<U>&) const { return true; }
+
+		template <typename U>
+		inline bool operator!=(const ComponentAllocator<U>&) const { return false; }
+	};
+}
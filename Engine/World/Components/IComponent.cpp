@@ -11,6 +11,7 @@
 #include "Renderable.h"
 #include "Transform.h"
 #include "Terrain.h"
+#include "Animator.h"
 #include "ReflectionProbe.h"
 #include "../Entity.h"
 
@@ -52,4 +53,5 @@ namespace PlayGround
 	REGISTER_COMPONENT(RigidBody, EComponentType::RigidBody)
 	REGISTER_COMPONENT(Environment, EComponentType::Environment)
 	REGISTER_COMPONENT(Transform, EComponentType::Transform)
+	REGISTER_COMPONENT(Animator, EComponentType::Animator)
 }
\ No newline at end of file
@@ -31,9 +31,13 @@ namespace PlayGround
         Transform,
         Terrain,
         ReflectionProbe,
+        Animator,
         Unknown
 	};
 
+    // Ʈ Ÿ 
+    static constexpr uint32_t COMPONENT_TYPE_COUNT = static_cast<uint32_t>(EComponentType::Unknown);
+
     // Ʈ Ӽ Getter, Setter
     struct sAttribute
     {
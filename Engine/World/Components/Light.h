@@ -93,6 +93,7 @@ namespace PlayGround
         void CreateShadowMap();
 
         bool IsInViewFrustum(Renderable* renderable, uint32_t index) const;
+        inline const Math::Frustum& GetFrustum(uint32_t index) const { return m_ShadowMap.slices[index].frustum; }
 
     private:
         void ComputeViewMatrix();
@@ -21,6 +21,7 @@ namespace PlayGround
 
 		// ø 
 		bool IsInViewFrustum(Renderable* renderable, uint32_t index) const;
+		inline const Math::Frustum& GetFrustum(uint32_t index) const { return m_Frustums[index]; }
 
 		inline RHI_Texture* GetColorTexture() { return m_TextureColor.get(); }
 
@@ -1,6 +1,8 @@
 #include "Common.h"
 #include "Renderable.h"
 #include "Transform.h"
+#include "../World.h"
+#include "../Entity.h"
 #include "../../IO/FileStream.h"
 #include "../../Resource/ResourceCache.h"
 #include "../../Utils/Geometry.h"
@@ -82,18 +84,25 @@ namespace PlayGround
         m_cast_shadows = true;
 
         REGISTER_ATTRIBUTE_VALUE_VALUE(m_material_default, bool);
-        REGISTER_ATTRIBUTE_VALUE_VALUE(m_material, Material*);
+        // 𵨰   Űܾ ϹǷ   ٲ ʴ´.
+        RegisterAttribute([this]() { return m_material; }, [this](const any& value) { IResource::Repin(m_material, any_cast<Material*>(value)); });
         REGISTER_ATTRIBUTE_VALUE_VALUE(m_cast_shadows, bool);
         REGISTER_ATTRIBUTE_VALUE_VALUE(m_geometryIndexOffset, uint32_t);
         REGISTER_ATTRIBUTE_VALUE_VALUE(m_geometryIndexCount, uint32_t);
         REGISTER_ATTRIBUTE_VALUE_VALUE(m_geometryVertexOffset, uint32_t);
         REGISTER_ATTRIBUTE_VALUE_VALUE(m_geometryVertexCount, uint32_t);
         REGISTER_ATTRIBUTE_VALUE_VALUE(m_geometryName, string);
-        REGISTER_ATTRIBUTE_VALUE_VALUE(m_model, Model*);
+        RegisterAttribute([this]() { return m_model; }, [this](const any& value) { IResource::Repin(m_model, any_cast<Model*>(value)); });
         REGISTER_ATTRIBUTE_VALUE_VALUE(m_bounding_box, BoundingBox);
         REGISTER_ATTRIBUTE_GET_SET(Geometry_Type, GeometrySet, Geometry_Type);
     }
 
+    Renderable::~Renderable()
+    {
+        IResource::Repin(m_model, static_cast<Model*>(nullptr));
+        IResource::Repin(m_material, static_cast<Material*>(nullptr));
+    }
+
     void Renderable::Serialize(FileStream* stream)
     {
         stream->Write(static_cast<uint32_t>(m_geometry_type));
@@ -122,7 +131,8 @@ namespace PlayGround
         stream->Read(&m_bounding_box);
         string model_name;
         stream->Read(&model_name);
-        m_model = m_Context->GetSubModule<ResourceCache>()->GetByName<Model>(model_name).get();
+        IResource::Repin(m_model, m_Context->GetSubModule<ResourceCache>()->GetByName<Model>(model_name).get());
+        UpdateLods();
 
         if (m_geometry_type != Geometry_Custom)
         {
@@ -139,7 +149,8 @@ namespace PlayGround
         {
             string material_name;
             stream->Read(&material_name);
-            m_material = m_Context->GetSubModule<ResourceCache>()->GetByName<Material>(material_name).get();
+            IResource::Repin(m_material, m_Context->GetSubModule<ResourceCache>()->GetByName<Material>(material_name).get());
+            m_Entity->NotifyRenderStateChanged();
         }
     }
 
@@ -147,7 +158,9 @@ namespace PlayGround
     {
         if (m_geometryName == "Default_Geometry")
         {
-            SAFE_DELETE(m_model);
+            Model* default_model = m_model;
+            IResource::Repin(m_model, static_cast<Model*>(nullptr));
+            SAFE_DELETE(default_model);
         }
 
         m_geometryName = name;
@@ -156,7 +169,12 @@ namespace PlayGround
         m_geometryVertexOffset = vertex_offset;
         m_geometryVertexCount = vertex_count;
         m_bounding_box = bounding_box;
-        m_model = model;
+        IResource::Repin(m_model, model);
+        m_skinned_vertex_buffer = nullptr;
+        UpdateLods();
+
+        // Ʈ ٲǷ  ڽ ٽ ϰ Ѵ.
+        MarkBoundsChanged();
     }
 
     void Renderable::GeometrySet(const Geometry_Type type)
@@ -185,27 +203,115 @@ namespace PlayGround
         m_model->GetGeometry(m_geometryIndexOffset, m_geometryIndexCount, m_geometryVertexOffset, m_geometryVertexCount, indices, vertices);
     }
 
+    void Renderable::SelectLod(const float screen_size)
+    {
+        // LOD ȭ ũⰡ ū ͺ ĵǾ Ƿ غ ۾  LOD .
+        uint32_t lod_index = 0;
+        for (uint32_t i = 0; i < static_cast<uint32_t>(m_lods.size()); i++)
+        {
+            if (screen_size < m_lods[i].screen_size)
+            {
+                lod_index = i + 1;
+            }
+        }
+
+        m_lod_index = lod_index;
+    }
+
+    void Renderable::UpdateLods()
+    {
+        m_lod_index = 0;
+        m_lods.clear();
+
+        if (m_model && m_geometryIndexCount != 0)
+        {
+            m_model->GetLods(m_geometryIndexOffset, &m_lods);
+        }
+    }
+
+    void Renderable::SetSkinnedVertexBuffer(const RHI_VertexBuffer* vertex_buffer)
+    {
+        m_skinned_vertex_buffer = vertex_buffer;
+        MarkBoundsChanged();
+    }
+
+    void Renderable::SetSkinnedBoundingBox(const BoundingBox& bounding_box)
+    {
+        m_skinned_bounding_box = bounding_box;
+        MarkBoundsChanged();
+    }
+
+    void Renderable::MarkBoundsChanged()
+    {
+        m_aabb = BoundingBox();
+
+        // Ʈ ״ο  BVH ڽ ٽ ߰ Ѵ.
+        World* world = m_Context->GetSubModule<World>();
+        if (world && m_Entity)
+            world->SceneProxyMarkDirty(m_Entity);
+    }
+
+    const RHI_VertexBuffer* Renderable::GetVertexBuffer() const
+    {
+        if (m_skinned_vertex_buffer)
+            return m_skinned_vertex_buffer;
+
+        return m_model ? m_model->GetVertexBuffer() : nullptr;
+    }
+
     const BoundingBox& Renderable::GetAabb()
     {
         if (m_last_transform != GetTransform()->GetMatrix() || !m_aabb.Defined())
         {
-            m_aabb = m_bounding_box.Transform(GetTransform()->GetMatrix());
+            // Ų    ڽ øѴ.
+            const BoundingBox& bounding_box = m_skinned_vertex_buffer && m_skinned_bounding_box.Defined() ? m_skinned_bounding_box : m_bounding_box;
+            m_aabb = bounding_box.Transform(GetTransform()->GetMatrix());
             m_last_transform = GetTransform()->GetMatrix();
         }
 
         return m_aabb;
     }
 
+    float Renderable::RayCast(const Ray& ray)
+    {
+        if (!m_model || m_geometryIndexCount == 0)
+            return Util::INFINITY_;
+
+        // Ų ؽ  ٲǷ ε    BVH    ڽ ˻Ѵ.
+        if (IsSkinned())
+            return ray.HitDistance(GetAabb());
+
+        //    ű. ( ̵  ȯǵ   ̷ Ѵ.)
+        const Matrix& world = GetTransform()->GetMatrix();
+        const Matrix world_inverse = Matrix::Invert(world);
+        const Vector3 origin_local = ray.GetStart() * world_inverse;
+        const Vector3 direction_local = (ray.GetStart() + ray.GetDirection()) * world_inverse - origin_local;
+
+        const Ray ray_local = Ray(origin_local, direction_local);
+        const float distance_local = m_model->RayCast(ray_local, m_geometryIndexOffset, m_geometryIndexCount, m_geometryVertexOffset);
+
+        if (distance_local == Util::INFINITY_)
+            return Util::INFINITY_;
+
+        //    Ƿ    Űܼ Ÿ .
+        const Vector3 hit_world = (ray_local.GetStart() + ray_local.GetDirection() * distance_local) * world;
+
+        return Vector3::Distance(ray.GetStart(), hit_world);
+    }
+
     shared_ptr<Material> Renderable::SetMaterial(const shared_ptr<Material>& material)
     {
         ASSERT(material != nullptr);
 
         shared_ptr<Material> _material = m_Context->GetSubModule<ResourceCache>()->Cache(material);
 
-        m_material = _material.get();
+        IResource::Repin(m_material, _material.get());
 
         m_material_default = false;
 
+        //  ΰ ٲ  Ƿ  ˸.
+        m_Entity->NotifyRenderStateChanged();
+
         return _material;
     }
 
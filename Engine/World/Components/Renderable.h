@@ -4,6 +4,7 @@
 #include <vector>
 #include "../../Math/BoundingBox.h"
 #include "../../Math/Matrix.h"
+#include "../../Rendering/MeshOptimizer.h"
 
 namespace PlayGround
 {
@@ -15,6 +16,7 @@ namespace PlayGround
 	namespace Math
 	{
 		class Vector3;
+		class Ray;
 	}
 
 	enum Geometry_Type
@@ -32,7 +34,7 @@ namespace PlayGround
 	{
     public:
         Renderable(Context* context, Entity* entity, uint64_t id = 0);
-        ~Renderable() = default;
+        ~Renderable();
 
         void Serialize(FileStream* stream) override;
         void Deserialize(FileStream* stream) override;
@@ -58,6 +60,28 @@ namespace PlayGround
         inline Model* GeometryModel()                      const { return m_model; }
         inline const Math::BoundingBox& GetBoundingBox()   const { return m_bounding_box; }
         const Math::BoundingBox& GetAabb();
+        //    Ʈ   ﰢ   Ÿ (ٸ INFINITY)
+        //    Űܼ  BVH ˻ϹǷ Ʈ  ʴ´.
+        // Ų  BVH ε ̹Ƿ    ڽ Ÿ ȯѴ.
+        float RayCast(const Math::Ray& ray);
+
+        // LOD (0  Ʈ)
+        //  ũ(ȭ  ) ׸ LOD .
+        void SelectLod(float screen_size);
+        inline uint32_t GetLodIndex()                      const { return m_lod_index; }
+        inline uint32_t GetLodCount()                      const { return static_cast<uint32_t>(m_lods.size()) + 1; }
+        inline uint32_t LodIndexOffset()                   const { return m_lod_index == 0 ? m_geometryIndexOffset : m_lods[m_lod_index - 1].index_offset; }
+        inline uint32_t LodIndexCount()                    const { return m_lod_index == 0 ? m_geometryIndexCount : m_lods[m_lod_index - 1].index_count; }
+
+        // Ű (ִϸͰ Ѵ.)
+        // Ų ۴  Ʈ ؽ Ƿ ؽ  0̴.
+        void SetSkinnedVertexBuffer(const RHI_VertexBuffer* vertex_buffer);
+        //    ڽ ( ڽ ٽ ϰ Ѵ.)
+        void SetSkinnedBoundingBox(const Math::BoundingBox& bounding_box);
+        inline bool IsSkinned()                            const { return m_skinned_vertex_buffer != nullptr; }
+        // ׸   ؽ ۿ 
+        const RHI_VertexBuffer* GetVertexBuffer() const;
+        inline uint32_t GetVertexOffset()                  const { return m_skinned_vertex_buffer ? 0 : m_geometryVertexOffset; }
 
         std::shared_ptr<Material> SetMaterial(const std::shared_ptr<Material>& material);
 
@@ -72,6 +96,11 @@ namespace PlayGround
         inline bool GetCastShadows() const { return m_cast_shadows; }
 
     private:
+        // 𵨿  Ʈ LOD ٽ ´.
+        void UpdateLods();
+        //  ڽ ٲ   ڽ  BVH ٽ ϰ Ѵ.
+        void MarkBoundsChanged();
+
         std::string m_geometryName;
         uint32_t m_geometryIndexOffset;
         uint32_t m_geometryIndexCount;
@@ -80,10 +109,15 @@ namespace PlayGround
         Geometry_Type m_geometry_type;
         Math::BoundingBox m_bounding_box;
         Math::BoundingBox m_aabb;
+        Math::BoundingBox m_skinned_bounding_box;
+        const RHI_VertexBuffer* m_skinned_vertex_buffer = nullptr;
         Math::Matrix m_last_transform = Math::Matrix::Identity;
         bool m_cast_shadows = true;
         bool m_material_default;
+        // ҽ ĳð  ʵ  ִ  Ѵ. (IResource::Repinθ ٲ۴.)
         Model* m_model = nullptr;
         Material* m_material = nullptr;
+        std::vector<sMeshLod> m_lods;
+        uint32_t m_lod_index = 0;
 	};
 }
\ No newline at end of file
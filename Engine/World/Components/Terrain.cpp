@@ -1,6 +1,7 @@
 #include "Common.h"
 #include "Terrain.h"
 #include "Renderable.h"
+#include "Transform.h"
 #include "..\Entity.h"
 #include "..\..\RHI\RHI_Texture2D.h"
 #include "..\..\RHI\RHI_Vertex.h"
@@ -9,12 +10,35 @@
 #include "..\..\Resource\ResourceCache.h"
 #include "..\..\Rendering\Mesh.h"
 #include "..\..\Threading\Threading.h"
+#include "..\..\Utils\Geometry.h"
 
 using namespace std;
 using namespace PlayGround::Math;
 
 namespace PlayGround
 {
+    // LOD ȯ  Ҷ ϴ ȭ  (ȼ)
+    static constexpr float TERRAIN_REFERENCE_SCREEN_HEIGHT = 1080.0f;
+
+    static constexpr uint32_t TERRAIN_CHUNK_SIZE_MIN = 16;
+    static constexpr uint32_t TERRAIN_CHUNK_SIZE_MAX = 512;
+
+    static const string TERRAIN_NODE_NAME = "Terrain_Node";
+    static const string TERRAIN_CHUNK_NAME = "Terrain_Chunk";
+
+    // ̰ length  stride    ġ ( ׻ .)
+    static void lod_samples(const uint32_t length, const uint32_t stride, vector<uint32_t>* samples)
+    {
+        samples->clear();
+
+        for (uint32_t i = 0; i < length; i += stride)
+        {
+            samples->push_back(i);
+        }
+
+        samples->push_back(length);
+    }
+
     Terrain::Terrain(Context* context, Entity* entity, uint64_t id /*= 0*/) : IComponent(context, entity, id)
     {
 
@@ -30,10 +54,13 @@ namespace PlayGround
         const string no_path;
 
         // 
+        // ûũ ƼƼ ڽ ǰ ûũ  ҽ ǹǷ  .
         stream->Write(m_HeightMap ? m_HeightMap->GetResourceFilePathNative() : no_path);
-        stream->Write(m_Model ? m_Model->GetResourceName() : no_path);
         stream->Write(m_MinY);
         stream->Write(m_MaxY);
+        stream->Write(m_ChunkSize);
+        stream->Write(m_LodCount);
+        stream->Write(m_PixelError);
     }
 
     void Terrain::Deserialize(FileStream* stream)
@@ -41,11 +68,16 @@ namespace PlayGround
         // ҷ
         ResourceCache* resource_cache = m_Context->GetSubModule<ResourceCache>();
         m_HeightMap = resource_cache->GetByPath<RHI_Texture2D>(stream->ReadAs<string>());
-        m_Model = resource_cache->GetByName<Model>(stream->ReadAs<string>());
         stream->Read(&m_MinY);
         stream->Read(&m_MaxY);
-
-        UpdateFromModel(m_Model);
+        stream->Read(&m_ChunkSize);
+        stream->Read(&m_LodCount);
+        stream->Read(&m_PixelError);
+
+        // ûũ ƼƼ ڽ  ҷǷ  Ҷ  ٽ .
+        m_vecChunks.clear();
+        m_ChunkCountX = 0;
+        m_ChunkCountY = 0;
     }
 
     void Terrain::SetHeightMap(const shared_ptr<RHI_Texture2D>& height_map)
@@ -54,6 +86,25 @@ namespace PlayGround
         m_HeightMap = m_Context->GetSubModule<ResourceCache>()->Cache<RHI_Texture2D>(height_map);
     }
 
+    void Terrain::SetChunkSize(uint32_t chunk_size)
+    {
+        // LOD  ι øǷ 2 ŵ .
+        chunk_size = Util::Clamp(TERRAIN_CHUNK_SIZE_MIN, TERRAIN_CHUNK_SIZE_MAX, chunk_size);
+
+        uint32_t power_of_two = TERRAIN_CHUNK_SIZE_MIN;
+        while (power_of_two * 2 <= chunk_size)
+        {
+            power_of_two *= 2;
+        }
+
+        m_ChunkSize = power_of_two;
+    }
+
+    void Terrain::SetLodCount(const uint32_t lod_count)
+    {
+        m_LodCount = Util::Clamp(1u, 8u, lod_count);
+    }
+
     void Terrain::GenerateAsync()
     {
         // 񵿱  
@@ -70,42 +121,61 @@ namespace PlayGround
         {
             LOG_WARNING("You need to assign a height map before trying to generate a terrain.");
 
-            //  Ѵ.
-            m_Context->GetSubModule<ResourceCache>()->Remove(m_Model);
-            m_Model.reset();
-
-            Renderable* renderable = m_Entity->AddComponent<Renderable>();
-
-            if (renderable)
-                renderable->GeometryClear();
+            // ûũ Ѵ.
+            RemoveQuadtree();
 
             return;
         }
 
+        // ƼƼ Ʈ  忡 ٲ۴.
+        // ۾  ûũ 𵨸  Ʈ      ۾ ѱ.
+        m_IsGenerating = true;
+
+        World* world = m_Context->GetSubModule<World>();
+        const weak_ptr<Entity> owner = m_Entity->GetSharedPtr();
+        const uint32_t previous_count_x = m_ChunkCountX;
+        const uint32_t previous_count_y = m_ChunkCountY;
+        vector<sTerrainChunk> previous_chunks = m_vecChunks;
+
+        //   ۾     ִ ȮѴ.
+        const auto queue = [this, world, owner](function<void()>&& task)
+        {
+            world->QueueMainThread([this, owner, task = move(task)]()
+            {
+                const shared_ptr<Entity> entity = owner.lock();
+                if (entity && entity->GetComponent<Terrain>() == this)
+                {
+                    task();
+                }
+            });
+        };
+
         //  ߰
-        m_Context->GetSubModule<Threading>()->AddTask([this]()
+        m_Context->GetSubModule<Threading>()->AddTask([this, queue, previous_count_x, previous_count_y, previous_chunks = move(previous_chunks)]() mutable
         {
-            //  
-            m_IsGenerating = true;
+            const auto finish = [this, &queue]()
+            {
+                queue([this]()
+                {
+                    m_Progress_jobs_done = 0;
+                    m_Progress_job_count = 1;
+                    m_ProgressDesc.clear();
+                    m_IsGenerating = false;
+                });
+            };
 
             //   ´.
             vector<std::byte> height_data;
             {
                 height_data = m_HeightMap->GetMip(0, 0).bytes;
 
-                // Ͱ    
+                // Ͱ   
                 if (height_data.empty())
                 {
                     // Ͽ εѴ.
                     if (m_HeightMap->LoadFromFile(m_HeightMap->GetResourceFilePathNative()))
                     {
                         height_data = m_HeightMap->GetMip(0, 0).bytes;
-
-                        if (height_data.empty())
-                        {
-                            LOG_ERROR("Failed to load height map");
-                            return;
-                        }
                     }
                 }
             }
@@ -113,327 +183,404 @@ namespace PlayGround
             //   ´.
             m_Height = m_HeightMap->GetHeight();
             m_Width = m_HeightMap->GetWidth();
-            m_VertexCount = m_Height * m_Width;
-            m_FaceCount = (m_Height - 1) * (m_Width - 1) * 2;
-            m_Progress_jobs_done = 0;
-            m_Progress_job_count = m_VertexCount * 2 + m_FaceCount + m_VertexCount * m_FaceCount;
 
-            // ̸ ޸𸮸 ҴѴ.
-            vector<Vector3> positions = vector<Vector3>(m_Height * m_Width);
-            vector<RHI_Vertex_PosTexNorTan> vertices = vector<RHI_Vertex_PosTexNorTan>(m_VertexCount);
-            vector<uint32_t> indices = vector<uint32_t>(m_FaceCount * 3);
+            const uint64_t pixel_count = static_cast<uint64_t>(m_Width) * m_Height;
 
-            // ҷ ̷ ο  .
-            m_ProgressDesc = "Generating positions...";
-            if (GeneratePositions(positions, height_data))
+            if (height_data.empty() || m_Width < 2 || m_Height < 2 || height_data.size() < pixel_count)
             {
-                // ؽ ε Ѵ.
-                m_ProgressDesc = "Generating terrain vertices and indices...";
-                if (GenerateVerticesIndices(positions, indices, vertices))
-                {
-                    m_ProgressDesc = "Generating normals and tangents...";
-                    positions.clear();
-                    positions.shrink_to_fit();
+                LOG_ERROR("Failed to load height map");
+                finish();
+                return;
+            }
+
+            // ù° ä ̷ .
+            const uint32_t bytes_per_pixel = static_cast<uint32_t>(height_data.size() / pixel_count);
+
+            // ûũ ġ ٲٸ Ʈ ٽ .
+            const uint32_t chunk_count_x = (m_Width - 2) / m_ChunkSize + 1;
+            const uint32_t chunk_count_y = (m_Height - 2) / m_ChunkSize + 1;
+            const uint32_t chunk_count = chunk_count_x * chunk_count_y;
+
+            // ۾  ûũ ( )
+            vector<sTerrainChunk> chunks = move(previous_chunks);
 
-                    // 븻 ϰ ġ  ε巴Ѵ.
-                    if (GenerateNormalTangents(indices, vertices))
+            if (chunk_count_x != previous_count_x || chunk_count_y != previous_count_y || chunks.size() != chunk_count)
+            {
+                chunks.assign(chunk_count, sTerrainChunk());
+                for (uint32_t y = 0; y < chunk_count_y; y++)
+                {
+                    for (uint32_t x = 0; x < chunk_count_x; x++)
                     {
-                        //  ؽ ε  .
-                        UpdateFromVertices(indices, vertices);
+                        chunks[y * chunk_count_x + x].x = x;
+                        chunks[y * chunk_count_x + x].y = y;
                     }
                 }
+
+                queue([this, chunk_count_x, chunk_count_y, layout = chunks]()
+                {
+                    RemoveQuadtree();
+
+                    m_ChunkCountX = chunk_count_x;
+                    m_ChunkCountY = chunk_count_y;
+                    m_vecChunks = layout;
+
+                    CreateQuadtree(m_Entity->GetTransform(), 0, 0, chunk_count_x, chunk_count_y, 0);
+                });
             }
 
-            // ۾ Ϸ
             m_Progress_jobs_done = 0;
-            m_Progress_job_count = 1;
-            m_ProgressDesc.clear();
+            m_Progress_job_count = chunk_count;
+            m_ProgressDesc = "Generating terrain chunks...";
+
+            //     ۾ 忡 ش.
+            //     ѱǷ ū    δ.
+            Threading* threading = m_Context->GetSubModule<Threading>();
+            const uint32_t batch_size = (threading->GetThreadCount() + 1) * 2;
+
+            for (uint32_t batch_begin = 0; batch_begin < chunk_count; batch_begin += batch_size)
+            {
+                const uint32_t batch_end = min(batch_begin + batch_size, chunk_count);
+
+                threading->ParallelFor(batch_begin, batch_end, 1, [this, &chunks, &height_data, bytes_per_pixel](uint32_t begin, uint32_t end)
+                {
+                    for (uint32_t i = begin; i < end; i++)
+                    {
+                        GenerateChunk(chunks[i], height_data, bytes_per_pixel);
+                        m_Progress_jobs_done++;
+                    }
+                });
 
-            m_IsGenerating = false;
+                queue([this, batch_begin, batch = vector<sTerrainChunk>(chunks.begin() + batch_begin, chunks.begin() + batch_end)]()
+                {
+                    for (uint32_t i = 0; i < static_cast<uint32_t>(batch.size()); i++)
+                    {
+                        //  ̿ ġ ٲٸ ǳʶڴ.
+                        if (batch_begin + i >= m_vecChunks.size())
+                            return;
+
+                        sTerrainChunk& chunk = m_vecChunks[batch_begin + i];
+                        chunk.model = batch[i].model;
+                        chunk.index_count = batch[i].index_count;
+                        chunk.vertex_count = batch[i].vertex_count;
+
+                        UpdateChunkRenderable(chunk);
+                    }
+                });
+            }
+
+            // ۾ Ϸ
+            finish();
         });
     }
 
-    bool Terrain::GeneratePositions(vector<Vector3>& positions, const vector<std::byte>& height_map)
+    void Terrain::CreateQuadtree(Transform* parent, const uint32_t x_begin, const uint32_t y_begin, const uint32_t x_end, const uint32_t y_end, const uint32_t depth)
     {
-        // Ͱ ٸ ȯ
-        if (height_map.empty())
+        World* world = m_Context->GetSubModule<World>();
+
+        //   ûũ ϳ
+        if (x_end - x_begin == 1 && y_end - y_begin == 1)
         {
-            LOG_ERROR("Height map is empty");
-            return false;
+            shared_ptr<Entity> entity = world->EntityCreate();
+            entity->SetName(TERRAIN_CHUNK_NAME + "_" + to_string(x_begin) + "_" + to_string(y_begin));
+            entity->GetTransform()->SetParent(parent);
+
+            m_vecChunks[y_begin * m_ChunkCountX + x_begin].entity = entity;
+
+            return;
         }
 
-        uint32_t k = 0;
+        shared_ptr<Entity> node = world->EntityCreate();
+        node->SetName(TERRAIN_NODE_NAME + "_" + to_string(depth) + "_" + to_string(x_begin) + "_" + to_string(y_begin));
+        node->GetTransform()->SetParent(parent);
+
+        //  װ . (  1̶  δ  ʴ´.)
+        const uint32_t x_middle = x_begin + (x_end - x_begin + 1) / 2;
+        const uint32_t y_middle = y_begin + (y_end - y_begin + 1) / 2;
+
+        const uint32_t x_ranges[2][2] = { { x_begin, x_middle }, { x_middle, x_end } };
+        const uint32_t y_ranges[2][2] = { { y_begin, y_middle }, { y_middle, y_end } };
 
-        for (uint32_t y = 0; y < m_Height; y++)
+        for (uint32_t j = 0; j < 2; j++)
         {
-            for (uint32_t x = 0; x < m_Width; x++)
+            for (uint32_t i = 0; i < 2; i++)
             {
-                // ̼ġ ϰ Ѵ.
-                const float height = (static_cast<float>(height_map[k]) / 255.0f);
-
-                // ε 
-                const uint32_t index = y * m_Width + x;
-                //  ߽ Ѵ.
-                positions[index].x = static_cast<float>(x) - m_Width * 0.5f;
-                positions[index].z = static_cast<float>(y) - m_Height * 0.5f;
-                // ּġ ִġ  Ѵ.
-                positions[index].y = Util::Lerp(m_MinY, m_MaxY, height);
-
-                // 4 
-                k += 4;
-
-                // īƮ ϳ ÷ش.
-                m_Progress_jobs_done++;
+                if (x_ranges[i][0] == x_ranges[i][1] || y_ranges[j][0] == y_ranges[j][1])
+                    continue;
+
+                CreateQuadtree(node->GetTransform(), x_ranges[i][0], y_ranges[j][0], x_ranges[i][1], y_ranges[j][1], depth + 1);
             }
         }
-
-        return true;
     }
 
-    bool Terrain::GenerateVerticesIndices(const vector<Vector3>& positions, vector<uint32_t>& indices, vector<RHI_Vertex_PosTexNorTan>& vertices)
+    void Terrain::RemoveQuadtree()
     {
-        if (positions.empty())
-        {
-            LOG_ERROR("Positions are empty");
-            return false;
-        }
+        World* world = m_Context->GetSubModule<World>();
 
-        uint32_t index = 0;
-        uint32_t k = 0;
-        uint32_t u_index = 0;
-        uint32_t v_index = 0;
-
-        for (uint32_t y = 0; y < m_Height - 1; y++)
+        // ڰ  ڽ ܵΰ   ƼƼ . (ڽ  .)
+        const vector<Transform*> children = m_Entity->GetTransform()->GetChildren();
+        for (Transform* child : children)
         {
-            for (uint32_t x = 0; x < m_Width - 1; x++)
+            const string& name = child->GetEntity()->GetObjectName();
+
+            if (name.rfind(TERRAIN_NODE_NAME, 0) == 0 || name.rfind(TERRAIN_CHUNK_NAME, 0) == 0)
             {
-                // 4  ġ Ѵ.
-                // Ʒ 
-                const uint32_t index_bottom_left = y * m_Width + x;
-                const uint32_t index_bottom_right = y * m_Width + x + 1;
-                const uint32_t index_top_left = (y + 1) * m_Width + x;
-                const uint32_t index_top_right = (y + 1) * m_Width + x + 1;
-
-                // Ʒ 
-                index = index_bottom_right;
-                indices[k] = index;
-                // UV  Ʒ ̹Ƿ 1, 1
-                vertices[index] = RHI_Vertex_PosTexNorTan(positions[index], Vector2(u_index + 1.0f, v_index + 1.0f));
-
-                // Ʒ 
-                index = index_bottom_left;
-                indices[k + 1] = index;
-                // UV  Ʒ ̹Ƿ 0, 1
-                vertices[index] = RHI_Vertex_PosTexNorTan(positions[index], Vector2(u_index + 0.0f, v_index + 1.0f));
-
-                //  
-                index = index_top_left;
-                indices[k + 2] = index;
-                // UV   ̹Ƿ 0, 0
-                vertices[index] = RHI_Vertex_PosTexNorTan(positions[index], Vector2(u_index + 0.0f, v_index + 0.0f));
-
-                // Ʒ 
-                index = index_bottom_right;
-                indices[k + 3] = index;
-                vertices[index] = RHI_Vertex_PosTexNorTan(positions[index], Vector2(u_index + 1.0f, v_index + 1.0f));
-
-                //  
-                index = index_top_left;
-                indices[k + 4] = index;
-                vertices[index] = RHI_Vertex_PosTexNorTan(positions[index], Vector2(u_index + 0.0f, v_index + 0.0f));
-
-                //  
-                index = index_top_right;
-                indices[k + 5] = index;
-                vertices[index] = RHI_Vertex_PosTexNorTan(positions[index], Vector2(u_index + 1.0f, v_index + 0.0f));
-                
-                //  簢
-                k += 6;
-
-                // 簢 ϳ  u ϳ ÷ش.
-                u_index++;
-
-                // track progress
-                m_Progress_jobs_done++;
+                world->EntityRemove(child->GetEntity()->GetSharedPtr());
             }
-
-            //  Ƿ u ʱȭ v ϳ ÷ش.
-            u_index = 0;
-            v_index++;
         }
 
-        return true;
+        m_vecChunks.clear();
+        m_ChunkCountX = 0;
+        m_ChunkCountY = 0;
     }
 
-    bool Terrain::GenerateNormalTangents(const vector<uint32_t>& indices, vector<RHI_Vertex_PosTexNorTan>& vertices)
+    void Terrain::GenerateChunk(sTerrainChunk& chunk, const vector<std::byte>& height_map, const uint32_t bytes_per_pixel)
     {
-        if (indices.empty())
+        // ûũ     (  ûũ    ִ.)
+        const uint32_t x_begin = chunk.x * m_ChunkSize;
+        const uint32_t y_begin = chunk.y * m_ChunkSize;
+        const uint32_t quad_count_x = min(m_ChunkSize, m_Width - 1 - x_begin);
+        const uint32_t quad_count_y = min(m_ChunkSize, m_Height - 1 - y_begin);
+        const uint32_t row = quad_count_x + 1;
+        const uint32_t grid_vertex_count = row * (quad_count_y + 1);
+
+        //   ǥ  (ּġ ִġ  Ѵ.)
+        const auto height = [this, &height_map, bytes_per_pixel](const uint32_t x, const uint32_t y)
         {
-            LOG_ERROR("Indices are empty");
-            return false;
-        }
+            const uint8_t value = static_cast<uint8_t>(height_map[(static_cast<size_t>(y) * m_Width + x) * bytes_per_pixel]);
+            return Util::Lerp(m_MinY, m_MaxY, static_cast<float>(value) / 255.0f);
+        };
 
-        if (vertices.empty())
+        vector<RHI_Vertex_PosTexNorTan> vertices;
+        vertices.reserve(grid_vertex_count + (row + quad_count_y + 1) * 2);
+
+        // ؽ (̿ ûũ ̵  Ƿ ûũ 迡 븻 ̾.)
+        Utility::Geometry::CreateTerrainGrid(m_Width, m_Height, x_begin, y_begin, quad_count_x, quad_count_y, height, &vertices);
+
+        // LOD  (LOD 0 1)
+        vector<uint32_t> strides = { 1 };
+        for (uint32_t lod = 1; lod < m_LodCount; lod++)
         {
-            LOG_ERROR("Vertices are empty");
-            return false;
-        }
+            //     ŭ  Ŀٸ ׸ .
+            if (strides.back() >= max(quad_count_x, quad_count_y))
+                break;
 
-        //  ؽ  .
-        uint32_t face_count = static_cast<uint32_t>(indices.size()) / 3;
-        uint32_t vertex_count = static_cast<uint32_t>(vertices.size());
+            strides.push_back(1u << lod);
+        }
 
-        //   븻 źƮ Ҵ
-        vector<Vector3> face_normals(face_count);
-        vector<Vector3> face_tangents(face_count);
+        // LOD  ̿ ִ 
+        // ûũ ڸ  ڸ ̸ Ƿ ̿ ûũ   ´.
+        vector<float> errors(strides.size(), 0.0f);
+        float edge_error = 0.0f;
         {
-            //  ŭ ݺѴ.
-            for (uint32_t i = 0; i < face_count; i++)
+            vector<uint32_t> samples_x;
+            vector<uint32_t> samples_y;
+
+            for (uint32_t level = 1; level < static_cast<uint32_t>(strides.size()); level++)
             {
-                Vector3 edge_a;
-                Vector3 edge_b;
+                lod_samples(quad_count_x, strides[level], &samples_x);
+                lod_samples(quad_count_y, strides[level], &samples_y);
 
-                {
-                    //  1 -> 0  
-                    edge_a = Vector3(
-                        vertices[indices[(i * 3)]].pos[0] - vertices[indices[(i * 3) + 1]].pos[0],
-                        vertices[indices[(i * 3)]].pos[1] - vertices[indices[(i * 3) + 1]].pos[1],
-                        vertices[indices[(i * 3)]].pos[2] - vertices[indices[(i * 3) + 1]].pos[2]
-                    );
-
-                    //  2 -> 1 
-                    edge_b = Vector3(
-                        vertices[indices[(i * 3) + 1]].pos[0] - vertices[indices[(i * 3) + 2]].pos[0],
-                        vertices[indices[(i * 3) + 1]].pos[1] - vertices[indices[(i * 3) + 2]].pos[1],
-                        vertices[indices[(i * 3) + 1]].pos[2] - vertices[indices[(i * 3) + 2]].pos[2]
-                    );
-
-                    //   ͸ Ͽ 븻 Ѵ.
-                    face_normals[i] = Vector3::Cross(edge_a, edge_b);
-                }
+                float error = 0.0f;
 
+                for (uint32_t j = 0; j + 1 < static_cast<uint32_t>(samples_y.size()); j++)
                 {
-                    // ؽĿ ù° uv ǥ Ѵ.
-                    const float tcU1 = vertices[indices[(i * 3)]].tex[0] - vertices[indices[(i * 3) + 1]].tex[0];
-                    const float tcV1 = vertices[indices[(i * 3)]].tex[1] - vertices[indices[(i * 3) + 1]].tex[1];
-
-                    // ؽĿ ι° uv ǥ Ѵ.
-                    const float tcU2 = vertices[indices[(i * 3) + 1]].tex[0] - vertices[indices[(i * 3) + 2]].tex[0];
-                    const float tcV2 = vertices[indices[(i * 3) + 1]].tex[1] - vertices[indices[(i * 3) + 2]].tex[1];
-
-                    //   ̿Ͽ źƮ Ѵ.
-                    face_tangents[i].x = (tcV1 * edge_a.x - tcV2 * edge_b.x * (1.0f / (tcU1 * tcV2 - tcU2 * tcV1)));
-                    face_tangents[i].y = (tcV1 * edge_a.y - tcV2 * edge_b.y * (1.0f / (tcU1 * tcV2 - tcU2 * tcV1)));
-                    face_tangents[i].z = (tcV1 * edge_a.z - tcV2 * edge_b.z * (1.0f / (tcU1 * tcV2 - tcU2 * tcV1)));
+                    for (uint32_t i = 0; i + 1 < static_cast<uint32_t>(samples_x.size()); i++)
+                    {
+                        const uint32_t x0 = samples_x[i];
+                        const uint32_t x1 = samples_x[i + 1];
+                        const uint32_t y0 = samples_y[j];
+                        const uint32_t y1 = samples_y[j + 1];
+
+                        const float height_bottom_left = vertices[y0 * row + x0].pos[1];
+                        const float height_bottom_right = vertices[y0 * row + x1].pos[1];
+                        const float height_top_left = vertices[y1 * row + x0].pos[1];
+                        const float height_top_right = vertices[y1 * row + x1].pos[1];
+
+                        for (uint32_t y = y0; y <= y1; y++)
+                        {
+                            for (uint32_t x = x0; x <= x1; x++)
+                            {
+                                const float u = static_cast<float>(x - x0) / static_cast<float>(x1 - x0);
+                                const float v = static_cast<float>(y - y0) / static_cast<float>(y1 - y0);
+
+                                // 밢(Ʒ  -  ) Ʒ     Ѵ.
+                                const float surface = u + v <= 1.0f ?
+                                    height_bottom_left + u * (height_bottom_right - height_bottom_left) + v * (height_top_left - height_bottom_left) :
+                                    height_top_right + (1.0f - u) * (height_top_left - height_top_right) + (1.0f - v) * (height_bottom_right - height_top_right);
+
+                                const float difference = fabsf(vertices[y * row + x].pos[1] - surface);
+                                error = max(error, difference);
+
+                                if (x == 0 || y == 0 || x == quad_count_x || y == quad_count_y)
+                                {
+                                    edge_error = max(edge_error, difference);
+                                }
+                            }
+                        }
+                    }
                 }
+
+                //  LOD  ϰ  ʵ  پ ʰ Ѵ.
+                errors[level] = max(error, errors[level - 1]);
             }
         }
 
-        // 븻 ġ Ѵ.
-        const auto compute_vertex_normals_tangents = [this, &face_normals, &face_tangents, &vertices, &indices, &vertex_count, &face_count](uint32_t i_start, uint32_t i_end)
+        // ĿƮ
+        //  ؽ پ Ʒ  Ѵ.
+        // ̿ ƴ  ڸ    Ƿ ׸ŭ (׸    ܰ踸ŭ ) .
+        const float skirt_depth = edge_error * 2.0f + (m_MaxY - m_MinY) / 255.0f;
+
+        // Ʒ, , ,  
+        const uint32_t edge_lengths[4] = { quad_count_x, quad_count_y, quad_count_x, quad_count_y };
+        uint32_t skirt_offsets[4] = {};
+
+        const auto edge_vertex = [row, quad_count_x, quad_count_y](const uint32_t edge, const uint32_t p)
+        {
+            switch (edge)
+            {
+            case 0:  return p;
+            case 1:  return p * row + quad_count_x;
+            case 2:  return quad_count_y * row + p;
+            default: return p * row;
+            }
+        };
+
+        for (uint32_t edge = 0; edge < 4; edge++)
         {
-            Vector3 normal_sum = Vector3::Zero;
-            Vector3 tangent_sum = Vector3::Zero;
-            float faces_using = 0;
+            skirt_offsets[edge] = static_cast<uint32_t>(vertices.size());
 
-            for (uint32_t i = i_start; i < i_end; ++i)
+            for (uint32_t p = 0; p <= edge_lengths[edge]; p++)
             {
-                for (uint32_t j = 0; j < face_count; ++j)
+                RHI_Vertex_PosTexNorTan vertex = vertices[edge_vertex(edge, p)];
+                vertex.pos[1] -= skirt_depth;
+                vertices.push_back(vertex);
+            }
+        }
+
+        //  stride LOD ε
+        const auto build_indices = [&](const uint32_t stride, vector<uint32_t>* indices)
+        {
+            vector<uint32_t> samples_x;
+            vector<uint32_t> samples_y;
+            lod_samples(quad_count_x, stride, &samples_x);
+            lod_samples(quad_count_y, stride, &samples_y);
+
+            indices->clear();
+
+            for (uint32_t j = 0; j + 1 < static_cast<uint32_t>(samples_y.size()); j++)
+            {
+                for (uint32_t i = 0; i + 1 < static_cast<uint32_t>(samples_x.size()); i++)
                 {
-                    //  ε 
-                    if (indices[j * 3] == i || indices[(j * 3) + 1] == i || indices[(j * 3) + 2] == i)
-                    {
-                        //  ؽ ϳ  ϴ   Ų.
-                        normal_sum += face_normals[j];
-                        tangent_sum += face_tangents[j];
-                        faces_using++;
-                    }
+                    const uint32_t index_bottom_left = samples_y[j] * row + samples_x[i];
+                    const uint32_t index_bottom_right = samples_y[j] * row + samples_x[i + 1];
+                    const uint32_t index_top_left = samples_y[j + 1] * row + samples_x[i];
+                    const uint32_t index_top_right = samples_y[j + 1] * row + samples_x[i + 1];
 
-                    if (j == face_count < 1)
-                    {
-                        m_Progress_jobs_done += face_count;
-                    }
+                    indices->insert(indices->end(), { index_bottom_right, index_bottom_left, index_top_left });
+                    indices->insert(indices->end(), { index_bottom_right, index_top_left, index_top_right });
                 }
+            }
 
-                // ġ ϰ ȭ
-                normal_sum /= faces_using;
-                normal_sum.Normalize();
-
-                // ġ ϰ ȭ
-                tangent_sum /= faces_using;
-                tangent_sum.Normalize();
+            // ĿƮ LOD ڸ ø մ´.
+            // ûũ   ݽð  鼭  ٱ  Ѵ. (,   Ųٷ .)
+            for (uint32_t edge = 0; edge < 4; edge++)
+            {
+                const vector<uint32_t>& samples = (edge % 2 == 0) ? samples_x : samples_y;
+                const bool reverse = edge >= 2;
 
-                // 븻  
-                vertices[i].nor[0] = normal_sum.x;
-                vertices[i].nor[1] = normal_sum.y;
-                vertices[i].nor[2] = normal_sum.z;
+                for (uint32_t i = 0; i + 1 < static_cast<uint32_t>(samples.size()); i++)
+                {
+                    const uint32_t a = reverse ? samples[i + 1] : samples[i];
+                    const uint32_t b = reverse ? samples[i] : samples[i + 1];
 
-                // źƮ  
-                vertices[i].tan[0] = tangent_sum.x;
-                vertices[i].tan[1] = tangent_sum.y;
-                vertices[i].tan[2] = tangent_sum.z;
+                    const uint32_t top_a = edge_vertex(edge, a);
+                    const uint32_t top_b = edge_vertex(edge, b);
+                    const uint32_t bottom_a = skirt_offsets[edge] + a;
+                    const uint32_t bottom_b = skirt_offsets[edge] + b;
 
-                // ʱȭ
-                normal_sum = Vector3::Zero;
-                tangent_sum = Vector3::Zero;
-                faces_using = 0;
+                    indices->insert(indices->end(), { top_a, top_b, bottom_a });
+                    indices->insert(indices->end(), { top_b, bottom_b, bottom_a });
+                }
             }
         };
 
-        //  ߰
-        m_Context->GetSubModule<Threading>()->AddTaskLoop(compute_vertex_normals_tangents, vertex_count);
-
-        return true;
-    }
+        vector<uint32_t> indices;
+        build_indices(strides[0], &indices);
 
-    void Terrain::UpdateFromModel(const shared_ptr<Model>& model) const
-    {
-        ASSERT(model != nullptr);
-
-        //  𵨿 ҷ´.
+        // 𵨿 ִ´.
+        ResourceCache* resource_cache = m_Context->GetSubModule<ResourceCache>();
+        const string name = m_Entity->GetObjectName() + "_terrain_" + to_string(m_ObjectID) + "_" + to_string(chunk.x) + "_" + to_string(chunk.y);
 
-        if (Renderable* renderable = m_Entity->AddComponent<Renderable>())
+        // ҷ   ̸ ûũ  ̹ ĳ̵Ǿ ִ.
+        if (!chunk.model)
         {
-            renderable->GeometrySet(
-                "Terrain",
-                0,
-                model->GetMesh()->IndicesCount(),
-                0,
-                model->GetMesh()->VerticesCount(),
-                model->GetAABB(),
-                model.get()
-            );
+            chunk.model = resource_cache->GetByName<Model>(name);
+        }
 
-            renderable->UseDefaultMaterial();
+        const bool is_new = !chunk.model;
+        if (is_new)
+        {
+            chunk.model = make_shared<Model>(m_Context);
+        }
+        else
+        {
+            chunk.model->Clear();
         }
-    }
 
-    void Terrain::UpdateFromVertices(const vector<uint32_t>& indices, vector<RHI_Vertex_PosTexNorTan>& vertices)
-    {
-        //  ؽκ Ѵ.
+        chunk.model->AppendGeometry(indices, vertices);
+        chunk.index_count = static_cast<uint32_t>(indices.size());
+        chunk.vertex_count = static_cast<uint32_t>(vertices.size());
+
+        // ȭ   ȼ  ϰ Ǵ ȭ ũ LOD .
+        //  ȭ ũ⸦  / (Ÿ * tan(fov / 2)) ϹǷ
+        //  ȼ ũ ȭ ũ *  /  * ȭ  / 2 ̴.
+        const float radius = BoundingBox(vertices.data(), static_cast<uint32_t>(vertices.size())).GetExtents().Length();
+        float previous_screen_size = numeric_limits<float>::max();
 
-        //   
-        if (!m_Model)
+        for (uint32_t level = 1; level < static_cast<uint32_t>(strides.size()); level++)
         {
-            //  .
-            m_Model = make_shared<Model>(m_Context);
+            const float error = max(errors[level], numeric_limits<float>::epsilon());
+            float screen_size = 2.0f * m_PixelError * radius / (error * TERRAIN_REFERENCE_SCREEN_HEIGHT);
 
-            //  ߰
-            m_Model->AppendGeometry(indices, vertices);
-            m_Model->UpdateGeometry();
+            // LOD ȭ ũ ĵǹǷ ϰ پ Ѵ.
+            screen_size = min(screen_size, previous_screen_size * 0.5f);
+            previous_screen_size = screen_size;
 
-            ResourceCache* resource_cache = m_Context->GetSubModule<ResourceCache>();
-            m_Model->SetResourceFilePath(resource_cache->GetProjectDirectory() + m_Entity->GetObjectName() + "_terrain_" + to_string(m_ObjectID) + string(EXTENSION_MODEL));
-            m_Model = resource_cache->Cache(m_Model);
+            build_indices(strides[level], &indices);
+            chunk.model->AppendLod(0, indices, screen_size);
         }
-        else
+
+        chunk.model->UpdateGeometry();
+
+        if (is_new)
         {
-            //  Ŭ   ߰
-            m_Model->Clear();
-            m_Model->AppendGeometry(indices, vertices);
-            m_Model->UpdateGeometry();
+            chunk.model->SetResourceFilePath(resource_cache->GetProjectDirectory() + name + string(EXTENSION_MODEL));
+            chunk.model = resource_cache->Cache(chunk.model);
         }
+    }
+
+    void Terrain::UpdateChunkRenderable(const sTerrainChunk& chunk) const
+    {
+        const shared_ptr<Entity> entity = chunk.entity.lock();
+        if (!entity || !chunk.model || chunk.index_count == 0)
+            return;
 
-        UpdateFromModel(m_Model);
+        if (Renderable* renderable = entity->AddComponent<Renderable>())
+        {
+            renderable->GeometrySet(
+                TERRAIN_CHUNK_NAME,
+                0,
+                chunk.index_count,
+                0,
+                chunk.vertex_count,
+                chunk.model->GetAABB(),
+                chunk.model.get()
+            );
+
+            if (!renderable->HasMaterial())
+            {
+                renderable->UseDefaultMaterial();
+            }
+        }
     }
-}
\ No newline at end of file
+}
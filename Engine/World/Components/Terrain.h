@@ -7,13 +7,26 @@
 namespace PlayGround
 {
 	class Model;
+	class Entity;
+	class Transform;
 
-	namespace Math
+	//  ûũ ϳ (Ʈ )
+	// ûũ ڱ 𵨰 ƼƼ Ƿ  øǰ  ٽ .
+	struct sTerrainChunk
 	{
-		class Vector3;
-	}
+		// ûũ ڿ ġ
+		uint32_t x = 0;
+		uint32_t y = 0;
+		std::weak_ptr<Entity> entity;
+		std::shared_ptr<Model> model;
+		// LOD 0 Ʈ (LOD  ڿ ̾  ִ.)
+		uint32_t index_count = 0;
+		uint32_t vertex_count = 0;
+	};
 
 	//  Ʈ
+	//    ũ ûũ  ûũ ƼƼ Ʈ  ´.
+	// ûũ  ι辿 ø LOD ̸  ڸ ĿƮ ٿ LOD ٸ ̿  ƴ .
 	class Terrain : public IComponent
 	{
 	public:
@@ -34,30 +47,55 @@ namespace PlayGround
 		inline float GetMaxY() const { return m_MaxY; }
 		inline void SetMaxY(float max_z) { m_MaxY = max_z; }
 
+		// ûũ   簢  (2 ŵ .)
+		inline uint32_t GetChunkSize() const { return m_ChunkSize; }
+		void SetChunkSize(uint32_t chunk_size);
+
+		// LOD 0  LOD 
+		inline uint32_t GetLodCount() const { return m_LodCount; }
+		void SetLodCount(uint32_t lod_count);
+
+		// LOD  ϴ ȭ   (ȼ)
+		inline float GetPixelError() const { return m_PixelError; }
+		inline void SetPixelError(float pixel_error) { m_PixelError = pixel_error > 0.0f ? pixel_error : m_PixelError; }
+
+		inline uint32_t GetChunkCount() const { return static_cast<uint32_t>(m_vecChunks.size()); }
+		inline const std::vector<sTerrainChunk>& GetChunks() const { return m_vecChunks; }
+
 		inline float GetProgress() const { return static_cast<float>(static_cast<double>(m_Progress_jobs_done) / static_cast<double>(m_Progress_job_count)); }
 		const std::string& GetProgressDescription() const { return m_ProgressDesc; }
 
+		// ûũ       ٷ ׷ Ѵ.
+		// ûũ ġ ٸ  ƼƼ ״ Ƿ ٽ  ȿ   ʴ´.
+		//  忡 ȣѴ. (ƼƼ World::QueueMainThread  忡 Ѵ.)
 		void GenerateAsync();
 
 	private:
-		bool GeneratePositions(std::vector<Math::Vector3>& positions, const std::vector<std::byte>& height_map);
-		bool GenerateVerticesIndices(const std::vector<Math::Vector3>& positions, std::vector<uint32_t>& indices, std::vector<RHI_Vertex_PosTexNorTan>& vertices);
-		bool GenerateNormalTangents(const std::vector<uint32_t>& indices, std::vector<RHI_Vertex_PosTexNorTan>& vertices);
-		void UpdateFromModel(const std::shared_ptr<Model>& model) const;
-		void UpdateFromVertices(const std::vector<uint32_t>& indices, std::vector<RHI_Vertex_PosTexNorTan>& vertices);
+		// ûũ ƼƼ [x_begin, x_end) x [y_begin, y_end)  Ʈ . ( )
+		// ûũ  ̸   ä ־ Ѵ.
+		void CreateQuadtree(Transform* parent, uint32_t x_begin, uint32_t y_begin, uint32_t x_end, uint32_t y_end, uint32_t depth);
+		//    ûũ ƼƼ .
+		void RemoveQuadtree();
+		//  ʿ ٷ ûũ ؽ, ε, LOD  ûũ 𵨿 ִ´.
+		void GenerateChunk(sTerrainChunk& chunk, const std::vector<std::byte>& height_map, uint32_t bytes_per_pixel);
+		// ûũ ƼƼ  ûũ  ׸ Ѵ. ( )
+		void UpdateChunkRenderable(const sTerrainChunk& chunk) const;
 
 		uint32_t m_Width = 0;
 		uint32_t m_Height = 0;
 		float m_MinY = 0.0f;
 		float m_MaxY = 30.0f;
-		float m_Vertex_density = 1.0f;
+		uint32_t m_ChunkSize = 128;
+		uint32_t m_LodCount = 5;
+		float m_PixelError = 2.0f;
+		uint32_t m_ChunkCountX = 0;
+		uint32_t m_ChunkCountY = 0;
+		//   (y * m_ChunkCountX + x),  忡 ٲ۴.
+		std::vector<sTerrainChunk> m_vecChunks;
 		std::atomic<bool> m_IsGenerating = false;
-		uint64_t m_VertexCount = 0;
-		uint64_t m_FaceCount = 0;
 		std::atomic<uint64_t> m_Progress_jobs_done = 0;
 		uint64_t m_Progress_job_count = 1;
 		std::string m_ProgressDesc;
 		std::shared_ptr<RHI_Texture2D> m_HeightMap;
-		std::shared_ptr<Model> m_Model;
 	};
-}
\ No newline at end of file
+}
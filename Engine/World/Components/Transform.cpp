@@ -13,29 +13,36 @@ namespace PlayGround
 {
 	Transform::Transform(Context* context, Entity* entity, uint64_t id /*= 0*/) : IComponent(context, entity, id, this)
 	{
+        //  Ʈ   Ҵ޴´.
+        m_Store = m_Context->GetSubModule<World>()->GetTransformStore();
+        //  ʿ ŭ  øǷ 32Ʈ ε     ʴ´.
+        m_StoreIndex = m_Store->Allocate(this);
+        ASSERT(m_StoreIndex != TransformStore::INVALID_INDEX);
+
         // Ʈ Ʈ ʱȭ
-        m_LocalPosistion = Vector3::Zero;
-        m_LocalRoation = Quaternion(0, 0, 0, 1);
-        m_LocalScale = Vector3::One;
-        m_Matrix = Matrix::Identity;
-        m_LocalMatrix = Matrix::Identity;
         m_PrevMatrix = Matrix::Identity;
-        m_InitPosition = m_LocalPosistion;
-        m_InitRotation = m_LocalRoation;
-        m_InitScale = m_LocalScale;
+        m_InitPosition = Vector3::Zero;
+        m_InitRotation = Quaternion(0, 0, 0, 1);
+        m_InitScale = Vector3::One;
         m_Parent = nullptr;
         // Ƽ ÷  ϴ  ʱȭ
         m_IsDirty = true;
 
         // ش  gette, setter 
-        REGISTER_ATTRIBUTE_VALUE_VALUE(m_LocalPosistion, Vector3);
-        REGISTER_ATTRIBUTE_VALUE_VALUE(m_LocalRoation, Quaternion);
-        REGISTER_ATTRIBUTE_VALUE_VALUE(m_LocalScale, Vector3);
-        REGISTER_ATTRIBUTE_VALUE_VALUE(m_Matrix, Matrix);
-        REGISTER_ATTRIBUTE_VALUE_VALUE(m_LocalMatrix, Matrix);
+        //   κ ǹǷ   ʴ´.
+        REGISTER_ATTRIBUTE_GET_SET(GetLocalPosition, SetLocalPosition, Vector3);
+        REGISTER_ATTRIBUTE_GET_SET(GetLocalRotation, SetLocalRotaion, Quaternion);
+        REGISTER_ATTRIBUTE_GET_SET(GetLocalScale, SetLocalScale, Vector3);
         REGISTER_ATTRIBUTE_VALUE_VALUE(m_LookAt, Vector3);
 	}
 
+    Transform::~Transform()
+    {
+        //  ȯ
+        if (m_Store)
+            m_Store->Release(m_StoreIndex);
+    }
+
     void Transform::OnInit()
     {
         // ʱȭÿ Ƽ ÷  Ѵ.
@@ -49,7 +56,7 @@ namespace PlayGround
             return;
 
         // Ʈ Ʈ
-        UpdateTransform();
+        GetMatrix();
 
         // Ʈ Ʈ  Ƽ ÷ ʱȭ
         m_IsDirty = false;
@@ -69,9 +76,9 @@ namespace PlayGround
     void Transform::Serialize(FileStream* stream)
     {
         // 
-        stream->Write(m_LocalPosistion);
-        stream->Write(m_LocalRoation);
-        stream->Write(m_LocalScale);
+        stream->Write(GetLocalPosition());
+        stream->Write(GetLocalRotation());
+        stream->Write(GetLocalScale());
         stream->Write(m_LookAt);
 
         stream->Write(m_Parent ? m_Parent->GetEntity()->GetObjectID() : 0);
@@ -80,43 +87,24 @@ namespace PlayGround
     void Transform::Deserialize(FileStream* stream)
     {
         // ҷ
-        stream->Read(&m_LocalPosistion);
-        stream->Read(&m_LocalRoation);
-        stream->Read(&m_LocalScale);
+        Vector3 position;
+        Quaternion rotation;
+        Vector3 scale;
+        stream->Read(&position);
+        stream->Read(&rotation);
+        stream->Read(&scale);
         stream->Read(&m_LookAt);
 
-        uint64_t parent_entity_id = 0;
-        stream->Read(&parent_entity_id);
+        m_Store->SetLocalPosition(m_StoreIndex, position);
+        m_Store->SetLocalRotation(m_StoreIndex, rotation);
+        m_Store->SetLocalScale(m_StoreIndex, scale);
 
-        //  θ ̵ Ѵٸ θ ߴٴ 
-        if (parent_entity_id != 0)
-        {
-            //   ̵ θ ãƿ´.
-            if (const shared_ptr<Entity>& parent = m_Context->GetSubModule<World>()->EntityGetByID(parent_entity_id))
-            {
-                parent->GetTransform()->AddChild(this);
-            }
-        }
+        // θ ̵  ȣȯ  ܵд.
+        // θ ƼƼ ҷ鼭 ̹  θ Ʈ ٷ ϹǷ 忡 ã ʴ´.
+        stream->Skip(sizeof(uint64_t));
 
         // Ʈ Ʈ
-        UpdateTransform();
-    }
-
-    void Transform::UpdateTransform()
-    {
-        //  
-        m_LocalMatrix = Matrix(m_LocalPosistion, m_LocalRoation, m_LocalScale);
-
-        //  θ  
-        if (m_Parent)
-            m_Matrix = m_LocalMatrix * m_Parent->GetMatrix();
-        // ƴ  ٷ 
-        else
-            m_Matrix = m_LocalMatrix;
-
-        // ڽ Ʈ Ѵ.
-        for (Transform* child : m_vecChildren)
-            child->UpdateTransform();
+        m_Store->MarkDirty(m_StoreIndex);
     }
 
     void Transform::SetPosition(const Vector3& position)
@@ -130,15 +118,15 @@ namespace PlayGround
     
     void Transform::SetLocalPosition(const Vector3& position)
     {
-        if (m_LocalPosistion == position)
+        if (GetLocalPosition() == position)
             return;
 
         //  尡 ƴҽÿ ο ʱ ġ
         if(!m_Context->m_Engine->IsEngineModeSet(EEngine_Mode::GameMode))
             m_InitPosition = position;
 
-        m_LocalPosistion = position;
-        UpdateTransform();
+        //  ʿ  ǵ ڼձ Ƽ ǥø Ѵ.
+        m_Store->SetLocalPosition(m_StoreIndex, position);
 
         // ̹ ӿ  ȭ 
         m_PositionChanged_this_frame = true;
@@ -155,15 +143,14 @@ namespace PlayGround
 
     void Transform::SetLocalRotaion(const Quaternion& rotation)
     {
-        if (m_LocalRoation == rotation)
+        if (GetLocalRotation() == rotation)
             return;
 
         //  Ӹ尡 ƴҽÿ ο ʱ ȸ
         if (!m_Context->m_Engine->IsEngineModeSet(EEngine_Mode::GameMode))
             m_InitRotation = rotation;
 
-        m_LocalRoation = rotation;
-        UpdateTransform();
+        m_Store->SetLocalRotation(m_StoreIndex, rotation);
 
         m_RotationChanged_this_frame = true;
     }
@@ -179,21 +166,21 @@ namespace PlayGround
 
     void Transform::SetLocalScale(const Vector3& scale)
     {
-        if (m_LocalScale == scale)
+        if (GetLocalScale() == scale)
             return;
 
         // Ӹ尡 ƴ  ʱ   
         if (!m_Context->m_Engine->IsEngineModeSet(EEngine_Mode::GameMode))
             m_InitScale = scale;
 
-        m_LocalScale = scale;
+        Vector3 local_scale = scale;
 
         //    0̶    ʱȭѴ.
-        m_LocalScale.x = (m_LocalScale.x == 0.0f) ? Util::EPSILON : m_LocalScale.x;
-        m_LocalScale.y = (m_LocalScale.y == 0.0f) ? Util::EPSILON : m_LocalScale.y;
-        m_LocalScale.z = (m_LocalScale.z == 0.0f) ? Util::EPSILON : m_LocalScale.z;
+        local_scale.x = (local_scale.x == 0.0f) ? Util::EPSILON : local_scale.x;
+        local_scale.y = (local_scale.y == 0.0f) ? Util::EPSILON : local_scale.y;
+        local_scale.z = (local_scale.z == 0.0f) ? Util::EPSILON : local_scale.z;
 
-        UpdateTransform();
+        m_Store->SetLocalScale(m_StoreIndex, local_scale);
 
         m_ScaleChanged_this_frame = true;
     }
@@ -202,20 +189,20 @@ namespace PlayGround
     {
         // θ   ϰ ش.
         if (!HasParent())
-            SetLocalPosition(m_LocalPosistion + delta);
+            SetLocalPosition(GetLocalPosition() + delta);
         // θ  쿡 θ Ŀ ̵  ŭ ش.
         else
-            SetLocalPosition(m_LocalPosistion + GetParent()->GetMatrix().Inverted() * delta);
+            SetLocalPosition(GetLocalPosition() + GetParent()->GetMatrix().Inverted() * delta);
     }
 
     void Transform::Rotate(const Quaternion& delta)
     {
         // θ   ؼ ȭ
         if (!HasParent())
-            SetLocalRotaion((m_LocalRoation * delta).Normalized());
+            SetLocalRotaion((GetLocalRotation() * delta).Normalized());
         // θ  쿡 İ  ȸġ ׸ ȸ Ѵ.
         else
-            SetLocalRotaion(m_LocalRoation * GetParent()->GetRotation().Inverse() * delta * GetRotation());
+            SetLocalRotaion(GetLocalRotation() * GetParent()->GetRotation().Inverse() * delta * GetRotation());
     }
 
     Vector3 Transform::GetUp() const
@@ -331,6 +318,9 @@ namespace PlayGround
 
         m_Parent = new_parent;
         m_IsDirty = true;
+
+        //  θ ٲٰ ڼձ Ƽ ǥѴ.
+        m_Store->SetParent(m_StoreIndex, m_Parent ? m_Parent->GetStoreIndex() : TransformStore::INVALID_INDEX);
     }
 
 
@@ -378,6 +368,7 @@ namespace PlayGround
             m_IsDirty = true;
 
         m_Parent = new_parent;
+        m_Store->SetParent(m_StoreIndex, m_Parent ? m_Parent->GetStoreIndex() : TransformStore::INVALID_INDEX);
     }
 
     void Transform::AddChildInternal(Transform* child)
@@ -5,6 +5,7 @@
 #include "../../Math/Vector3.h"
 #include "../../Math/Quaternion.h"
 #include "../../Math/Matrix.h"
+#include "../TransformStore.h"
 
 namespace PlayGround
 {
@@ -16,7 +17,7 @@ namespace PlayGround
 	{
 	public:
 		Transform(Context* context, Entity* entity, uint64_t id = 0);
-		~Transform() = default;
+		~Transform();
 
 		// IComponent  ޼ ̵
 		void OnInit() override;
@@ -25,25 +26,25 @@ namespace PlayGround
 		void Serialize(FileStream* stream) override;
 		void Deserialize(FileStream* stream) override;
 
-		inline Math::Vector3 GetPosition() const { return m_Matrix.GetTranslation(); }
+		inline Math::Vector3 GetPosition() const { return GetMatrix().GetTranslation(); }
 
-		inline const Math::Vector3& GetLocalPosition() const { return m_LocalPosistion; }
+		inline const Math::Vector3& GetLocalPosition() const { return m_Store->GetLocalPosition(m_StoreIndex); }
 
 		void SetPosition(const Math::Vector3& position);
 
 		void SetLocalPosition(const Math::Vector3& position);
 
-		inline Math::Quaternion GetRotation() const { return m_Matrix.GetRotation(); }
+		inline Math::Quaternion GetRotation() const { return GetMatrix().GetRotation(); }
 
-		inline const Math::Quaternion& GetLocalRotation() const { return m_LocalRoation; }
+		inline const Math::Quaternion& GetLocalRotation() const { return m_Store->GetLocalRotation(m_StoreIndex); }
 
 		void SetRotation(const Math::Quaternion& rotation);
 
 		void SetLocalRotaion(const Math::Quaternion& rotation);
 
-		inline Math::Vector3 GetScale() const { return m_Matrix.GetScale(); }
+		inline Math::Vector3 GetScale() const { return GetMatrix().GetScale(); }
 
-		inline const Math::Vector3& GetLocalScale() const { return m_LocalScale; }
+		inline const Math::Vector3& GetLocalScale() const { return m_Store->GetLocalScale(m_StoreIndex); }
 
 		inline Math::Vector3 GetIninPosition() const { return m_InitPosition; }
 		inline Math::Quaternion GetinitRotation() const { return m_InitRotation; }
@@ -96,20 +97,25 @@ namespace PlayGround
 
 		inline void LookAt(const Math::Vector3& v) { m_LookAt = v; }
 
-		inline const Math::Matrix& GetMatrix() const { return m_Matrix; }
+		// Ƽ  θ   ȯѴ.
+		inline Math::Matrix GetMatrix() const { return m_Store->GetMatrix(m_StoreIndex); }
 
-		inline const Math::Matrix& GetLocalMatrix() const { return m_LocalMatrix; }
+		inline Math::Matrix GetLocalMatrix() const { return m_Store->GetLocalMatrix(m_StoreIndex); }
 
 		inline const Math::Matrix& GetPrevMatrix() const { return m_PrevMatrix; }
 
 		inline void SetPrevMatrix(const Math::Matrix& matrix) { m_PrevMatrix = matrix; }
 
+		inline uint32_t GetStoreIndex() const { return m_StoreIndex; }
+
 	private:
+		// Ľÿ ε Ѵ.
+		friend class TransformStore;
+
 		void SetParentInternal(Transform* parent);
 		void AddChildInternal(Transform* child);
 		void RemoveChildInternal(Transform* child);
 
-		void UpdateTransform();
 		Math::Matrix GetParentTransformMatrix() const;
 		bool m_IsDirty = false;
 
@@ -117,12 +123,10 @@ namespace PlayGround
 		Math::Quaternion m_InitRotation;
 		Math::Vector3 m_InitScale = Math::Vector3::One;
 
-		Math::Vector3 m_LocalPosistion;
-		Math::Quaternion m_LocalRoation;
-		Math::Vector3 m_LocalScale;
+		//     Ʈ  ȴ.
+		TransformStore* m_Store = nullptr;
+		uint32_t m_StoreIndex = TransformStore::INVALID_INDEX;
 
-		Math::Matrix m_Matrix;
-		Math::Matrix m_LocalMatrix;
 		Math::Vector3 m_LookAt;
 
 		Transform* m_Parent;
@@ -13,6 +13,7 @@
 #include "Components/AudioListener.h"
 #include "Components/Terrain.h"
 #include "Components/ReflectionProbe.h"
+#include "Components/Animator.h"
 #include "../IO/FileStream.h"
 
 #include "../Core/Context.h"
@@ -40,6 +41,28 @@ namespace PlayGround
 		}
 	}
 
+	void Entity::SetName(const string& name)
+	{
+		if (m_ObjectName == name)
+			return;
+
+		const string old_name = m_ObjectName;
+		m_ObjectName = name;
+
+		m_Context->GetSubModule<World>()->OnEntityNameChanged(this, old_name);
+	}
+
+	void Entity::SetObjectID(const uint64_t id)
+	{
+		if (m_ObjectID == id)
+			return;
+
+		const uint64_t old_id = m_ObjectID;
+		m_ObjectID = id;
+
+		m_Context->GetSubModule<World>()->OnEntityIDChanged(this, old_id);
+	}
+
 	void Entity::Clone()
 	{
 		// 
@@ -142,41 +165,39 @@ namespace PlayGround
 			//  Ʈ  Ѵ.
 			stream->Write(static_cast<uint32_t>(m_vecComponents.size()));
 
-			//  Ʈ ȸϸ鼭
+			// Ÿ, ̵, ũ,   Ѵ.
+			// ũ⸦ ˰  ҷ  Ʈ  ʰ ǳʶ  ִ.
 			for (auto& component : m_vecComponents)
 			{
-				// Ÿ԰ ̵ Ѵ.
 				stream->Write(static_cast<uint32_t>(component->GetComponentType()));
 				stream->Write(component->GetObjectID());
-			}
 
-			// ׸ Ʈ Ѵ.
-			for (auto& component : m_vecComponents)
-			{
+				const uint64_t size_position = stream->GetPosition();
+				stream->Write(static_cast<uint64_t>(0));
+
 				component->Serialize(stream);
+
+				const uint64_t size = stream->GetPosition() - size_position - sizeof(uint64_t);
+				stream->WriteAt(size_position, &size, sizeof(size));
 			}
 		}
 
 		//  ƼƼ ڽ Ѵ.
 
 		{
-			//  ڽ ´.
-			vector<Transform*>& children = GetTransform()->GetChildren();
-
-			// ڽ   Ѵ.
-			stream->Write(static_cast<uint32_t>(children.size()));
-
-			//  ڽ ȸϸ鼭 ID Ѵ.
-			for (Transform* child : children)
+			// ƼƼ ִ ڽĸ Ѵ.
+			vector<Entity*> children;
+			for (Transform* child : GetTransform()->GetChildren())
 			{
-				stream->Write(child->GetObjectID());
+				if (child->GetEntity())
+					children.emplace_back(child->GetEntity());
 			}
 
-			// ڽ ƼƼ Ѵ.
-			for (Transform* child : children)
+			stream->Write(static_cast<uint32_t>(children.size()));
+
+			for (Entity* child : children)
 			{
-				if (child->GetEntity())
-					child->GetEntity()->Serialize(stream);
+				child->Serialize(stream);
 			}
 		}
 	}
@@ -188,8 +209,8 @@ namespace PlayGround
 		{
 			stream->Read(&m_IsActive);
 			stream->Read(&m_Hierarchy_visibility);
-			stream->Read(&m_ObjectID);
-			stream->Read(&m_ObjectName);
+			SetObjectID(stream->ReadAs<uint64_t>());
+			SetName(stream->ReadAs<string>());
 		}
 
 		{
@@ -245,15 +266,100 @@ namespace PlayGround
 				child.lock()->Deserialize(stream, GetTransform());
 			}
 
-			//  Ʈ Ʈ   ڽ ãƿ´.
-			if (m_Transform)
-				m_Transform->AcquireChildren();
+			// ڽĵ ҷ鼭 SetParent ̹  Ʈ ߰ǾǷ
+			//  ü ٽ ȸϸ ڽ ãƿ ʿ䰡 .
 		}
 
 		// ̺Ʈ ߻
 		FIRE_EVENT(EventType::WorldResolve);
 	}
 
+	void Entity::Deserialize(const sEntityStaging& staging, Transform* parent)
+	{
+		m_IsActive = staging.is_active;
+		m_Hierarchy_visibility = staging.hierarchy_visibility;
+		SetObjectID(staging.id);
+		SetName(staging.name);
+
+		// Ʈ  ߰ ڿ  ҷ´.
+		for (const sComponentStaging& component : staging.components)
+		{
+			AddComponent(component.type, component.id);
+		}
+
+		for (const sComponentStaging& component : staging.components)
+		{
+			IComponent* target = GetComponent(component.type);
+			if (!target)
+				continue;
+
+			// Ʈ ڱ  Ƿ ϳ ߸ о  Ʈ  .
+			FileStream stream(component.data, component.size);
+			target->Deserialize(&stream);
+		}
+
+		// θ ̹  Ƿ ̵ ã ʰ ٷ Ѵ.
+		if (m_Transform)
+			m_Transform->SetParent(parent);
+	}
+
+	bool Entity::DecodeSubtree(FileStream* stream, vector<sEntityStaging>* entities)
+	{
+		// (ƼƼ ε,    ڽ )
+		vector<pair<uint32_t, uint32_t>> stack;
+		uint32_t parent = UINT32_MAX;
+
+		while (true)
+		{
+			const uint32_t index = static_cast<uint32_t>(entities->size());
+			sEntityStaging& entity = entities->emplace_back();
+
+			entity.parent = parent;
+			stream->Read(&entity.is_active);
+			stream->Read(&entity.hierarchy_visibility);
+			stream->Read(&entity.id);
+			stream->Read(&entity.name);
+
+			const uint32_t component_count = stream->ReadAs<uint32_t>();
+			if (stream->IsEof())
+				return false;
+
+			entity.components.resize(component_count);
+			for (sComponentStaging& component : entity.components)
+			{
+				const uint32_t type = stream->ReadAs<uint32_t>();
+				stream->Read(&component.id);
+				stream->Read(&component.size);
+
+				component.data = stream->ReadInPlace(component.size);
+
+				if (!component.data || type >= static_cast<uint32_t>(EComponentType::Unknown))
+					return false;
+
+				component.type = static_cast<EComponentType>(type);
+			}
+
+			stack.emplace_back(index, stream->ReadAs<uint32_t>());
+
+			if (stream->IsEof())
+				return false;
+
+			// ڽ ִ     ƼƼ θ ȴ.
+			while (!stack.empty() && stack.back().second == 0)
+			{
+				stack.pop_back();
+			}
+
+			if (stack.empty())
+				break;
+
+			stack.back().second--;
+			parent = stack.back().first;
+		}
+
+		return true;
+	}
+
 	// Ÿ  Ʈ ߰Ѵ.
 	IComponent* Entity::AddComponent(const EComponentType type, uint64_t id /*= 0*/)
 	{
@@ -268,6 +374,7 @@ namespace PlayGround
 		case EComponentType::RigidBody:       component = static_cast<IComponent*>(AddComponent<RigidBody>(id));       break;
 		case EComponentType::Environment:     component = static_cast<IComponent*>(AddComponent<Environment>(id));     break;
 		case EComponentType::Transform:       component = static_cast<IComponent*>(AddComponent<Transform>(id));       break;
+		case EComponentType::Animator:        component = static_cast<IComponent*>(AddComponent<Animator>(id));        break;
 		case EComponentType::Unknown:         component = nullptr;                                                     break;
 		default:                              component = nullptr;                                                     break;
 		}
@@ -297,11 +404,31 @@ namespace PlayGround
 			}
 		}
 
+		if (component_type == EComponentType::Unknown)
+			return;
+
 		//  ũ  
 		m_ComponentMask &= ~GetComponentMask(component_type);
+		m_ComponentsByType[static_cast<uint32_t>(component_type)] = nullptr;
+
+		if (component_type == EComponentType::Renderable)
+			m_Renderable = nullptr;
+
+		OnComponentsChanged();
 
 		// ̺Ʈ ߻
 		FIRE_EVENT(EventType::WorldResolve);
 
 	}
-}
\ No newline at end of file
+
+	void Entity::OnComponentsChanged()
+	{
+		NotifyRenderStateChanged();
+
+		//  忡 ϵ ʾҴٸ   ŰŸ .
+		if (!m_Handle.IsValid())
+			return;
+
+		m_Context->GetSubModule<World>()->OnEntityComponentsChanged(this);
+	}
+}
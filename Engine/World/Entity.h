@@ -1,14 +1,39 @@
 #pragma once
 
 #include <vector>
+#include <array>
 #include "../Core/EventSystem.h"
 #include "Components/IComponent.h"
+#include "Components/ComponentPool.h"
+#include "World.h"
 
 namespace PlayGround
 {
 	class Context;
 	class Transform;
 	class Renderable;
+
+	//  Ͽ ؼ ص Ʈ
+	// ʹ ε  ״ Ų.
+	struct sComponentStaging
+	{
+		EComponentType type = EComponentType::Unknown;
+		uint64_t id = 0;
+		const std::byte* data = nullptr;
+		uint64_t size = 0;
+	};
+
+	//  Ͽ ؼ ص ƼƼ
+	// θ  Ʈ 迭 ȿ ε̴. (Ʈ UINT32_MAX)
+	struct sEntityStaging
+	{
+		bool is_active = true;
+		bool hierarchy_visibility = true;
+		uint64_t id = 0;
+		std::string name;
+		uint32_t parent = UINT32_MAX;
+		std::vector<sComponentStaging> components;
+	};
 	
 	// ӳ ġǴ Ʈ Ÿ Ŭ
 	class Entity : public EngineObject, public std::enable_shared_from_this<Entity>
@@ -32,18 +57,48 @@ namespace PlayGround
 		// Ʈ
 		void Update(double delta_time);
 
-		// 
+		//  (Ʈ ũ⸦ տ ̰ ڽ  켱 ̾ .)
 		void Serialize(FileStream* stream);
-		// ҷ
+		//      ƼƼ ҷ´.
 		void Deserialize(FileStream* stream, Transform* parent);
+		// ؼص ƼƼ  ƼƼ ä.
+		void Deserialize(const sEntityStaging& staging, Transform* parent);
+
+		// Serialize  Ʈ ƼƼ  ʰ  켱  ؼѴ.
+		// 带 ǵ帮 Ƿ  忡 ÿ ȣ  ִ.
+		static bool DecodeSubtree(FileStream* stream, std::vector<sEntityStaging>* entities);
 
 		inline const std::string& GetObjectName() const { return m_ObjectName; }
 
-		inline void SetName(const std::string& name) { m_ObjectName = name; }
+		//  ̸ ε Ѵ.
+		void SetName(const std::string& name);
+
+		//  ̵ ε Ѵ.
+		void SetObjectID(const uint64_t id);
+
+		// 忡 ϵǾ ִ  ȿ ڵ
+		inline const EntityHandle& GetHandle() const { return m_Handle; }
 
 		inline bool IsActive() const { return m_IsActive; }
 
-		inline void SetActive(const bool active) { m_IsActive = active; }
+		inline void SetActive(const bool active)
+		{
+			if (m_IsActive == active)
+				return;
+
+			m_IsActive = active;
+
+			//  Ͽ ְų  ˸.
+			NotifyRenderStateChanged();
+		}
+
+		//   ƼƼ ٽ зϵ ˸.
+		// 忡 ϵǱ      ƼƼ̹Ƿ     ˸.
+		inline void NotifyRenderStateChanged()
+		{
+			if (m_Handle.IsValid())
+				FIRE_EVENT_DATA(EventType::EntityRenderStateChanged, this);
+		}
 
 		inline bool IsVisibleInHierarchy() const { return m_Hierarchy_visibility; }
 
@@ -60,10 +115,12 @@ namespace PlayGround
 				return GetComponent<T>();
 
 			// ο Ʈ 
-			std::shared_ptr<T> component = std::make_shared<T>(m_Context, this, id);
+			//  ϰ Բ ŸԺ Ǯ ҴѴ.
+			std::shared_ptr<T> component = std::allocate_shared<T>(ComponentAllocator<T>(), m_Context, this, id);
 
 			// ߰Ѵ.
 			m_vecComponents.emplace_back(std::static_pointer_cast<IComponent>(component));
+			m_ComponentsByType[static_cast<uint32_t>(type)] = component.get();
 			// ũ 
 			m_ComponentMask |= GetComponentMask(type);
 
@@ -84,6 +141,9 @@ namespace PlayGround
 			// ʱȭ
 			component->OnInit();
 
+			//  ŰŸ ű.
+			OnComponentsChanged();
+
 			//  ̺Ʈ ߻
 			FIRE_EVENT(EventType::WorldResolve);
 
@@ -99,20 +159,12 @@ namespace PlayGround
 			//  ü ȯ
 			const EComponentType type = IComponent::TypeToEnum<T>();
 
-			//    ʴٸ ȯ
-			if (!HasComponent(type))
-				return nullptr;
-
-			// Ÿ   ˸ Ʈ ȯ
-			for (std::shared_ptr<IComponent>& component : m_vecComponents)
-			{
-				if (component->GetComponentType() == type)
-					return static_cast<T*>(component.get());
-			}
-
-			return nullptr;
+			// ŸԺ ٷ ã´.
+			return static_cast<T*>(GetComponent(type));
 		}
 
+		inline IComponent* GetComponent(const EComponentType type) const { return type < EComponentType::Unknown ? m_ComponentsByType[static_cast<uint32_t>(type)] : nullptr; }
+
 		//  Ʈ ȯѴ.
 		template <typename T>
 		std::vector<T*> GetComponents()
@@ -158,8 +210,16 @@ namespace PlayGround
 					component->OnRemove();
 					// 
 					it = m_vecComponents.erase(it);
+					m_ComponentsByType[static_cast<uint32_t>(type)] = nullptr;
 					// ũ  Ѵ.
 					m_ComponentMask &= ~GetComponentMask(type);
+
+					if constexpr (std::is_same<T, Renderable>::value)
+					{
+						m_Renderable = nullptr;
+					}
+
+					OnComponentsChanged();
 					break;
 				}
 			}
@@ -171,6 +231,8 @@ namespace PlayGround
 		void RemoveComponentByID(uint64_t id);
 		inline const auto& GetAllComponents() const { return m_vecComponents; }
 
+		inline uint32_t GetComponentMask() const { return m_ComponentMask; }
+
 		inline void MarkForDestruction() { m_Destruction_pending = true; }
 
 		inline bool IsPendingDestruction() const { return m_Destruction_pending; }
@@ -182,16 +244,33 @@ namespace PlayGround
 		inline std::shared_ptr<Entity> GetSharedPtr() { return shared_from_this(); }
 
 	private:
+		// , ÿ ڵ Ѵ.
+		friend class World;
+
 		inline constexpr uint32_t GetComponentMask(EComponentType type) { return static_cast<uint32_t>(1) << static_cast<uint32_t>(type); }
 
+		// Ʈ  ٲ 忡 ˸.
+		void OnComponentsChanged();
+
 		std::string m_ObjectName = "Entity";
 		bool m_IsActive = true;
 		bool m_Hierarchy_visibility = true;
 		Transform* m_Transform = nullptr;
 		Renderable* m_Renderable = nullptr;
 		bool m_Destruction_pending = false;
+		EntityHandle m_Handle;
 
 		std::vector<std::shared_ptr<IComponent>> m_vecComponents;
+		// ŸԺ Ʈ (ٸ nullptr)
+		std::array<IComponent*, COMPONENT_TYPE_COUNT> m_ComponentsByType = {};
 		uint32_t m_ComponentMask = 0;
+
+		// 忡 ִ ŰŸ԰  ȿ ġ
+		uint32_t m_ArchetypeIndex = UINT32_MAX;
+		uint32_t m_ArchetypeRow = UINT32_MAX;
+		//  BVH   ( ٸ UINT32_MAX)
+		uint32_t m_SceneProxy = UINT32_MAX;
+		//  BVH ſ ڽ ٽ  
+		bool m_SceneProxyDirty = false;
 	};
 }
\ No newline at end of file
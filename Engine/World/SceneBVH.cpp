@@ -0,0 +1,409 @@
+#include "Common.h"
+#include "SceneBVH.h"
+
+using namespace std;
+using namespace PlayGround::Math;
+
+namespace PlayGround
+{
+	//   ڽ ϴ  (ũ⿡  + ּҰ)
+	static constexpr float FAT_MARGIN_RATIO = 0.1f;
+	static constexpr float FAT_MARGIN_MIN = 0.05f;
+	//  ڽ ̸ŭ ̻ ũٸ (ü ۾ٸ) ٽ Ѵ.
+	static constexpr float FAT_AREA_RATIO_MAX = 4.0f;
+
+	static BoundingBox Fatten(const BoundingBox& box)
+	{
+		const Vector3 margin = box.GetSize() * FAT_MARGIN_RATIO + Vector3(FAT_MARGIN_MIN, FAT_MARGIN_MIN, FAT_MARGIN_MIN);
+
+		return BoundingBox(box.GetMin() - margin, box.GetMax() + margin);
+	}
+
+	static bool Contains(const BoundingBox& outer, const BoundingBox& inner)
+	{
+		return
+			outer.GetMin().x <= inner.GetMin().x && outer.GetMin().y <= inner.GetMin().y && outer.GetMin().z <= inner.GetMin().z &&
+			inner.GetMax().x <= outer.GetMax().x && inner.GetMax().y <= outer.GetMax().y && inner.GetMax().z <= outer.GetMax().z;
+	}
+
+	uint32_t SceneBVH::Insert(Entity* entity, const BoundingBox& box)
+	{
+		const uint32_t leaf = AllocateNode();
+
+		sNode& node = m_vecNodes[leaf];
+		node.box = Fatten(box);
+		node.entity = entity;
+		node.height = 0;
+
+		InsertLeaf(leaf);
+		m_ProxyCount++;
+
+		return leaf;
+	}
+
+	void SceneBVH::Remove(uint32_t proxy)
+	{
+		if (proxy >= m_vecNodes.size() || !m_vecNodes[proxy].IsLeaf() || m_vecNodes[proxy].height != 0)
+			return;
+
+		RemoveLeaf(proxy);
+		FreeNode(proxy);
+		m_ProxyCount--;
+	}
+
+	bool SceneBVH::Move(uint32_t proxy, const BoundingBox& box)
+	{
+		sNode& node = m_vecNodes[proxy];
+
+		//   ڽ ȿ ִٸ Ʈ ġ ʴ´.
+		if (Contains(node.box, box))
+		{
+			const BoundingBox fat = Fatten(box);
+
+			if (SurfaceArea(node.box) <= SurfaceArea(fat) * FAT_AREA_RATIO_MAX)
+				return false;
+		}
+
+		RemoveLeaf(proxy);
+		m_vecNodes[proxy].box = Fatten(box);
+		InsertLeaf(proxy);
+
+		return true;
+	}
+
+	void SceneBVH::Clear()
+	{
+		m_vecNodes.clear();
+		m_Root = INVALID_NODE;
+		m_FreeList = INVALID_NODE;
+		m_ProxyCount = 0;
+	}
+
+	bool SceneBVH::Overlaps(const BoundingBox& a, const BoundingBox& b)
+	{
+		return
+			a.GetMin().x <= b.GetMax().x && a.GetMax().x >= b.GetMin().x &&
+			a.GetMin().y <= b.GetMax().y && a.GetMax().y >= b.GetMin().y &&
+			a.GetMin().z <= b.GetMax().z && a.GetMax().z >= b.GetMin().z;
+	}
+
+	bool SceneBVH::Overlaps(const Sphere& sphere, const BoundingBox& box)
+	{
+		// ڽ     Ÿ
+		const float dx = Util::Max(Util::Max(box.GetMin().x - sphere.center.x, 0.0f), sphere.center.x - box.GetMax().x);
+		const float dy = Util::Max(Util::Max(box.GetMin().y - sphere.center.y, 0.0f), sphere.center.y - box.GetMax().y);
+		const float dz = Util::Max(Util::Max(box.GetMin().z - sphere.center.z, 0.0f), sphere.center.z - box.GetMax().z);
+
+		return dx * dx + dy * dy + dz * dz <= sphere.radius * sphere.radius;
+	}
+
+	float SceneBVH::RayDistance(const Vector3& origin, const Vector3& inverse_direction, const BoundingBox& box)
+	{
+		//  ׽Ʈ (fminf, fmaxf 0 * INFINITY  NaN Ѵ.)
+		const float tx1 = (box.GetMin().x - origin.x) * inverse_direction.x;
+		const float tx2 = (box.GetMax().x - origin.x) * inverse_direction.x;
+		float t_min = fminf(tx1, tx2);
+		float t_max = fmaxf(tx1, tx2);
+
+		const float ty1 = (box.GetMin().y - origin.y) * inverse_direction.y;
+		const float ty2 = (box.GetMax().y - origin.y) * inverse_direction.y;
+		t_min = fmaxf(t_min, fminf(ty1, ty2));
+		t_max = fminf(t_max, fmaxf(ty1, ty2));
+
+		const float tz1 = (box.GetMin().z - origin.z) * inverse_direction.z;
+		const float tz2 = (box.GetMax().z - origin.z) * inverse_direction.z;
+		t_min = fmaxf(t_min, fminf(tz1, tz2));
+		t_max = fminf(t_max, fmaxf(tz1, tz2));
+
+		t_min = fmaxf(t_min, 0.0f);
+
+		if (t_max < t_min)
+			return Util::INFINITY_;
+
+		return t_min;
+	}
+
+	float SceneBVH::SurfaceArea(const BoundingBox& box)
+	{
+		const Vector3 size = box.GetSize();
+
+		return 2.0f * (size.x * size.y + size.y * size.z + size.z * size.x);
+	}
+
+	BoundingBox SceneBVH::Union(const BoundingBox& a, const BoundingBox& b)
+	{
+		const Vector3 min = Vector3(Util::Min(a.GetMin().x, b.GetMin().x), Util::Min(a.GetMin().y, b.GetMin().y), Util::Min(a.GetMin().z, b.GetMin().z));
+		const Vector3 max = Vector3(Util::Max(a.GetMax().x, b.GetMax().x), Util::Max(a.GetMax().y, b.GetMax().y), Util::Max(a.GetMax().z, b.GetMax().z));
+
+		return BoundingBox(min, max);
+	}
+
+	uint32_t SceneBVH::AllocateNode()
+	{
+		//  带  Ѵ.
+		if (m_FreeList != INVALID_NODE)
+		{
+			const uint32_t index = m_FreeList;
+			m_FreeList = m_vecNodes[index].parent;
+			m_vecNodes[index] = sNode();
+
+			return index;
+		}
+
+		m_vecNodes.emplace_back();
+
+		return static_cast<uint32_t>(m_vecNodes.size()) - 1;
+	}
+
+	void SceneBVH::FreeNode(uint32_t index)
+	{
+		sNode& node = m_vecNodes[index];
+		node = sNode();
+		node.parent = m_FreeList;
+		m_FreeList = index;
+	}
+
+	void SceneBVH::InsertLeaf(uint32_t leaf)
+	{
+		if (m_Root == INVALID_NODE)
+		{
+			m_Root = leaf;
+			m_vecNodes[leaf].parent = INVALID_NODE;
+			return;
+		}
+
+		const BoundingBox leaf_box = m_vecNodes[leaf].box;
+
+		// ǥ   þ  带 ã´.
+		uint32_t index = m_Root;
+		while (!m_vecNodes[index].IsLeaf())
+		{
+			const sNode& node = m_vecNodes[index];
+
+			const float area = SurfaceArea(node.box);
+			const float combined_area = SurfaceArea(Union(node.box, leaf_box));
+
+			// ⼭  θ  
+			const float cost = 2.0f * combined_area;
+			// Ʒ    ڽ ĿǷ ׸ŭ Ѵ.
+			const float inheritance_cost = 2.0f * (combined_area - area);
+
+			const auto descend_cost = [this, &leaf_box, inheritance_cost](uint32_t child)
+			{
+				const sNode& child_node = m_vecNodes[child];
+				const float union_area = SurfaceArea(Union(leaf_box, child_node.box));
+
+				if (child_node.IsLeaf())
+					return union_area + inheritance_cost;
+
+				return (union_area - SurfaceArea(child_node.box)) + inheritance_cost;
+			};
+
+			const float cost_left = descend_cost(node.child_left);
+			const float cost_right = descend_cost(node.child_right);
+
+			if (cost < cost_left && cost < cost_right)
+				break;
+
+			index = cost_left < cost_right ? node.child_left : node.child_right;
+		}
+
+		const uint32_t sibling = index;
+
+		//     带  θ .
+		const uint32_t old_parent = m_vecNodes[sibling].parent;
+		const uint32_t new_parent = AllocateNode();
+
+		m_vecNodes[new_parent].parent = old_parent;
+		m_vecNodes[new_parent].box = Union(leaf_box, m_vecNodes[sibling].box);
+		m_vecNodes[new_parent].height = m_vecNodes[sibling].height + 1;
+		m_vecNodes[new_parent].child_left = sibling;
+		m_vecNodes[new_parent].child_right = leaf;
+		m_vecNodes[sibling].parent = new_parent;
+		m_vecNodes[leaf].parent = new_parent;
+
+		if (old_parent != INVALID_NODE)
+		{
+			if (m_vecNodes[old_parent].child_left == sibling)
+				m_vecNodes[old_parent].child_left = new_parent;
+			else
+				m_vecNodes[old_parent].child_right = new_parent;
+		}
+		else
+		{
+			m_Root = new_parent;
+		}
+
+		// ö󰡸鼭  ߰ ڽ ̸ Ѵ.
+		index = m_vecNodes[leaf].parent;
+		while (index != INVALID_NODE)
+		{
+			index = Balance(index);
+
+			sNode& node = m_vecNodes[index];
+			node.height = 1 + max(m_vecNodes[node.child_left].height, m_vecNodes[node.child_right].height);
+			node.box = Union(m_vecNodes[node.child_left].box, m_vecNodes[node.child_right].box);
+
+			index = node.parent;
+		}
+	}
+
+	void SceneBVH::RemoveLeaf(uint32_t leaf)
+	{
+		if (leaf == m_Root)
+		{
+			m_Root = INVALID_NODE;
+			return;
+		}
+
+		const uint32_t parent = m_vecNodes[leaf].parent;
+		const uint32_t grand_parent = m_vecNodes[parent].parent;
+		const uint32_t sibling = m_vecNodes[parent].child_left == leaf ? m_vecNodes[parent].child_right : m_vecNodes[parent].child_left;
+
+		// θ ְ  带  ڸ ø.
+		if (grand_parent != INVALID_NODE)
+		{
+			if (m_vecNodes[grand_parent].child_left == parent)
+				m_vecNodes[grand_parent].child_left = sibling;
+			else
+				m_vecNodes[grand_parent].child_right = sibling;
+
+			m_vecNodes[sibling].parent = grand_parent;
+			FreeNode(parent);
+
+			uint32_t index = grand_parent;
+			while (index != INVALID_NODE)
+			{
+				index = Balance(index);
+
+				sNode& node = m_vecNodes[index];
+				node.height = 1 + max(m_vecNodes[node.child_left].height, m_vecNodes[node.child_right].height);
+				node.box = Union(m_vecNodes[node.child_left].box, m_vecNodes[node.child_right].box);
+
+				index = node.parent;
+			}
+		}
+		else
+		{
+			m_Root = sibling;
+			m_vecNodes[sibling].parent = INVALID_NODE;
+			FreeNode(parent);
+		}
+
+		m_vecNodes[leaf].parent = INVALID_NODE;
+	}
+
+	uint32_t SceneBVH::Balance(uint32_t index_a)
+	{
+		sNode& a = m_vecNodes[index_a];
+
+		if (a.IsLeaf() || a.height < 2)
+			return index_a;
+
+		const uint32_t index_b = a.child_left;
+		const uint32_t index_c = a.child_right;
+		sNode& b = m_vecNodes[index_b];
+		sNode& c = m_vecNodes[index_c];
+
+		const int32_t balance = c.height - b.height;
+
+		// (C)  ٸ C  ø.
+		if (balance > 1)
+		{
+			const uint32_t index_f = c.child_left;
+			const uint32_t index_g = c.child_right;
+			sNode& f = m_vecNodes[index_f];
+			sNode& g = m_vecNodes[index_g];
+
+			c.child_left = index_a;
+			c.parent = a.parent;
+			a.parent = index_c;
+
+			if (c.parent != INVALID_NODE)
+			{
+				if (m_vecNodes[c.parent].child_left == index_a)
+					m_vecNodes[c.parent].child_left = index_c;
+				else
+					m_vecNodes[c.parent].child_right = index_c;
+			}
+			else
+			{
+				m_Root = index_c;
+			}
+
+			//    C .
+			if (f.height > g.height)
+			{
+				c.child_right = index_f;
+				a.child_right = index_g;
+				g.parent = index_a;
+				a.box = Union(b.box, g.box);
+				c.box = Union(a.box, f.box);
+				a.height = 1 + max(b.height, g.height);
+				c.height = 1 + max(a.height, f.height);
+			}
+			else
+			{
+				c.child_right = index_g;
+				a.child_right = index_f;
+				f.parent = index_a;
+				a.box = Union(b.box, f.box);
+				c.box = Union(a.box, g.box);
+				a.height = 1 + max(b.height, f.height);
+				c.height = 1 + max(a.height, g.height);
+			}
+
+			return index_c;
+		}
+
+		// (B)  ٸ B  ø.
+		if (balance < -1)
+		{
+			const uint32_t index_d = b.child_left;
+			const uint32_t index_e = b.child_right;
+			sNode& d = m_vecNodes[index_d];
+			sNode& e = m_vecNodes[index_e];
+
+			b.child_left = index_a;
+			b.parent = a.parent;
+			a.parent = index_b;
+
+			if (b.parent != INVALID_NODE)
+			{
+				if (m_vecNodes[b.parent].child_left == index_a)
+					m_vecNodes[b.parent].child_left = index_b;
+				else
+					m_vecNodes[b.parent].child_right = index_b;
+			}
+			else
+			{
+				m_Root = index_b;
+			}
+
+			if (d.height > e.height)
+			{
+				b.child_right = index_d;
+				a.child_left = index_e;
+				e.parent = index_a;
+				a.box = Union(c.box, e.box);
+				b.box = Union(a.box, d.box);
+				a.height = 1 + max(c.height, e.height);
+				b.height = 1 + max(a.height, d.height);
+			}
+			else
+			{
+				b.child_right = index_e;
+				a.child_left = index_d;
+				d.parent = index_a;
+				a.box = Union(c.box, d.box);
+				b.box = Union(a.box, e.box);
+				a.height = 1 + max(c.height, d.height);
+				b.height = 1 + max(a.height, e.height);
+			}
+
+			return index_b;
+		}
+
+		return index_a;
+	}
+}
@@ -0,0 +1,213 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include "../Math/BoundingBox.h"
+#include "../Math/Frustum.h"
+#include "../Math/Ray.h"
+#include "../Math/Sphere.h"
+
+namespace PlayGround
+{
+	class Entity;
+
+	//    AABB   BVH
+	//     ڽ(fat AABB) Ƿ    Ʈ ġ ʴ´.
+	// Խ ǥ   þ  ã  ȸ  .
+	class SceneBVH
+	{
+	public:
+		static constexpr uint32_t INVALID_NODE = UINT32_MAX;
+
+		SceneBVH() = default;
+		~SceneBVH() = default;
+
+		//  带   ε(Ͻ) ȯѴ.
+		uint32_t Insert(Entity* entity, const Math::BoundingBox& box);
+		void Remove(uint32_t proxy);
+		// ڽ  ڽ   ٽ Ѵ. Ʈ ٲٸ true
+		bool Move(uint32_t proxy, const Math::BoundingBox& box);
+		void Clear();
+
+		inline uint32_t GetProxyCount() const { return m_ProxyCount; }
+		inline const Math::BoundingBox& GetFatBox(uint32_t proxy) const { return m_vecNodes[proxy].box; }
+
+		// ڽ ġ ƼƼ function(Entity*) ȣѴ.
+		template <typename Function>
+		void QueryAabb(const Math::BoundingBox& box, Function&& function) const
+		{
+			Query([&box](const Math::BoundingBox& node_box)
+			{
+				return Overlaps(box, node_box) ? Math::Intersection::Intersects : Math::Intersection::Outside;
+			}, function);
+		}
+
+		//  ġ ƼƼ function(Entity*) ȣѴ.
+		template <typename Function>
+		void QuerySphere(const Math::Sphere& sphere, Function&& function) const
+		{
+			Query([&sphere](const Math::BoundingBox& node_box)
+			{
+				return Overlaps(sphere, node_box) ? Math::Intersection::Intersects : Math::Intersection::Outside;
+			}, function);
+		}
+
+		//  ȿ ִ ƼƼ function(Entity*) ȣѴ.
+		// 尡 ° ȿ ִٸ  Ʒ ˻ ʴ´.
+		template <typename Function>
+		void QueryFrustum(const Math::Frustum& frustum, bool ignore_near_plane, Function&& function) const
+		{
+			Query([&frustum, ignore_near_plane](const Math::BoundingBox& node_box)
+			{
+				return frustum.CheckAabb(node_box.GetCenter(), node_box.GetExtents(), ignore_near_plane);
+			}, function);
+		}
+
+		//  ڽ  ƼƼ  ڽ function(Entity*, box_distance) ѱ.
+		// function  浹 Ÿ ȯϸ (ٸ INFINITY)
+		// ̹ ã Ÿ   ǳʶڴ.   ƼƼ ȯѴ.
+		template <typename Function>
+		Entity* RayCast(const Math::Ray& ray, Function&& function, float* out_distance = nullptr) const
+		{
+			Entity* closest = nullptr;
+			float closest_distance = Math::Util::INFINITY_;
+
+			if (m_Root != INVALID_NODE)
+			{
+				const Math::Vector3& origin = ray.GetStart();
+				const Math::Vector3 inverse_direction = Math::Vector3(1.0f / ray.GetDirection().x, 1.0f / ray.GetDirection().y, 1.0f / ray.GetDirection().z);
+
+				// (, ڽ Ÿ)
+				std::vector<std::pair<uint32_t, float>> stack;
+				stack.reserve(64);
+
+				const float root_distance = RayDistance(origin, inverse_direction, m_vecNodes[m_Root].box);
+				if (root_distance != Math::Util::INFINITY_)
+					stack.emplace_back(m_Root, root_distance);
+
+				while (!stack.empty())
+				{
+					const auto [index, distance] = stack.back();
+					stack.pop_back();
+
+					if (distance >= closest_distance)
+						continue;
+
+					const sNode& node = m_vecNodes[index];
+
+					if (node.IsLeaf())
+					{
+						const float hit_distance = function(node.entity, distance);
+
+						if (hit_distance < closest_distance)
+						{
+							closest_distance = hit_distance;
+							closest = node.entity;
+						}
+
+						continue;
+					}
+
+					const float distance_left = RayDistance(origin, inverse_direction, m_vecNodes[node.child_left].box);
+					const float distance_right = RayDistance(origin, inverse_direction, m_vecNodes[node.child_right].box);
+
+					//  ڽ ߿ ־   Ѵ.
+					if (distance_left <= distance_right)
+					{
+						if (distance_right < closest_distance)
+							stack.emplace_back(node.child_right, distance_right);
+						if (distance_left < closest_distance)
+							stack.emplace_back(node.child_left, distance_left);
+					}
+					else
+					{
+						if (distance_left < closest_distance)
+							stack.emplace_back(node.child_left, distance_left);
+						if (distance_right < closest_distance)
+							stack.emplace_back(node.child_right, distance_right);
+					}
+				}
+			}
+
+			if (out_distance)
+				*out_distance = closest_distance;
+
+			return closest;
+		}
+
+	private:
+		struct sNode
+		{
+			inline bool IsLeaf() const { return child_left == INVALID_NODE; }
+
+			Math::BoundingBox box;
+			Entity* entity = nullptr;
+			//      
+			uint32_t parent = INVALID_NODE;
+			uint32_t child_left = INVALID_NODE;
+			uint32_t child_right = INVALID_NODE;
+			//   0,   -1
+			int32_t height = -1;
+		};
+
+		// test(box) Outside ǳʶٰ Inside Ʒ  带 ˻   ѱ.
+		template <typename Test, typename Function>
+		void Query(Test&& test, Function& function) const
+		{
+			if (m_Root == INVALID_NODE)
+				return;
+
+			// (, ˻簡 ʿ)
+			std::vector<std::pair<uint32_t, bool>> stack;
+			stack.reserve(64);
+			stack.emplace_back(m_Root, true);
+
+			while (!stack.empty())
+			{
+				const auto [index, needs_test] = stack.back();
+				stack.pop_back();
+
+				const sNode& node = m_vecNodes[index];
+				bool test_children = needs_test;
+
+				if (needs_test)
+				{
+					const Math::Intersection result = test(node.box);
+
+					if (result == Math::Intersection::Outside)
+						continue;
+
+					test_children = result != Math::Intersection::Inside;
+				}
+
+				if (node.IsLeaf())
+				{
+					function(node.entity);
+					continue;
+				}
+
+				stack.emplace_back(node.child_left, test_children);
+				stack.emplace_back(node.child_right, test_children);
+			}
+		}
+
+		static bool Overlaps(const Math::BoundingBox& a, const Math::BoundingBox& b);
+		static bool Overlaps(const Math::Sphere& sphere, const Math::BoundingBox& box);
+		// ڽ Ÿ (  INFINITY, ȿ ִٸ 0)
+		static float RayDistance(const Math::Vector3& origin, const Math::Vector3& inverse_direction, const Math::BoundingBox& box);
+		static float SurfaceArea(const Math::BoundingBox& box);
+		static Math::BoundingBox Union(const Math::BoundingBox& a, const Math::BoundingBox& b);
+
+		uint32_t AllocateNode();
+		void FreeNode(uint32_t index);
+		void InsertLeaf(uint32_t leaf);
+		void RemoveLeaf(uint32_t leaf);
+		//  ̰ 1 ũ ȸŰ ο κ Ʈ Ʈ ȯѴ.
+		uint32_t Balance(uint32_t index);
+
+		std::vector<sNode> m_vecNodes;
+		uint32_t m_Root = INVALID_NODE;
+		uint32_t m_FreeList = INVALID_NODE;
+		uint32_t m_ProxyCount = 0;
+	};
+}
@@ -0,0 +1,446 @@
+#include "Common.h"
+#include "TransformStore.h"
+#include "Components/Transform.h"
+#include "../Threading/Threading.h"
+#include "../Core/Context.h"
+
+using namespace std;
+using namespace PlayGround::Math;
+
+namespace PlayGround
+{
+	//  ̿  ̻ Ʈ    Ѵ.
+	static constexpr uint32_t PARALLEL_LEVEL_SIZE = 2048;
+	static constexpr uint32_t PARALLEL_GRAIN = 512;
+
+	TransformStore::TransformStore(Context* context)
+	{
+		m_Context = context;
+		m_Threading = context->GetSubModule<Threading>();
+		m_UpdateThread = this_thread::get_id();
+	}
+
+	uint32_t TransformStore::Allocate(Transform* owner)
+	{
+		lock_guard<mutex> lock(m_Mutex);
+
+		// INVALID_INDEX  ʴ´.
+		if (m_Count >= INVALID_INDEX)
+		{
+			LOG_ERROR("Transform store is full (%u transforms)", m_Count);
+			return INVALID_INDEX;
+		}
+
+		const uint32_t index = m_Count;
+
+		m_LocalPositions.Reserve(index);
+		m_LocalRotations.Reserve(index);
+		m_LocalScales.Reserve(index);
+		m_LocalMatrices.Reserve(index);
+		m_Matrices.Reserve(index);
+		m_Parents.Reserve(index);
+		m_Dirty.Reserve(index);
+		m_Moved.Reserve(index);
+		m_Owners.Reserve(index);
+
+		m_LocalPositions[index] = Vector3::Zero;
+		m_LocalRotations[index] = Quaternion(0, 0, 0, 1);
+		m_LocalScales[index] = Vector3::One;
+		m_LocalMatrices[index] = Matrix::Identity;
+		m_Matrices[index] = Matrix::Identity;
+		m_Parents[index] = INVALID_INDEX;
+		m_Dirty[index] = 1;
+		m_Moved[index] = 0;
+		m_Owners[index] = owner;
+
+		m_Count++;
+		m_NeedsSort = true;
+
+		return index;
+	}
+
+	void TransformStore::Release(uint32_t index)
+	{
+		lock_guard<mutex> lock(m_Mutex);
+
+		if (index >= m_Count)
+			return;
+
+		m_Owners[index] = nullptr;
+		m_Parents[index] = INVALID_INDEX;
+		m_Dirty[index] = 0;
+		m_NeedsSort = true;
+	}
+
+	void TransformStore::SetParent(uint32_t index, uint32_t parent_index)
+	{
+		ASSERT(!m_IsUpdating);
+
+		{
+			lock_guard<mutex> lock(m_Mutex);
+
+			if (m_Parents[index] != parent_index)
+			{
+				m_Parents[index] = parent_index;
+
+				// Ʈ Ǵ  ڼ   ״̹Ƿ  ʿ䰡 .
+				if (parent_index != INVALID_INDEX)
+					m_NeedsSort = true;
+			}
+		}
+
+		MarkDirty(index);
+	}
+
+	void TransformStore::SetLocalPosition(uint32_t index, const Vector3& position)
+	{
+		ASSERT(!m_IsUpdating);
+
+		m_LocalPositions[index] = position;
+		MarkDirty(index);
+	}
+
+	void TransformStore::SetLocalRotation(uint32_t index, const Quaternion& rotation)
+	{
+		ASSERT(!m_IsUpdating);
+
+		m_LocalRotations[index] = rotation;
+		MarkDirty(index);
+	}
+
+	void TransformStore::SetLocalScale(uint32_t index, const Vector3& scale)
+	{
+		ASSERT(!m_IsUpdating);
+
+		m_LocalScales[index] = scale;
+		MarkDirty(index);
+	}
+
+	void TransformStore::MarkDirty(uint32_t index)
+	{
+		ASSERT(!m_IsUpdating);
+
+		lock_guard<mutex> lock(m_Mutex_moved);
+
+		//  Ҵ  Ƽ  Ͽ Ƿ   ȮѴ.
+		if (m_Dirty[index] && m_Moved[index])
+			return;
+
+		//    ڼյ 湮Ѵ.
+		vector<uint32_t> stack;
+		stack.emplace_back(index);
+
+		while (!stack.empty())
+		{
+			const uint32_t current = stack.back();
+			stack.pop_back();
+
+			if (m_Dirty[current] && m_Moved[current])
+				continue;
+
+			m_Dirty[current] = 1;
+
+			if (!m_Moved[current])
+			{
+				m_Moved[current] = 1;
+				m_vecMoved.emplace_back(current);
+			}
+
+			Transform* owner = m_Owners[current];
+
+			if (!owner)
+				continue;
+
+			for (Transform* child : owner->GetChildren())
+			{
+				const uint32_t child_index = child->GetStoreIndex();
+
+				if (child_index != INVALID_INDEX && !(m_Dirty[child_index] && m_Moved[child_index]))
+					stack.emplace_back(child_index);
+			}
+		}
+	}
+
+	Matrix TransformStore::GetMatrix(uint32_t index)
+	{
+		if (!m_Dirty[index])
+			return m_Matrices[index];
+
+		// Ƽ     Ѵ.
+		uint32_t chain[64];
+		uint32_t chain_count = 0;
+		uint32_t current = index;
+
+		while (current != INVALID_INDEX && m_Dirty[current])
+		{
+			//   ٸ θ  ؼ ü .
+			if (chain_count == 64)
+			{
+				GetMatrix(current);
+				break;
+			}
+
+			chain[chain_count++] = current;
+			current = m_Parents[current];
+		}
+
+		while (chain_count > 0)
+		{
+			ComputeMatrix(chain[--chain_count]);
+		}
+
+		return m_Matrices[index];
+	}
+
+	Matrix TransformStore::GetLocalMatrix(uint32_t index)
+	{
+		if (m_Dirty[index])
+			GetMatrix(index);
+
+		return m_LocalMatrices[index];
+	}
+
+	void TransformStore::ComputeMatrix(uint32_t index)
+	{
+		m_LocalMatrices[index] = Matrix(m_LocalPositions[index], m_LocalRotations[index], m_LocalScales[index]);
+
+		ComputeWorldMatrix(index);
+	}
+
+	void TransformStore::ComputeWorldMatrix(uint32_t index)
+	{
+		const uint32_t parent = m_Parents[index];
+
+		// θ   θ  Ѵ.
+		if (parent != INVALID_INDEX)
+			m_Matrices[index] = m_LocalMatrices[index] * m_Matrices[parent];
+		else
+			m_Matrices[index] = m_LocalMatrices[index];
+
+		m_Dirty[index] = 0;
+	}
+
+	void TransformStore::TakeMoved(vector<Transform*>* transforms)
+	{
+		ASSERT(this_thread::get_id() == m_UpdateThread);
+
+		transforms->clear();
+
+		lock_guard<mutex> lock(m_Mutex_moved);
+
+		for (const uint32_t index : m_vecMoved)
+		{
+			m_Moved[index] = 0;
+
+			//   ǳʶڴ.
+			if (m_Owners[index])
+				transforms->emplace_back(m_Owners[index]);
+		}
+
+		m_vecMoved.clear();
+	}
+
+	void TransformStore::Update()
+	{
+		//  Ʈ  ٸ ܰ谡    Ѵ.
+		ASSERT(this_thread::get_id() == m_UpdateThread);
+
+		m_IsUpdating = true;
+
+		vector<uint32_t> level_offsets;
+
+		{
+			lock_guard<mutex> lock(m_Mutex);
+
+			if (m_NeedsSort)
+				Sort();
+
+			level_offsets = m_vecLevelOffsets;
+		}
+
+		//   Ʈ   Ƿ
+		//   ϸ鼭   ȿ ķ   ִ.
+		const auto update_range = [this](uint32_t start, uint32_t end)
+		{
+			ComputeRange(start, end);
+		};
+
+		for (size_t level = 0; level + 1 < level_offsets.size(); level++)
+		{
+			const uint32_t start = level_offsets[level];
+			const uint32_t end = level_offsets[level + 1];
+
+			if (m_Threading && end - start >= PARALLEL_LEVEL_SIZE)
+				m_Threading->ParallelFor(start, end, PARALLEL_GRAIN, update_range);
+			else
+				update_range(start, end);
+		}
+
+		m_IsUpdating = false;
+	}
+
+	void TransformStore::ComputeRange(uint32_t start, uint32_t end)
+	{
+		static constexpr uint32_t PAGE_SIZE = TransformPagedArray<Matrix>::PAGE_SIZE;
+
+		uint32_t i = start;
+
+		while (i < end)
+		{
+			if (!m_Dirty[i])
+			{
+				i++;
+				continue;
+			}
+
+			//   ȿ ӵ Ƽ  ޸𸮰 ̾ Ƿ   ѹ .
+			const uint32_t page_end = (i / PAGE_SIZE + 1) * PAGE_SIZE;
+			uint32_t run_end = i + 1;
+
+			while (run_end < end && run_end < page_end && m_Dirty[run_end])
+			{
+				run_end++;
+			}
+
+			const size_t count = run_end - i;
+			Matrix::ComposeTRS(
+				span<const Vector3>(&m_LocalPositions[i], count),
+				span<const Quaternion>(&m_LocalRotations[i], count),
+				span<const Vector3>(&m_LocalScales[i], count),
+				span<Matrix>(&m_LocalMatrices[i], count)
+			);
+
+			// θ  ٸǷ ϳ Ѵ.
+			for (uint32_t j = i; j < run_end; j++)
+			{
+				ComputeWorldMatrix(j);
+			}
+
+			i = run_end;
+		}
+	}
+
+	void TransformStore::Sort()
+	{
+		// ִ  ̸ Ѵ.
+		// θ Ǿٸ Ʈ Ѵ.
+		static constexpr uint32_t UNKNOWN_DEPTH = UINT32_MAX;
+		vector<uint32_t> depths(m_Count, UNKNOWN_DEPTH);
+		vector<uint32_t> path;
+		uint32_t max_depth = 0;
+
+		for (uint32_t i = 0; i < m_Count; i++)
+		{
+			if (!m_Owners[i] || depths[i] != UNKNOWN_DEPTH)
+				continue;
+
+			// ̸ ƴ ̳ Ʈ ö󰣴.
+			path.clear();
+			uint32_t current = i;
+
+			while (current != INVALID_INDEX && depths[current] == UNKNOWN_DEPTH)
+			{
+				if (m_Parents[current] != INVALID_INDEX && !m_Owners[m_Parents[current]])
+					m_Parents[current] = INVALID_INDEX;
+
+				path.emplace_back(current);
+				current = m_Parents[current];
+			}
+
+			uint32_t depth = current == INVALID_INDEX ? 0 : depths[current] + 1;
+
+			for (auto it = path.rbegin(); it != path.rend(); it++)
+			{
+				depths[*it] = depth++;
+			}
+
+			max_depth = max(max_depth, depths[i]);
+		}
+
+		// ̺    ġ Ѵ. ( )
+		vector<uint32_t> offsets(max_depth + 2, 0);
+
+		for (uint32_t i = 0; i < m_Count; i++)
+		{
+			if (m_Owners[i])
+				offsets[depths[i] + 1]++;
+		}
+
+		for (uint32_t level = 1; level < offsets.size(); level++)
+		{
+			offsets[level] += offsets[level - 1];
+		}
+
+		const uint32_t alive_count = offsets.back();
+
+		//   ->  
+		vector<uint32_t> remap(m_Count, INVALID_INDEX);
+		{
+			vector<uint32_t> cursor(offsets.begin(), offsets.end() - 1);
+
+			for (uint32_t i = 0; i < m_Count; i++)
+			{
+				if (m_Owners[i])
+					remap[i] = cursor[depths[i]]++;
+			}
+		}
+
+		//     ǵ .
+		vector<Vector3> positions(alive_count);
+		vector<Quaternion> rotations(alive_count);
+		vector<Vector3> scales(alive_count);
+		vector<Matrix> local_matrices(alive_count);
+		vector<Matrix> matrices(alive_count);
+		vector<uint32_t> parents(alive_count);
+		vector<uint8_t> dirty(alive_count);
+		vector<uint8_t> moved(alive_count);
+		vector<Transform*> owners(alive_count);
+
+		for (uint32_t i = 0; i < m_Count; i++)
+		{
+			const uint32_t to = remap[i];
+
+			if (to == INVALID_INDEX)
+				continue;
+
+			positions[to] = m_LocalPositions[i];
+			rotations[to] = m_LocalRotations[i];
+			scales[to] = m_LocalScales[i];
+			local_matrices[to] = m_LocalMatrices[i];
+			matrices[to] = m_Matrices[i];
+			parents[to] = m_Parents[i] == INVALID_INDEX ? INVALID_INDEX : remap[m_Parents[i]];
+			dirty[to] = m_Dirty[i];
+			moved[to] = m_Moved[i];
+			owners[to] = m_Owners[i];
+		}
+
+		for (uint32_t i = 0; i < alive_count; i++)
+		{
+			m_LocalPositions[i] = positions[i];
+			m_LocalRotations[i] = rotations[i];
+			m_LocalScales[i] = scales[i];
+			m_LocalMatrices[i] = local_matrices[i];
+			m_Matrices[i] = matrices[i];
+			m_Parents[i] = parents[i];
+			m_Dirty[i] = dirty[i];
+			m_Moved[i] = moved[i];
+			m_Owners[i] = owners[i];
+
+			// Ʈ  ε Ѵ.
+			owners[i]->m_StoreIndex = i;
+		}
+
+		// Ƽ Ǿ  ϵ   ű.
+		uint32_t moved_count = 0;
+		for (const uint32_t index : m_vecMoved)
+		{
+			if (remap[index] != INVALID_INDEX)
+				m_vecMoved[moved_count++] = remap[index];
+		}
+		m_vecMoved.resize(moved_count);
+
+		m_Count = alive_count;
+		m_vecLevelOffsets = move(offsets);
+		m_NeedsSort = false;
+	}
+}
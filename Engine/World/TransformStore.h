@@ -0,0 +1,192 @@
+#pragma once
+
+#include <vector>
+#include <array>
+#include <memory>
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include "../Math/Vector3.h"
+#include "../Math/Quaternion.h"
+#include "../Math/Matrix.h"
+
+namespace PlayGround
+{
+	class Context;
+	class Threading;
+	class Transform;
+
+	//   ҴǴ 迭
+	// ũⰡ þ   ּҰ ٲ Ƿ
+	// ٸ 尡 Ʈ ߰ϴ ߿ а ִ   ʴ´.
+	// (  ü TransformStore::Sort ٸ  Ű  ִ.)
+	//  ͸ ->  2ܰ ã 32Ʈ ε ü   ִ.
+	// ʹ  ԽõǹǷ д   ʴ´. (Reserve  ؽ ȿ ȣȴ.)
+	template <typename T>
+	class TransformPagedArray
+	{
+	public:
+		static constexpr uint32_t PAGE_SIZE = 1024;
+		static constexpr uint32_t PAGES_PER_DIRECTORY = 1024;
+		static constexpr uint32_t MAX_DIRECTORIES = 4096;
+
+		TransformPagedArray() = default;
+		TransformPagedArray(const TransformPagedArray&) = delete;
+		TransformPagedArray& operator=(const TransformPagedArray&) = delete;
+
+		~TransformPagedArray()
+		{
+			for (std::atomic<Directory*>& entry : m_Directories)
+			{
+				Directory* directory = entry.load(std::memory_order_relaxed);
+
+				if (!directory)
+					continue;
+
+				for (std::atomic<T*>& page : directory->pages)
+				{
+					delete[] page.load(std::memory_order_relaxed);
+				}
+
+				delete directory;
+			}
+		}
+
+		inline T& operator[](uint32_t index) { return GetPage(index)[index % PAGE_SIZE]; }
+		inline const T& operator[](uint32_t index) const { return GetPage(index)[index % PAGE_SIZE]; }
+
+		// index   ֵ  ҴѴ.
+		void Reserve(uint32_t index)
+		{
+			std::atomic<Directory*>& entry = m_Directories[index / (PAGE_SIZE * PAGES_PER_DIRECTORY)];
+			Directory* directory = entry.load(std::memory_order_relaxed);
+
+			if (!directory)
+			{
+				directory = new Directory();
+				entry.store(directory, std::memory_order_release);
+			}
+
+			std::atomic<T*>& page = directory->pages[(index / PAGE_SIZE) % PAGES_PER_DIRECTORY];
+
+			if (!page.load(std::memory_order_relaxed))
+				page.store(new T[PAGE_SIZE](), std::memory_order_release);
+		}
+
+	private:
+		struct Directory
+		{
+			std::array<std::atomic<T*>, PAGES_PER_DIRECTORY> pages = {};
+		};
+
+		inline T* GetPage(uint32_t index) const
+		{
+			const Directory* directory = m_Directories[index / (PAGE_SIZE * PAGES_PER_DIRECTORY)].load(std::memory_order_acquire);
+
+			return directory->pages[(index / PAGE_SIZE) % PAGES_PER_DIRECTORY].load(std::memory_order_acquire);
+		}
+
+		std::array<std::atomic<Directory*>, MAX_DIRECTORIES> m_Directories = {};
+	};
+
+	//  Ʈ    Ʈ 迭(SoA)  Ѵ.
+	//  ٲ Ƽ ÷׸  (ڼձ )
+	//  Ӹ   ĵ 迭 ѹ  ϰų
+	//    ʿ ϸ ׶ θ Ѵ.
+	//   ͸ űǷ Update Ͼ. Update  ܰ( ) ȣǸ
+	//  ȿ Ʈ  ٸ ܰ谡  ʴ´. (FrameResource_Transform)
+	//
+	//  Ģ
+	// -  Ҵ, , θ    ؽ ȣǹǷ  忡 ȣ  ִ.
+	// -  (SetLocal*, MarkDirty)  ʰ Կ ٷ Ƿ Update ġ ȵȴ.
+	//   FrameResource_Transform  ܰ質  忡 .  ׷  ۾ 忡
+	//   带 ٲ ʴ´. (ġ ASSERT ´.)
+	// -  Ʈ  忡 ÿ  ʴ´.
+	class TransformStore
+	{
+	public:
+		static constexpr uint32_t INVALID_INDEX = UINT32_MAX;
+
+		TransformStore(Context* context);
+		~TransformStore() = default;
+
+		//  Ҵ 
+		//    Ķ ǹǷ    ʴ´.
+		//  ʿ  þ 32Ʈ ε     ʴ´.
+		uint32_t Allocate(Transform* owner);
+		void Release(uint32_t index);
+
+		// θ  (INVALID_INDEX Ʈ)
+		void SetParent(uint32_t index, uint32_t parent_index);
+
+		inline const Math::Vector3& GetLocalPosition(uint32_t index) const { return m_LocalPositions[index]; }
+		inline const Math::Quaternion& GetLocalRotation(uint32_t index) const { return m_LocalRotations[index]; }
+		inline const Math::Vector3& GetLocalScale(uint32_t index) const { return m_LocalScales[index]; }
+
+		void SetLocalPosition(uint32_t index, const Math::Vector3& position);
+		void SetLocalRotation(uint32_t index, const Math::Quaternion& rotation);
+		void SetLocalScale(uint32_t index, const Math::Vector3& scale);
+
+		// ڽŰ  ڼ Ƽ ǥѴ.
+		// Ƽ Ʈ ڼ ׻ Ƽ̹Ƿ ̹ Ƽ̰  Ͽ ִٸ ٷ ȯѴ.
+		void MarkDirty(uint32_t index);
+
+		inline bool IsDirty(uint32_t index) const { return m_Dirty[index] != 0; }
+
+		//  ȣ  Ƽ Ǿ Ʈ ѱ  . ( )
+		//  ̸ ؼ Ƽ  Ʈ Եȴ.
+		void TakeMoved(std::vector<Transform*>* transforms);
+
+		// Ƽ Ƽ    ȯѴ.
+		//  ĵǸ ŰǷ  ȯѴ.
+		Math::Matrix GetMatrix(uint32_t index);
+		Math::Matrix GetLocalMatrix(uint32_t index);
+
+		// ʿϴٸ   ٽ ϰ Ƽ Ʈ  Ѵ.
+		//   ( ) ȣѴ.
+		void Update();
+
+		inline uint32_t GetCount() const { return m_Count; }
+
+	private:
+		// ִ     ϰ ̺  ٽ .
+		void Sort();
+		//  Ʈ  Ѵ. (θ ̹ Ǿ ־ Ѵ.)
+		void ComputeMatrix(uint32_t index);
+		//  Ŀ θ  ؼ   Ƽ .
+		void ComputeWorldMatrix(uint32_t index);
+		// [start, end)  Ƽ Ʈ  Ѵ.
+		void ComputeRange(uint32_t start, uint32_t end);
+
+		Context* m_Context = nullptr;
+		Threading* m_Threading = nullptr;
+
+		TransformPagedArray<Math::Vector3> m_LocalPositions;
+		TransformPagedArray<Math::Quaternion> m_LocalRotations;
+		TransformPagedArray<Math::Vector3> m_LocalScales;
+		TransformPagedArray<Math::Matrix> m_LocalMatrices;
+		TransformPagedArray<Math::Matrix> m_Matrices;
+		TransformPagedArray<uint32_t> m_Parents;
+		TransformPagedArray<uint8_t> m_Dirty;
+		// m_vecMoved ִ 
+		TransformPagedArray<uint8_t> m_Moved;
+		TransformPagedArray<Transform*> m_Owners;
+
+		// Ƽ Ǿ Ե (   ű.)
+		std::vector<uint32_t> m_vecMoved;
+		//  ϰ Ƽ (m_Dirty, m_Moved  ) ȣѴ.
+		// ó ۾ 忡  Ʈ ÿ  찡 ִ.
+		std::mutex m_Mutex_moved;
+		//    (  )
+		uint32_t m_Count = 0;
+		// ̺   ( Ҵ )
+		std::vector<uint32_t> m_vecLevelOffsets;
+		// θ ٲų  ߰, Ǿ ٽ ؾ ϴ
+		bool m_NeedsSort = false;
+		//  Ҵ, ,  ȣѴ.
+		std::mutex m_Mutex;
+		//   Լ  Ƿ Update(İ ) ġ ʾҴ ȮѴ.
+		std::atomic<bool> m_IsUpdating = false;
+		std::thread::id m_UpdateThread;
+	};
+}
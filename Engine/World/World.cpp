@@ -1,20 +1,28 @@
 #include "Common.h"
 #include "World.h"
 #include "Entity.h"
+#include "TransformStore.h"
+#include "SceneBVH.h"
+#include "WorldPartition.h"
 #include "Components/Transform.h"
 #include "Components/Camera.h"
 #include "Components/Light.h"
+#include "Components/Renderable.h"
 #include "Components/Environment.h"
 #include "Components/AudioListener.h"
+#include "Components/Animator.h"
 #include "TransformHandle/TransformHandle.h"
 #include "../Resource/ResourceCache.h"
 #include "../Resource/ProgressTracker.h"
 #include "../IO/FileStream.h"
+#include "../IO/AssetContainer.h"
+#include "../Threading/Threading.h"
 #include "../Profiling/Profiler.h"
 #include "../Input/Input.h"
 #include "../RHI/RHI_Device.h"
 #include "../Rendering/Renderer.h"
 #include "../Core/Context.h"
+#include "../Core/FrameStages.h"
 #include "../Core/Engine.h"
 
 using namespace std;
@@ -22,8 +30,19 @@ using namespace PlayGround::Math;
 
 namespace PlayGround
 {
+	//   
+	// [][][Ʈ ][Ʈ (, ũ)][Ʈ Ʈ...]
+	//    Ʈ  ϴ  ̴.
+	//  (WorldPartition)    ϳ ´.
+	static constexpr uint32_t WORLD_FILE_MAGIC = AssetChunkId('P', 'G', 'W', 'L');
+	static constexpr uint32_t WORLD_FILE_VERSION = 1;
+
 	World::World(Context* context) : SubModule(context)
 	{
+		m_TransformStore = make_unique<TransformStore>(context);
+		m_SceneBVH = make_unique<SceneBVH>();
+		m_MainThread = this_thread::get_id();
+
 		//  ֺ ݹ Լ Ѵ.
 		SUBSCRIBE_TO_EVENT(EventType::WorldResolve, [this](Variant) { m_Resolve = true; });
 	}
@@ -66,7 +85,15 @@ namespace PlayGround
 
 	void World::Update(double delta_time)
 	{
-	
+		UpdateEntities(delta_time);
+		UpdateTransforms();
+	}
+
+	void World::UpdateEntities(double delta_time)
+	{
+		// ҽ ٸ  ε Ѵ.
+		FinishLoad();
+
 		//  ε  ʾ 
 		if (IsLoading())
 			return;
@@ -74,6 +101,29 @@ namespace PlayGround
 		// ϸ 
 		SCOPED_TIME_BLOCK(m_Profiler);
 
+		// ۾ 尡  ۾ óѴ. (۾ ȿ ٽ  ۾  ӿ óѴ.)
+		{
+			vector<function<void()>> tasks;
+			{
+				lock_guard<mutex> lock(m_Mutex_main_thread);
+				tasks.swap(m_vecMainThreadTasks);
+			}
+
+			for (function<void()>& task : tasks)
+			{
+				task();
+			}
+		}
+
+		// ī޶ ֺ  ø .
+		if (m_Partition)
+		{
+			Renderer* renderer = m_Context->GetSubModule<Renderer>();
+
+			if (renderer && renderer->GetCamera())
+				m_Partition->Update(renderer->GetCamera()->GetTransform()->GetPosition());
+		}
+
 		{
 			//   
 			//  Ӹ  ӿ  忴ٸ 
@@ -131,8 +181,11 @@ namespace PlayGround
 
 		if (m_Resolve)
 		{
+			m_Resolve = false;
+
 			{
 				// ƼƼ  
+				// ڽ θ Բ ǹǷ ̹  ƼƼ _EntityRemove ǳʶڴ.
 				auto entities_copy = m_vecEntities;
 
 				for (auto& entity : entities_copy)
@@ -143,15 +196,50 @@ namespace PlayGround
 			}
 
 			// ̺Ʈ ߻
-			FIRE_EVENT_DATA(EventType::WorldResolved, m_vecEntities);
-
-			m_Resolve = true;
+			//  ƼƼ  ̺Ʈ  ϹǷ ƼƼ  ؼ ѱ ʴ´.
+			FIRE_EVENT(EventType::WorldResolved);
 		}
 
 		// ù Ʈ  
 		m_FirstRun = true;
 	}
 
+	void World::UpdateTransforms()
+	{
+		if (IsLoading())
+			return;
+
+		SCOPED_TIME_BLOCK(m_Profiler);
+
+		// ̹ ӿ Ƽ  Ʈ   ѹ Ѵ.
+		m_TransformStore->Update();
+
+		// Ų  ؽ ڽ   ٲ۴.
+		UpdateAnimators();
+
+		// Ʈ ٲ  ڽ BVH ݿѴ.
+		SceneProxyRefit();
+	}
+
+	void World::QueueMainThread(function<void()>&& task)
+	{
+		lock_guard<mutex> lock(m_Mutex_main_thread);
+		m_vecMainThreadTasks.emplace_back(move(task));
+	}
+
+	bool World::RegisterFrameStages(FrameGraph& graph, ETickType tick_group)
+	{
+		// Ʈ Update Ʈ ű ٵ,  ҽ ϸ
+		//  Ʈְ ƼƼ ,    ٲٹǷ  ڿ  .
+		// ׷  ũƮ Ʈ ġ ϰ  Ʈ   ٸ ͸ ģ.
+		graph.AddStage(FrameStages::WORLD, tick_group, [this](double delta_time) { UpdateEntities(delta_time); });
+		// Ʈ Ŀ Ű, BVH  ƼƼ  б⸸ ϰ ,  ǵ帮 ʴ´.
+		// Ʈ Ҵ  忡   Ƿ  忡 Ѵ.
+		graph.AddStage(FrameStages::WORLD_TRANSFORMS, tick_group, [this](double) { UpdateTransforms(); });
+
+		return true;
+	}
+
 	void World::New()
 	{
 		Clear();
@@ -160,6 +248,13 @@ namespace PlayGround
 
 	bool World::SaveToFile(const string& file_path)
 	{
+		// Ʈ ߿ ε  忡 Ƿ ״ ϸ   Ҵ´.
+		if (m_Partition)
+		{
+			LOG_ERROR("A streamed world can't be saved, load the source world and save it instead.");
+			return false;
+		}
+
 		// ƮĿ 
 		ProgressTracker::Get().Reset(EProgressType::World);
 		ProgressTracker::Get().SetIsLoading(EProgressType::World, true);
@@ -190,38 +285,124 @@ namespace PlayGround
 
 		// Ʈ ƼƼ ´.
 		vector<shared_ptr<Entity>> root_actors = EntityGetRoots();
-		// Ʈ ƼƼ  ´.
-		const uint32_t root_entity_count = static_cast<uint32_t>(root_actors.size());
 
 		// ŭ ƮĿ 
-		ProgressTracker::Get().SetJobCount(EProgressType::World, root_entity_count);
+		ProgressTracker::Get().SetJobCount(EProgressType::World, static_cast<uint32_t>(root_actors.size()));
 
-		//  
-		file->Write(root_entity_count);
+		//   
+		SaveSubtrees(file.get(), root_actors);
+		file->Close();
+
+		ProgressTracker::Get().SetIsLoading(EProgressType::World, false);
+		LOG_INFO("World \"%s\" has been saved. Duration %.2f ms", m_FilePath.c_str(), timer.GetElapsedTimeMS());
 
-		// ̵ 
-		for (auto& root : root_actors)
+		//   ̺Ʈ ߻
+		FIRE_EVENT(EventType::WorldSavedEnd);
+
+		return true;
+	}
+
+	bool World::SaveToFilePartitioned(const string& file_path, float cell_size)
+	{
+		if (m_Partition)
 		{
-			file->Write(root->GetObjectID());
+			LOG_ERROR("A streamed world can't be saved, load the source world and save it instead.");
+			return false;
 		}
 
-		//   
-		for (auto& root : root_actors)
+		if (cell_size <= 0.0f)
 		{
-			root->Serialize(file.get());
-			ProgressTracker::Get().IncrementJobsDone(EProgressType::World);
+			LOG_ERROR("Invalid cell size %f", cell_size);
+			return false;
 		}
 
-		ProgressTracker::Get().SetIsLoading(EProgressType::World, false);
-		LOG_INFO("World \"%s\" has been saved. Duration %.2f ms", m_FilePath.c_str(), timer.GetElapsedTimeMS());
+		const StopWatch timer;
+
+		string path = file_path;
+		if (FileSystem::GetExtensionFromFilePath(file_path) != EXTENSION_WORLD)
+		{
+			path += EXTENSION_WORLD;
+		}
+
+		FIRE_EVENT(EventType::WorldSaveStart);
+
+		const bool success = WorldPartition::Save(this, path, cell_size);
+
+		if (success)
+			LOG_INFO("World \"%s\" has been saved with %.1f sized cells. Duration %.2f ms", path.c_str(), cell_size, timer.GetElapsedTimeMS());
 
-		//   ̺Ʈ ߻
 		FIRE_EVENT(EventType::WorldSavedEnd);
 
-		return true;
+		return success;
 	}
 
+	void World::SaveSubtrees(FileStream* file, const vector<shared_ptr<Entity>>& roots)
+	{
+		const uint64_t base = file->GetPosition();
+		const uint32_t root_entity_count = static_cast<uint32_t>(roots.size());
+
+		file->Write(WORLD_FILE_MAGIC);
+		file->Write(WORLD_FILE_VERSION);
+		//  
+		file->Write(root_entity_count);
+
+		// Ʈ  ڸ Ƶΰ   ڿ ä.
+		// ҷ   Ʈ  ؼ  ְ ȴ.
+		const uint64_t table_position = file->GetPosition();
+		vector<uint64_t> table(root_entity_count * 2, 0);
+		file->Write(span<const uint64_t>(table));
+
+		for (uint32_t i = 0; i < root_entity_count; i++)
+		{
+			table[i * 2] = file->GetPosition() - base;
+			roots[i]->Serialize(file);
+			table[i * 2 + 1] = file->GetPosition() - base - table[i * 2];
+
+			ProgressTracker::Get().IncrementJobsDone(EProgressType::World);
+		}
+
+		file->WriteAt(table_position, table.data(), table.size() * sizeof(uint64_t));
+	}
+
+	// ҽ ε ⸦ ٸ  
+	struct World::sPendingLoad
+	{
+		MappedFile file;
+		uint32_t magic = 0;
+		//  ϰ   ҽ
+		vector<ResourceFuture<IResource>> resources;
+		// Ϲ   ٸ  ̸ ؼصд.
+		vector<vector<sEntityStaging>> subtrees;
+		bool decoded = false;
+		StopWatch timer;
+	};
+
 	bool World::LoadFromFile(const string& file_path)
+	{
+		ASSERT(this_thread::get_id() == m_MainThread);
+
+		if (!LoadFromFileAsync(file_path))
+			return false;
+
+		// ҽ  ö  ٷȴٰ ƼƼ .
+		while (true)
+		{
+			{
+				lock_guard<mutex> lock(m_Mutex_pending_load);
+
+				if (!m_PendingLoad)
+					return false;
+			}
+
+			bool success = false;
+			if (FinishLoad(&success))
+				return success;
+
+			this_thread::sleep_for(chrono::milliseconds(1));
+		}
+	}
+
+	bool World::LoadFromFileAsync(const string& file_path)
 	{
 		//    Ȯ
 		if (!FileSystem::Exists(file_path))
@@ -230,10 +411,16 @@ namespace PlayGround
 			return false;
 		}
 
-		//  
-		unique_ptr<FileStream> file = make_unique<FileStream>(file_path, FileStream_Read);
+		// 带  ƼƼ ҽ Ƿ  忡 Ѵ.
+		if (this_thread::get_id() != m_MainThread)
+		{
+			QueueMainThread([this, file_path] { LoadFromFileAsync(file_path); });
+			return true;
+		}
 
-		if (!file->IsOpen())
+		//  ü ؼ ޸ Ʈ д´.
+		unique_ptr<sPendingLoad> load = make_unique<sPendingLoad>();
+		if (!load->file.Open(file_path))
 		{
 			LOG_ERROR("Failed to open \"%s\"", file_path.c_str());
 			return false;
@@ -244,7 +431,6 @@ namespace PlayGround
 		progress_tracker.Reset(EProgressType::World);
 		progress_tracker.SetIsLoading(EProgressType::World, true);
 		progress_tracker.SetStatus(EProgressType::World, "Loading world...");
-		const StopWatch timer;
 
 		//  ѹ .
 		Clear();
@@ -255,33 +441,245 @@ namespace PlayGround
 		// ε ŸƮ ̺Ʈ
 		FIRE_EVENT(EventType::WorldLoadStart);
 
-		// Ʈ ƼƼ  ´.
-		const uint32_t root_entity_count = file->ReadAs<uint32_t>();
+		FileStream file(load->file.GetData(), load->file.GetSize());
+		load->magic = file.ReadAs<uint32_t>();
 
-		progress_tracker.SetJobCount(EProgressType::World, root_entity_count);
+		//    ҽ ۾ 忡 ҷ Ѵ.
+		load->resources = m_Context->GetSubModule<ResourceCache>()->LoadResourcesFromFiles();
 
-		// ŭ ݺϸ鼭 ̵ ´.
-		for (uint32_t i = 0; i < root_entity_count; i++)
+		// ҽ ٸ  Ʈ ķ ؼصд.
+		if (load->magic == WORLD_FILE_MAGIC)
 		{
-			shared_ptr<Entity> entity = EntityCreate();
-			entity->SetObjectID(file->ReadAs<uint64_t>());
+			const StopWatch decode_timer;
+			load->decoded = DecodeSubtrees(load->file.GetData(), load->file.GetSize(), m_Context->GetSubModule<Threading>(), &load->subtrees);
+			LOG_INFO("Decoded %d subtrees in %.2f ms", static_cast<int>(load->subtrees.size()), decode_timer.GetElapsedTimeMS());
+
+			//   ߴٸ   .
+			if (!load->decoded && load->subtrees.empty())
+			{
+				LOG_ERROR("\"%s\" is corrupted", file_path.c_str());
+				progress_tracker.SetIsLoading(EProgressType::World, false);
+				FIRE_EVENT(EventType::WorldLoadEnd);
+				return false;
+			}
 		}
 
-		// ƼƼ ε
-		for (uint32_t i = 0; i < root_entity_count; i++)
+		progress_tracker.SetStatus(EProgressType::World, "Loading resources...");
+		progress_tracker.SetJobCount(EProgressType::World, static_cast<int>(load->resources.size()));
+
+		// ƼƼ Ʈ ҽ ̸ ãǷ ҽ  ö ڿ .
+		lock_guard<mutex> lock(m_Mutex_pending_load);
+		m_PendingLoad = move(load);
+
+		return true;
+	}
+
+	bool World::FinishLoad(bool* success /*= nullptr*/)
+	{
+		unique_ptr<sPendingLoad> load;
+		{
+			lock_guard<mutex> lock(m_Mutex_pending_load);
+
+			if (!m_PendingLoad)
+				return false;
+
+			const vector<ResourceFuture<IResource>>& resources = m_PendingLoad->resources;
+			const int ready = static_cast<int>(count_if(resources.begin(), resources.end(), [](const ResourceFuture<IResource>& resource) { return resource.IsReady(); }));
+			ProgressTracker::Get().SetJobsDone(EProgressType::World, ready);
+
+			if (ready != static_cast<int>(resources.size()))
+				return false;
+
+			load = move(m_PendingLoad);
+		}
+
+		ProgressTracker& progress_tracker = ProgressTracker::Get();
+		progress_tracker.SetStatus(EProgressType::World, "Creating entities...");
+
+		bool loaded = true;
+
+		if (load->magic == WORLD_FILE_MAGIC)
 		{
-			m_vecEntities[i]->Deserialize(file.get(), nullptr);
-			progress_tracker.IncrementJobsDone(EProgressType::World);
+			CommitSubtrees(load->subtrees, nullptr);
+			loaded = load->decoded;
+		}
+		//   ׻ εǴ ƼƼ   Ʈ ƮѴ.
+		else if (WorldPartition::IsPartitionMagic(load->magic))
+		{
+			m_Partition = make_unique<WorldPartition>(m_Context, this);
+			loaded = m_Partition->Open(m_FilePath);
+
+			if (!loaded)
+				m_Partition.reset();
+		}
+		//   ù  Ʈ ƼƼ ̴.
+		else
+		{
+			FileStream file(load->file.GetData(), load->file.GetSize());
+			const uint32_t root_entity_count = file.ReadAs<uint32_t>();
+
+			progress_tracker.SetJobCount(EProgressType::World, root_entity_count);
+			progress_tracker.SetJobsDone(EProgressType::World, 0);
+
+			// ŭ ݺϸ鼭 ̵ ´.
+			for (uint32_t i = 0; i < root_entity_count; i++)
+			{
+				shared_ptr<Entity> entity = EntityCreate();
+				entity->SetObjectID(file.ReadAs<uint64_t>());
+			}
+
+			// ƼƼ ε
+			for (uint32_t i = 0; i < root_entity_count; i++)
+			{
+				m_vecEntities[i]->Deserialize(&file, nullptr);
+				progress_tracker.IncrementJobsDone(EProgressType::World);
+			}
 		}
 
 		progress_tracker.SetIsLoading(EProgressType::World, false);
-		LOG_INFO("World \"%s\" has been loaded. Duration %.2f ms", m_FilePath.c_str(), timer.GetElapsedTimeMS());
+
+		if (loaded)
+			LOG_INFO("World \"%s\" has been loaded. Duration %.2f ms", m_FilePath.c_str(), load->timer.GetElapsedTimeMS());
+		else
+			LOG_ERROR("\"%s\" is corrupted", m_FilePath.c_str());
 
 		FIRE_EVENT(EventType::WorldLoadEnd);
 
+		if (success)
+			*success = loaded;
+
 		return true;
 	}
 
+	bool World::DecodeSubtrees(const byte* data, uint64_t size, Threading* threading, vector<vector<sEntityStaging>>* subtrees)
+	{
+		FileStream file(data, size);
+
+		if (file.ReadAs<uint32_t>() != WORLD_FILE_MAGIC)
+			return false;
+
+		const uint32_t version = file.ReadAs<uint32_t>();
+		if (version != WORLD_FILE_VERSION)
+		{
+			LOG_ERROR("Unsupported world file version %d (expected %d)", version, WORLD_FILE_VERSION);
+			return false;
+		}
+
+		const uint32_t root_entity_count = file.ReadAs<uint32_t>();
+
+		// ջ  ū  Ҵ ʵ  ũ⸦ ȮѴ.
+		if (static_cast<uint64_t>(root_entity_count) * 2 * sizeof(uint64_t) > size)
+			return false;
+
+		vector<uint64_t> table(root_entity_count * 2, 0);
+		file.Read(span<uint64_t>(table));
+
+		if (file.IsEof())
+			return false;
+
+		for (uint32_t i = 0; i < root_entity_count; i++)
+		{
+			if (table[i * 2] > size || table[i * 2 + 1] > size - table[i * 2])
+				return false;
+		}
+
+		// Ʈ  ޸ Ʈ ؼѴ.
+		//  ǵ帮 ʰ ƼƼ  Ʈ  ġ .
+		subtrees->clear();
+		subtrees->resize(root_entity_count);
+		vector<uint8_t> decoded(root_entity_count, 0);
+
+		const auto decode = [&](uint32_t start, uint32_t end)
+		{
+			for (uint32_t i = start; i < end; i++)
+			{
+				FileStream stream(data + table[i * 2], table[i * 2 + 1]);
+				decoded[i] = Entity::DecodeSubtree(&stream, &(*subtrees)[i]) ? 1 : 0;
+			}
+		};
+
+		if (threading)
+			threading->ParallelFor(0, root_entity_count, 1, decode);
+		else
+			decode(0, root_entity_count);
+
+		bool success = true;
+
+		for (uint32_t i = 0; i < root_entity_count; i++)
+		{
+			if (!decoded[i])
+			{
+				(*subtrees)[i].clear();
+				success = false;
+			}
+		}
+
+		return success;
+	}
+
+	bool World::LoadSubtrees(const byte* data, uint64_t size, vector<EntityHandle>* roots)
+	{
+		// 1ܰ: Ʈ ķ ؼѴ.
+		vector<vector<sEntityStaging>> subtrees;
+		const bool success = DecodeSubtrees(data, size, m_Context->GetSubModule<Threading>(), &subtrees);
+
+		//   ߴٸ   .
+		if (!success && subtrees.empty())
+			return false;
+
+		// 2ܰ:  忡  ƼƼ Ʈ .
+		CommitSubtrees(subtrees, roots);
+
+		return success;
+	}
+
+	void World::CommitSubtrees(vector<vector<sEntityStaging>>& subtrees, vector<EntityHandle>* roots)
+	{
+		ProgressTracker::Get().SetJobCount(EProgressType::World, static_cast<uint32_t>(subtrees.size()));
+		ProgressTracker::Get().SetJobsDone(EProgressType::World, 0);
+
+		// Ʈ 迭 θ ׻ ڽĺ տ Ƿ ε ٷ θ Ѵ.
+		// Ʈ Deserialize д   Ʈ̰  Ʈ , ҽ ĳ, , ̺Ʈó
+		// 忡  ۾̶ ۾  ű ʴ´.   ܰ迡  ð  缭 .
+		vector<Entity*> created;
+		const StopWatch timer;
+		double deserialize_ms = 0.0;
+		uint32_t entity_count = 0;
+
+		for (vector<sEntityStaging>& subtree : subtrees)
+		{
+			created.resize(subtree.size());
+
+			for (size_t j = 0; j < subtree.size(); j++)
+			{
+				const sEntityStaging& staging = subtree[j];
+				Transform* parent = staging.parent != UINT32_MAX ? created[staging.parent]->GetTransform() : nullptr;
+
+				shared_ptr<Entity> entity = EntityCreate();
+
+				const StopWatch deserialize_timer;
+				entity->Deserialize(staging, parent);
+				deserialize_ms += deserialize_timer.GetElapsedTimeMS();
+
+				created[j] = entity.get();
+				entity_count++;
+
+				if (roots && !parent)
+					roots->emplace_back(entity->GetHandle());
+			}
+
+			//   Ʈ ؼ  ٷ .
+			vector<sEntityStaging>().swap(subtree);
+
+			ProgressTracker::Get().IncrementJobsDone(EProgressType::World);
+		}
+
+		if (entity_count != 0)
+			LOG_INFO("Created %d entities in %.2f ms (component deserialize %.2f ms)", entity_count, timer.GetElapsedTimeMS(), deserialize_ms);
+
+		FIRE_EVENT(EventType::WorldResolve);
+	}
+
 	bool World::IsLoading()
 	{
 		auto& progress_report = ProgressTracker::Get();
@@ -295,8 +693,10 @@ namespace PlayGround
 	shared_ptr<Entity> World::EntityCreate(bool is_active /*= true*/)
 	{
 		//  ƼƼ 
-		shared_ptr<Entity> entity = m_vecEntities.emplace_back(make_shared<Entity>(m_Context));
+		shared_ptr<Entity> entity = make_shared<Entity>(m_Context);
 		entity->SetActive(is_active);
+		EntityRegister(entity);
+
 		return entity;
 	}
 
@@ -331,36 +731,431 @@ namespace PlayGround
 
 	const shared_ptr<Entity>& World::EntityGetByName(const string& name)
 	{
-		for (const auto& entity : m_vecEntities)
+		// ̸ ε  ʴ´ٸ ȸϸ鼭 ã´.
+		if (!m_NameIndexEnabled)
 		{
-			if (entity->GetObjectName() == name)
-				return entity;
+			for (const auto& entity : m_vecEntities)
+			{
+				if (entity->GetObjectName() == name)
+					return entity;
+			}
+
+			static shared_ptr<Entity> empty;
+			return empty;
 		}
 
-		static shared_ptr<Entity> empty;
-		return empty;
+		const auto it = m_EntitiesByName.find(name);
+
+		if (it == m_EntitiesByName.end())
+		{
+			static shared_ptr<Entity> empty;
+			return empty;
+		}
+
+		return m_vecEntities[m_vecSlots[it->second].dense_index];
 	}
 
 	const std::shared_ptr<Entity>& World::EntityGetByID(const uint64_t id)
 	{
-		for (const auto& entity : m_vecEntities)
+		const auto it = m_EntitiesByID.find(id);
+
+		if (it == m_EntitiesByID.end())
+		{
+			static shared_ptr<Entity> empty;
+			return empty;
+		}
+
+		return m_vecEntities[m_vecSlots[it->second].dense_index];
+	}
+
+	const shared_ptr<Entity>& World::EntityGetByHandle(const EntityHandle& handle)
+	{
+		//  Ǿų ִٸ ̹  ƼƼ.
+		if (handle.index >= m_vecSlots.size() || m_vecSlots[handle.index].generation != handle.generation || m_vecSlots[handle.index].dense_index == UINT32_MAX)
+		{
+			static shared_ptr<Entity> empty;
+			return empty;
+		}
+
+		return m_vecEntities[m_vecSlots[handle.index].dense_index];
+	}
+
+	void World::SetNameIndexEnabled(bool enabled)
+	{
+		if (m_NameIndexEnabled == enabled)
+			return;
+
+		m_NameIndexEnabled = enabled;
+		m_EntitiesByName.clear();
+
+		// ٽ ٸ  ƼƼ ٽ .
+		if (m_NameIndexEnabled)
 		{
-			if (entity->GetObjectID() == id)
-				return entity;
+			for (const auto& entity : m_vecEntities)
+			{
+				m_EntitiesByName.emplace(entity->GetObjectName(), entity->GetHandle().index);
+			}
 		}
+	}
+
+	void World::OnEntityIDChanged(Entity* entity, uint64_t old_id)
+	{
+		const uint32_t slot = entity->GetHandle().index;
+
+		//  忡 ϵ  ƼƼ
+		if (slot >= m_vecSlots.size() || m_vecSlots[slot].generation != entity->GetHandle().generation)
+			return;
 
-		static shared_ptr<Entity> empty;
-		return empty;
+		// ٸ ƼƼ  ̵  ִٸ  ƼƼ ׸ ǵ帮 ʴ´.
+		const auto it = m_EntitiesByID.find(old_id);
+		if (it != m_EntitiesByID.end() && it->second == slot)
+			m_EntitiesByID.erase(it);
+
+		m_EntitiesByID.emplace(entity->GetObjectID(), slot);
+	}
+
+	void World::OnEntityNameChanged(Entity* entity, const string& old_name)
+	{
+		if (!m_NameIndexEnabled)
+			return;
+
+		const uint32_t slot = entity->GetHandle().index;
+
+		if (slot >= m_vecSlots.size() || m_vecSlots[slot].generation != entity->GetHandle().generation)
+			return;
+
+		NameIndexRemove(old_name, slot);
+		m_EntitiesByName.emplace(entity->GetObjectName(), slot);
+	}
+
+	void World::EntityRegister(const shared_ptr<Entity>& entity)
+	{
+		// ִ   Ѵ.
+		uint32_t slot = 0;
+		if (!m_vecFreeSlots.empty())
+		{
+			slot = m_vecFreeSlots.back();
+			m_vecFreeSlots.pop_back();
+		}
+		else
+		{
+			slot = static_cast<uint32_t>(m_vecSlots.size());
+			m_vecSlots.emplace_back();
+		}
+
+		m_vecSlots[slot].dense_index = static_cast<uint32_t>(m_vecEntities.size());
+		m_vecEntities.emplace_back(entity);
+
+		entity->m_Handle = EntityHandle(slot, m_vecSlots[slot].generation);
+		ArchetypeInsert(entity.get());
+		SceneProxySync(entity.get());
+
+		// ̵  ȿ ؾ Ѵ. ģٸ ã    ƼƼ  .
+		ASSERT(m_EntitiesByID.find(entity->GetObjectID()) == m_EntitiesByID.end());
+		m_EntitiesByID.insert_or_assign(entity->GetObjectID(), slot);
+
+		if (m_NameIndexEnabled)
+			m_EntitiesByName.emplace(entity->GetObjectName(), slot);
+
+		// ϱ   ˸ ʾǷ ⼭  Ͽ ֵ ˸.
+		FIRE_EVENT_DATA(EventType::EntityRenderStateChanged, entity.get());
+	}
+
+	void World::EntityUnregister(const shared_ptr<Entity>& entity)
+	{
+		// ڸ ٲٴ   ٲ ʵ صд.
+		const shared_ptr<Entity> removed = entity;
+		const EntityHandle handle = removed->GetHandle();
+
+		if (!EntityGetByHandle(handle))
+			return;
+
+		sEntitySlot& slot = m_vecSlots[handle.index];
+		const uint32_t dense_index = slot.dense_index;
+		const uint32_t last_index = static_cast<uint32_t>(m_vecEntities.size()) - 1;
+
+		// ε 
+		const auto it = m_EntitiesByID.find(removed->GetObjectID());
+		if (it != m_EntitiesByID.end() && it->second == handle.index)
+			m_EntitiesByID.erase(it);
+
+		if (m_NameIndexEnabled)
+			NameIndexRemove(removed->GetObjectName(), handle.index);
+
+		ArchetypeRemove(removed.get());
+		SceneProxyRemove(removed.get());
+
+		//  ƼƼ Ǵ ڸ ű.
+		if (dense_index != last_index)
+		{
+			m_vecEntities[dense_index] = move(m_vecEntities[last_index]);
+			m_vecSlots[m_vecEntities[dense_index]->GetHandle().index].dense_index = dense_index;
+		}
+
+		m_vecEntities.pop_back();
+
+		// 븦 ÷  ڵ ȿȭϰ  ȯѴ.
+		slot.dense_index = UINT32_MAX;
+		slot.generation++;
+		m_vecFreeSlots.emplace_back(handle.index);
+
+		removed->m_Handle = EntityHandle();
+	}
+
+	void World::OnEntityComponentsChanged(Entity* entity)
+	{
+		if (!EntityIsValid(entity->GetHandle()))
+			return;
+
+		// ο ũ ŰŸ ű.
+		ArchetypeRemove(entity);
+		ArchetypeInsert(entity);
+		SceneProxySync(entity);
+	}
+
+	void World::ArchetypeInsert(Entity* entity)
+	{
+		const uint32_t mask = entity->GetComponentMask();
+
+		// ó  ̶ ŰŸ  .
+		auto it = m_ArchetypeByMask.find(mask);
+		if (it == m_ArchetypeByMask.end())
+		{
+			it = m_ArchetypeByMask.emplace(mask, static_cast<uint32_t>(m_vecArchetypes.size())).first;
+			m_vecArchetypes.emplace_back().mask = mask;
+		}
+
+		sArchetype& archetype = m_vecArchetypes[it->second];
+
+		entity->m_ArchetypeIndex = it->second;
+		entity->m_ArchetypeRow = static_cast<uint32_t>(archetype.entities.size());
+		archetype.entities.emplace_back(entity);
+
+		for (uint32_t type = 0; type < COMPONENT_TYPE_COUNT; type++)
+		{
+			if (mask & (static_cast<uint32_t>(1) << type))
+				archetype.columns[type].emplace_back(entity->GetComponent(static_cast<EComponentType>(type)));
+		}
+	}
+
+	void World::ArchetypeRemove(Entity* entity)
+	{
+		if (entity->m_ArchetypeIndex >= m_vecArchetypes.size())
+			return;
+
+		sArchetype& archetype = m_vecArchetypes[entity->m_ArchetypeIndex];
+		const uint32_t row = entity->m_ArchetypeRow;
+		const uint32_t last_row = static_cast<uint32_t>(archetype.entities.size()) - 1;
+
+		//   Ǵ ڸ ű.
+		if (row != last_row)
+		{
+			archetype.entities[row] = archetype.entities[last_row];
+			archetype.entities[row]->m_ArchetypeRow = row;
+
+			for (uint32_t type = 0; type < COMPONENT_TYPE_COUNT; type++)
+			{
+				if (archetype.mask & (static_cast<uint32_t>(1) << type))
+					archetype.columns[type][row] = archetype.columns[type][last_row];
+			}
+		}
+
+		archetype.entities.pop_back();
+		for (uint32_t type = 0; type < COMPONENT_TYPE_COUNT; type++)
+		{
+			if (archetype.mask & (static_cast<uint32_t>(1) << type))
+				archetype.columns[type].pop_back();
+		}
+
+		entity->m_ArchetypeIndex = UINT32_MAX;
+		entity->m_ArchetypeRow = UINT32_MAX;
+	}
+
+	// ڽ   ʾҴٸ (Ʈ ٸ) ƼƼ ġ  Ѵ.
+	static BoundingBox GetSceneBounds(Renderable* renderable)
+	{
+		const BoundingBox& box = renderable->GetAabb();
+
+		if (!box.Defined() || !isfinite(box.GetMin().x) || !isfinite(box.GetMax().x))
+		{
+			const Vector3 position = renderable->GetTransform()->GetPosition();
+			return BoundingBox(position, position);
+		}
+
+		return box;
+	}
+
+	void World::SceneProxySync(Entity* entity)
+	{
+		Renderable* renderable = entity->GetComponent<Renderable>();
+
+		if (renderable && entity->m_SceneProxy == SceneBVH::INVALID_NODE)
+		{
+			entity->m_SceneProxy = m_SceneBVH->Insert(entity, GetSceneBounds(renderable));
+
+			// Ʈ Ʈ   ʾ  Ƿ  ſ ѹ  .
+			SceneProxyMarkDirty(entity);
+		}
+		else if (!renderable)
+		{
+			SceneProxyRemove(entity);
+		}
+	}
+
+	void World::SceneProxyRemove(Entity* entity)
+	{
+		if (entity->m_SceneProxy == SceneBVH::INVALID_NODE)
+			return;
+
+		m_SceneBVH->Remove(entity->m_SceneProxy);
+		entity->m_SceneProxy = SceneBVH::INVALID_NODE;
+
+		//  ƼƼ  Ͽ  ʴ´.
+		lock_guard<mutex> lock(m_Mutex_scene_proxy);
+		if (entity->m_SceneProxyDirty)
+		{
+			entity->m_SceneProxyDirty = false;
+			m_vecSceneProxyDirty.erase(find(m_vecSceneProxyDirty.begin(), m_vecSceneProxyDirty.end(), entity));
+		}
+	}
+
+	void World::SceneProxyMarkDirty(Entity* entity)
+	{
+		lock_guard<mutex> lock(m_Mutex_scene_proxy);
+
+		if (entity->m_SceneProxy == SceneBVH::INVALID_NODE || entity->m_SceneProxyDirty)
+			return;
+
+		entity->m_SceneProxyDirty = true;
+		m_vecSceneProxyDirty.emplace_back(entity);
+	}
+
+	void World::SceneProxyRefit()
+	{
+		// ̹ ӿ  Ʈ    ͸ Ƽ ǥѴ.
+		m_TransformStore->TakeMoved(&m_vecMovedTransforms);
+		for (Transform* transform : m_vecMovedTransforms)
+		{
+			SceneProxyMarkDirty(transform->GetEntity());
+		}
+
+		vector<Entity*> entities;
+		{
+			lock_guard<mutex> lock(m_Mutex_scene_proxy);
+			entities.swap(m_vecSceneProxyDirty);
+
+			for (Entity* entity : entities)
+			{
+				entity->m_SceneProxyDirty = false;
+			}
+		}
+
+		//  ڽ  ڽ   Ʈ ģ.
+		for (Entity* entity : entities)
+		{
+			Renderable* renderable = entity->GetComponent<Renderable>();
+
+			if (renderable && entity->m_SceneProxy != SceneBVH::INVALID_NODE)
+				m_SceneBVH->Move(entity->m_SceneProxy, GetSceneBounds(renderable));
+		}
+	}
+
+	void World::UpdateAnimators()
+	{
+		//  ã ۸   带 Ƿ  忡 Ѵ.
+		m_vecAnimators.clear();
+		Each<Animator>([this](Animator* animator)
+		{
+			if (animator->PrepareEvaluate())
+				m_vecAnimators.push_back(animator);
+		});
+
+		if (m_vecAnimators.empty())
+			return;
+
+		// ִϸͳ ϴ ° Ƿ ĳ  ش.
+		m_Context->GetSubModule<Threading>()->ParallelFor(0, static_cast<uint32_t>(m_vecAnimators.size()), 1, [this](uint32_t start, uint32_t end)
+		{
+			for (uint32_t i = start; i < end; i++)
+			{
+				m_vecAnimators[i]->Evaluate();
+			}
+		});
+
+		// ؽ ۴  忡 ø.
+		for (Animator* animator : m_vecAnimators)
+		{
+			animator->Upload();
+		}
+	}
+
+	void World::NameIndexRemove(const string& name, uint32_t slot)
+	{
+		const auto range = m_EntitiesByName.equal_range(name);
+
+		for (auto it = range.first; it != range.second; it++)
+		{
+			if (it->second == slot)
+			{
+				m_EntitiesByName.erase(it);
+				return;
+			}
+		}
 	}
 
 	void World::Clear()
 	{
 		FIRE_EVENT(EventType::WorldPreClear);
 
+		// ҽ ٸ  ε .
+		{
+			lock_guard<mutex> lock(m_Mutex_pending_load);
+			m_PendingLoad.reset();
+		}
+
+		// Ʈ ۾ ⸦ ٸ  ƼƼ .
+		if (m_Partition)
+		{
+			m_Partition->Close();
+			m_Partition.reset();
+		}
+
 		FIRE_EVENT(EventType::WorldClear);
 
+		// ƼƼ ٸ  Ƴ BVH Ű ʰ Ѵ.
+		for (const auto& entity : m_vecEntities)
+		{
+			entity->m_SceneProxy = SceneBVH::INVALID_NODE;
+			entity->m_SceneProxyDirty = false;
+		}
+		m_SceneBVH->Clear();
+		m_vecSceneProxyDirty.clear();
+
 		m_vecEntities.clear();
 
+		//   ȿȭѴ.
+		m_vecFreeSlots.clear();
+		for (uint32_t i = 0; i < static_cast<uint32_t>(m_vecSlots.size()); i++)
+		{
+			if (m_vecSlots[i].dense_index != UINT32_MAX)
+			{
+				m_vecSlots[i].dense_index = UINT32_MAX;
+				m_vecSlots[i].generation++;
+			}
+
+			m_vecFreeSlots.emplace_back(i);
+		}
+		m_EntitiesByID.clear();
+		m_EntitiesByName.clear();
+
+		// ŰŸ ܵΰ ⸸ Ѵ.
+		for (sArchetype& archetype : m_vecArchetypes)
+		{
+			archetype.entities.clear();
+			for (auto& column : archetype.columns)
+				column.clear();
+		}
+
 		m_Name.clear();
 
 		m_FilePath.clear();
@@ -370,30 +1165,32 @@ namespace PlayGround
 
 	void World::_EntityRemove(const std::shared_ptr<Entity>& entity)
 	{
+		// ڽ  Ǿٸ ǳʶڴ.
+		if (!EntityGetByHandle(entity->GetHandle()))
+			return;
+
 		//  ڽ ƼƼ ´.
+		// θ ִ  ڽ  ؾ ڽ  θ Ű ʴ´.
 		auto children = entity->GetTransform()->GetChildren();
 
 		// 
 		for (const auto& child : children)
 		{
-			EntityRemove(child->GetEntity()->GetSharedPtr());
+			const shared_ptr<Entity> child_entity = child->GetEntity()->GetSharedPtr();
+			child_entity->MarkForDestruction();
+			_EntityRemove(child_entity);
 		}
 
-		// ׸ θ Ѵ.
-		auto parent = entity->GetTransform()->GetParent();
-
-		for (auto it = m_vecEntities.begin(); it != m_vecEntities.end(); it++)
-		{
-			if ((*it)->GetObjectID() == entity->GetObjectID())
-			{
-				it = m_vecEntities.erase(it);
-				break;
-			}
-		}
+		// ׸ θ𿡰Լ .
+		//  ü ٽ ȸ ʵ θ ڽ Ͽ Ѵ.
+		if (Transform* parent = entity->GetTransform()->GetParent())
+			parent->RemoveChild(entity->GetTransform());
 
+		// ƼƼ ϰ ִ    ֵ ˸.
+		FIRE_EVENT_DATA(EventType::EntityRemoved, entity.get());
 
-		if (parent)
-			parent->AcquireChildren();
+		//  ƼƼ ڸ ٲ㼭 Ѵ.
+		EntityUnregister(entity);
 	}
 
 	void World::CreateDefaultWorldEntities()
@@ -3,8 +3,15 @@
 #include <vector>
 #include <memory>
 #include <string>
+#include <unordered_map>
+#include <array>
+#include <utility>
+#include <mutex>
+#include <functional>
+#include <thread>
 #include "../Core/SubModule.h"
 #include "../EngineDefinition.h"
+#include "Components/IComponent.h"
 
 
 namespace PlayGround
@@ -14,6 +21,41 @@ namespace PlayGround
 	class Input;
 	class Profiler;
 	class TransformHandle;
+	class Transform;
+	class TransformStore;
+	class SceneBVH;
+	class WorldPartition;
+	class Threading;
+	class Animator;
+	struct sEntityStaging;
+
+	//  ƼƼ  Ű ڵ
+	// ƼƼ Ǹ  밡 ö󰡹Ƿ ̹  ƼƼ Ű Ȯ  ִ.
+	struct EntityHandle
+	{
+		EntityHandle() = default;
+		EntityHandle(uint32_t index, uint32_t generation) : index(index), generation(generation) {}
+
+		inline bool IsValid() const { return index != UINT32_MAX; }
+
+		inline bool operator==(const EntityHandle& rhs) const { return index == rhs.index && generation == rhs.generation; }
+		inline bool operator!=(const EntityHandle& rhs) const { return !(*this == rhs); }
+
+		uint32_t index = UINT32_MAX;
+		uint32_t generation = 0;
+	};
+
+	//  Ʈ (ũ)  ƼƼ 
+	// ŸԺ Ʈ ͸ ƴ 迭 ƵιǷ  ƼƼ ġ ʰ  ȴ´.
+	// Ʈ ü ƼƼ shared_ptr ϹǷ ึ ͸ ѹ 󰣴.
+	// (ComponentAllocator п  Ÿ Ʈ  ûũ鿡  ִ.)
+	struct sArchetype
+	{
+		uint32_t mask = 0;
+		std::vector<Entity*> entities;
+		// ũ Ե Ÿ 迭 Ѵ. (Ʈ  ƴ )
+		std::array<std::vector<IComponent*>, COMPONENT_TYPE_COUNT> columns;
+	};
 
 	//  Ŭ   Ŭ ӹ޴´.
 	class World : public SubModule
@@ -26,13 +68,22 @@ namespace PlayGround
 		void OnInit() override;
 		void PrevUpdate() override;
 		void Update(double delta_time) override;
+		bool RegisterFrameStages(FrameGraph& graph, ETickType tick_group) override;
 
 		//  
 		void New();
 		//  
 		bool SaveToFile(const std::string& file_path);
-		//  ε
+		// 带 cell_size ũ   Ѵ. ҷ ī޶ ֺ  Ʈֵȴ.
+		bool SaveToFilePartitioned(const std::string& file_path, float cell_size);
+		//  ε ( )
+		// ҽ  ö ƼƼ   ٸ  ȯѴ.
 		bool LoadFromFile(const std::string& file_path);
+		//  ε ۸ Ѵ.
+		// 带  ҽ ε û  Ʈ ؼصΰ ٷ ȯѴ.
+		// ƼƼ ҽ  ö    Update Ƿ  Ȳ IsLoading ProgressTracker ȮѴ.
+		// 带    忡   Ƿ ۾ 忡 ȣϸ  Ʈ ̷.
+		bool LoadFromFileAsync(const std::string& file_path);
 		inline void Resolve() { m_Resolve = true; }
 		// Ͻ  Ӹ Ʈ ų 
 		inline void SetUpdateOnce() { m_UpdateOnce = true; }
@@ -41,21 +92,109 @@ namespace PlayGround
 		inline const std::string& GetFilePath() const{ return m_FilePath; }
 		inline bool GetUpdateOnce() const { return m_UpdateOnce; }
 
+		// ۾ 忡 ƼƼ Ʈ ٲ   Ѵ.
+		//    Update ۿ  忡 ȣȴ.
+		void QueueMainThread(std::function<void()>&& task);
+
 		std::shared_ptr<Entity> EntityCreate(bool is_active = true);
 		bool EntityExists(const std::shared_ptr<Entity>& entity);
 		void EntityRemove(const std::shared_ptr<Entity>& entity);
 		std::vector<std::shared_ptr<Entity>> EntityGetRoots();
 		const std::shared_ptr<Entity>& EntityGetByName(const std::string& name);
 		const std::shared_ptr<Entity>& EntityGetByID(const uint64_t id);
+		// ڵ Ű ƼƼ Ǿٸ  ͸ ȯѴ.
+		const std::shared_ptr<Entity>& EntityGetByHandle(const EntityHandle& handle);
+		inline bool EntityIsValid(const EntityHandle& handle) { return EntityGetByHandle(handle) != nullptr; }
+
+		// Ts Ʈ   ƼƼ function(Ts*...) ȣѴ.
+		// ȣ ߿ Ʈ ߰ϰų ؼ ȵȴ.
+		template <typename... Ts, typename Function>
+		void Each(Function&& function)
+		{
+			uint32_t required = 0;
+			((required |= static_cast<uint32_t>(1) << static_cast<uint32_t>(IComponent::TypeToEnum<Ts>())), ...);
+
+			for (sArchetype& archetype : m_vecArchetypes)
+			{
+				if ((archetype.mask & required) != required || archetype.entities.empty())
+					continue;
+
+				EachRow<Ts...>(archetype, function, std::index_sequence_for<Ts...>());
+			}
+		}
+
+		inline const std::vector<sArchetype>& GetArchetypes() const { return m_vecArchetypes; }
 		inline const auto& EntityGetAll() const { return m_vecEntities; }
 
 
 		std::shared_ptr<TransformHandle> GetTransformHandle() { return m_TransformHandle; }
+		inline TransformStore* GetTransformStore() const { return m_TransformStore.get(); }
+		//    AABB  BVH (ŷ, ø    Ѵ.)
+		inline SceneBVH* GetSceneBVH() const { return m_SceneBVH.get(); }
+		//  ڽ ٲ  ȣؼ  ſ BVH ݿϰ Ѵ.
+		void SceneProxyMarkDirty(Entity* entity);
+		//  带 ҷ  Ѵ.
+		inline WorldPartition* GetPartition() const { return m_Partition.get(); }
+
+		// ̸ ã  ٸ  ̸      ִ.
+		void SetNameIndexEnabled(bool enabled);
+
+		// ƼƼ ̵ ̸ ٲ  ƼƼ ȣѴ.
+		void OnEntityIDChanged(Entity* entity, uint64_t old_id);
+		void OnEntityNameChanged(Entity* entity, const std::string& old_name);
+		void OnEntityComponentsChanged(Entity* entity);
 		float m_gizmo_transform_size = 0.015f;
 	private:
+		friend class WorldPartition;
+
 		void Clear();
 		void _EntityRemove(const std::shared_ptr<Entity>& entity);
 		void CreateDefaultWorldEntities();
+		// Ʈ [][][Ʈ ][(, ũ)...][Ʈ...]  . (   )
+		static void SaveSubtrees(FileStream* file, const std::vector<std::shared_ptr<Entity>>& roots);
+		//  Ʈ ؼѴ. threading ִٸ ķ ؼѴ.
+		// Ϻ Ʈ ջǾٸ  Ʈ ΰ false ȯѴ.
+		static bool DecodeSubtrees(const std::byte* data, uint64_t size, Threading* threading, std::vector<std::vector<sEntityStaging>>* subtrees);
+		//  ķ ؼ  ѹ ƼƼ . roots ִٸ  Ʈ ƼƼ ´.
+		bool LoadSubtrees(const std::byte* data, uint64_t size, std::vector<EntityHandle>* roots = nullptr);
+		// ؼ Ʈ  ƼƼ .
+		void CommitSubtrees(std::vector<std::vector<sEntityStaging>>& subtrees, std::vector<EntityHandle>* roots);
+		// ٸ ҽ  öԴٸ  ε Ѵ. ( )
+		// ߴٸ true ȯϰ success  θ ´.
+		bool FinishLoad(bool* success = nullptr);
+		// ε,   ۾,  Ʈ, Ʈ Ʈ, ƼƼ 
+		void UpdateEntities(double delta_time);
+		// Ƽ Ʈ , Ű, BVH 
+		void UpdateTransforms();
+		//  Ҵؼ ε Ѵ.
+		void EntityRegister(const std::shared_ptr<Entity>& entity);
+		//  ƼƼ ڸ ٲ㼭 ϰ  ȯѴ.
+		void EntityUnregister(const std::shared_ptr<Entity>& entity);
+		void NameIndexRemove(const std::string& name, uint32_t slot);
+		//  ũ ´ ŰŸ  ߰Ѵ.
+		void ArchetypeInsert(Entity* entity);
+		// ŰŸ   ڸ ٲ㼭 Ѵ.
+		void ArchetypeRemove(Entity* entity);
+		//   缭 BVH ְų .
+		void SceneProxySync(Entity* entity);
+		void SceneProxyRemove(Entity* entity);
+		// Ʈ̳ ڽ ٲ  BVH ݿѴ.
+		void SceneProxyRefit();
+		// ִϸ  ø Ű ۾ 忡 ѹ óѴ.
+		void UpdateAnimators();
+
+		template <typename... Ts, typename Function, size_t... I>
+		static void EachRow(sArchetype& archetype, Function& function, std::index_sequence<I...>)
+		{
+			// ʿ   ּҸ ̸ ´.
+			IComponent** columns[] = { archetype.columns[static_cast<uint32_t>(IComponent::TypeToEnum<Ts>())].data()... };
+			const size_t count = archetype.entities.size();
+
+			for (size_t row = 0; row < count; row++)
+			{
+				function(static_cast<Ts*>(columns[I][row])...);
+			}
+		}
 
 		//  ⺻ ġǴ ƼƼ
 		std::shared_ptr<Entity> CreateEnvironment();
@@ -77,9 +216,53 @@ namespace PlayGround
 		Input* m_Input;
 		Profiler* m_Profiler = nullptr;
 
+		//  Ʈ  (ƼƼ麸 ߿ Ǿ Ѵ.)
+		std::unique_ptr<TransformStore> m_TransformStore;
+		//  BVH
+		std::unique_ptr<SceneBVH> m_SceneBVH;
+		//  Ʈ (  )
+		std::unique_ptr<WorldPartition> m_Partition;
 		// Ʈ ڵ
 		std::shared_ptr<TransformHandle> m_TransformHandle;
 		//  ġǴ  ƼƼ
 		std::vector<std::shared_ptr<Entity>> m_vecEntities;
+
+		// ڵ ε Ű 
+		struct sEntitySlot
+		{
+			// m_vecEntities ġ
+			uint32_t dense_index = UINT32_MAX;
+			uint32_t generation = 0;
+		};
+		std::vector<sEntitySlot> m_vecSlots;
+		std::vector<uint32_t> m_vecFreeSlots;
+		// ̵ -> 
+		std::unordered_map<uint64_t, uint32_t> m_EntitiesByID;
+		// ̸ ->  (̸ ߺ  ִ.)
+		std::unordered_multimap<std::string, uint32_t> m_EntitiesByName;
+		bool m_NameIndexEnabled = true;
+
+		// Ʈ ũ ŰŸ
+		std::vector<sArchetype> m_vecArchetypes;
+		std::unordered_map<uint32_t, uint32_t> m_ArchetypeByMask;
+
+		// ڽ ٽ   ƼƼ
+		std::vector<Entity*> m_vecSceneProxyDirty;
+		std::vector<Transform*> m_vecMovedTransforms;
+		std::mutex m_Mutex_scene_proxy;
+
+		// ̹ ӿ  ִϸ (  ٽ ä.)
+		std::vector<Animator*> m_vecAnimators;
+
+		// ۾ 尡    ۾
+		std::vector<std::function<void()>> m_vecMainThreadTasks;
+		std::mutex m_Mutex_main_thread;
+
+		// ҽ ٸ ִ  ε (LoadFromFile ְ Update Ѵ.)
+		struct sPendingLoad;
+		std::unique_ptr<sPendingLoad> m_PendingLoad;
+		std::mutex m_Mutex_pending_load;
+		// 带   (带  ƼƼ  )
+		std::thread::id m_MainThread;
 	};
 }
\ No newline at end of file
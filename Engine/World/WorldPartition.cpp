@@ -0,0 +1,706 @@
+#include "Common.h"
+#include "WorldPartition.h"
+#include "World.h"
+#include "Entity.h"
+#include "Components/Transform.h"
+#include "Components/Renderable.h"
+#include "../Resource/ResourceCache.h"
+#include "../Resource/ProgressTracker.h"
+#include "../Rendering/Material.h"
+#include "../IO/FileStream.h"
+#include "../IO/AssetContainer.h"
+#include "../Threading/Threading.h"
+#include "../Core/Context.h"
+#include "../Core/Engine.h"
+#include <cmath>
+#include <unordered_set>
+
+using namespace std;
+using namespace PlayGround::Math;
+
+namespace PlayGround
+{
+	//    
+	// [][][ ũ][׻ εǴ  (, ũ)][ ]
+	// [ (x, z, , ũ, ҽ , (Ÿ, )...)][...]
+	//  Ϲ  ϰ  ̴. (World::SaveSubtrees)
+	static constexpr uint32_t WORLD_PARTITION_MAGIC = AssetChunkId('P', 'G', 'W', 'P');
+	static constexpr uint32_t WORLD_PARTITION_VERSION = 1;
+	// 迡   ö󰬴  ʵ   ݰ  а ´.
+	static constexpr float UNLOAD_RADIUS_SCALE = 1.25f;
+	// ƼƼ   ֺ꿡 ݿǹǷ  ڿ ҽ Ѵ.
+	static constexpr uint32_t RELEASE_DELAY_FRAMES = 2;
+
+	enum class ECellState : uint8_t
+	{
+		Unloaded,
+		// ۾ 忡  ؼϴ 
+		Loading,
+		// ؼ  ҽ ε ٸų  忡 ƼƼ  
+		Decoded,
+		Loaded
+	};
+
+	struct sWorldCell
+	{
+		int32_t x = 0;
+		int32_t z = 0;
+		uint64_t offset = 0;
+		uint64_t size = 0;
+		//   ϴ 𵨰 
+		vector<pair<EResourceType, string>> resources;
+
+		atomic<ECellState> state = ECellState::Unloaded;
+		JobHandle task;
+		bool corrupted = false;
+		// ĳÿ  û ҽ
+		vector<ResourceFuture<IResource>> loads;
+
+		// ۾  ؼ 
+		vector<vector<sEntityStaging>> subtrees;
+		//  Ѿ ̾   ġ
+		uint32_t commit_subtree = 0;
+		uint32_t commit_entity = 0;
+		vector<EntityHandle> created;
+
+		//   Ʈ ƼƼ
+		vector<EntityHandle> roots;
+		// ϴ ޸ ġ (ѹ εǱ   ũ)
+		uint64_t memory = 0;
+	};
+
+	// Ʈ  ִٸ ϴ ҽ .
+	static bool CollectRenderables(Entity* root, vector<pair<EResourceType, string>>* resources)
+	{
+		bool has_renderable = false;
+		vector<Transform*> stack = { root->GetTransform() };
+
+		while (!stack.empty())
+		{
+			Transform* transform = stack.back();
+			stack.pop_back();
+
+			if (Renderable* renderable = transform->GetEntity()->GetComponent<Renderable>())
+			{
+				has_renderable = true;
+
+				// ⺻  ⺻    Ƿ Ѵ.
+				if (renderable->GeometryType() == Geometry_Custom && renderable->GeometryModel())
+					resources->emplace_back(EResourceType::Model, renderable->GeometryModel()->GetResourceFilePathNative());
+
+				Material* material = renderable->GetMaterial();
+				if (material && material->HasFilePathNative())
+					resources->emplace_back(EResourceType::Material, material->GetResourceFilePathNative());
+			}
+
+			for (Transform* child : transform->GetChildren())
+			{
+				stack.emplace_back(child);
+			}
+		}
+
+		return has_renderable;
+	}
+
+	WorldPartition::WorldPartition(Context* context, World* world)
+	{
+		m_Context = context;
+		m_World = world;
+		m_Threading = context->GetSubModule<Threading>();
+		m_ResourceCache = context->GetSubModule<ResourceCache>();
+	}
+
+	WorldPartition::~WorldPartition()
+	{
+		Close();
+	}
+
+	bool WorldPartition::IsPartitionMagic(uint32_t magic)
+	{
+		return magic == WORLD_PARTITION_MAGIC;
+	}
+
+	bool WorldPartition::Save(World* world, const string& file_path, float cell_size)
+	{
+		auto file = make_unique<FileStream>(file_path, FileStream_Write);
+
+		if (!file->IsOpen())
+		{
+			LOG_ERROR("Failed to open \"%s\" for writing", file_path.c_str());
+			return false;
+		}
+
+		// Ʈ  .
+		//  ׻  ĵ  Ѵ.
+		struct sCellBuild
+		{
+			vector<shared_ptr<Entity>> roots;
+			vector<pair<EResourceType, string>> resources;
+		};
+
+		vector<shared_ptr<Entity>> root_actors = world->EntityGetRoots();
+		vector<shared_ptr<Entity>> persistent;
+		map<pair<int32_t, int32_t>, sCellBuild> cells;
+
+		for (const shared_ptr<Entity>& root : root_actors)
+		{
+			vector<pair<EResourceType, string>> resources;
+
+			if (!CollectRenderables(root.get(), &resources))
+			{
+				persistent.emplace_back(root);
+				continue;
+			}
+
+			const Vector3 position = root->GetTransform()->GetPosition();
+			const int32_t x = static_cast<int32_t>(floor(position.x / cell_size));
+			const int32_t z = static_cast<int32_t>(floor(position.z / cell_size));
+
+			sCellBuild& cell = cells[make_pair(x, z)];
+			cell.roots.emplace_back(root);
+
+			for (auto& resource : resources)
+			{
+				if (find(cell.resources.begin(), cell.resources.end(), resource) == cell.resources.end())
+					cell.resources.emplace_back(move(resource));
+			}
+		}
+
+		ProgressTracker& progress_tracker = ProgressTracker::Get();
+		progress_tracker.Reset(EProgressType::World);
+		progress_tracker.SetIsLoading(EProgressType::World, true);
+		progress_tracker.SetStatus(EProgressType::World, "Saving world...");
+		progress_tracker.SetJobCount(EProgressType::World, static_cast<uint32_t>(root_actors.size()));
+
+		file->Write(WORLD_PARTITION_MAGIC);
+		file->Write(WORLD_PARTITION_VERSION);
+		file->Write(cell_size);
+
+		//  ġ ڸ Ƶΰ   ڿ ä.
+		const uint64_t persistent_position = file->GetPosition();
+		file->Write(static_cast<uint64_t>(0));
+		file->Write(static_cast<uint64_t>(0));
+
+		file->Write(static_cast<uint32_t>(cells.size()));
+
+		vector<uint64_t> cell_positions;
+		cell_positions.reserve(cells.size());
+
+		for (const auto& [coordinate, cell] : cells)
+		{
+			file->Write(coordinate.first);
+			file->Write(coordinate.second);
+
+			cell_positions.emplace_back(file->GetPosition());
+			file->Write(static_cast<uint64_t>(0));
+			file->Write(static_cast<uint64_t>(0));
+
+			file->Write(static_cast<uint32_t>(cell.resources.size()));
+			for (const auto& [type, path] : cell.resources)
+			{
+				file->Write(static_cast<uint32_t>(type));
+				file->Write(path);
+			}
+		}
+
+		//    ä.
+		const auto write_block = [&file](uint64_t position, const vector<shared_ptr<Entity>>& roots)
+		{
+			uint64_t block[2];
+			block[0] = file->GetPosition();
+			World::SaveSubtrees(file.get(), roots);
+			block[1] = file->GetPosition() - block[0];
+
+			file->WriteAt(position, block, sizeof(block));
+		};
+
+		write_block(persistent_position, persistent);
+
+		uint32_t index = 0;
+		for (const auto& [coordinate, cell] : cells)
+		{
+			write_block(cell_positions[index++], cell.roots);
+		}
+
+		file->Close();
+
+		progress_tracker.SetIsLoading(EProgressType::World, false);
+
+		return true;
+	}
+
+	bool WorldPartition::Open(const string& file_path)
+	{
+		Close();
+
+		m_File = make_shared<MappedFile>();
+		if (!m_File->Open(file_path))
+		{
+			m_File.reset();
+			return false;
+		}
+
+		const byte* data = m_File->GetData();
+		const uint64_t size = m_File->GetSize();
+
+		FileStream file(data, size);
+
+		if (file.ReadAs<uint32_t>() != WORLD_PARTITION_MAGIC)
+		{
+			Close();
+			return false;
+		}
+
+		const uint32_t version = file.ReadAs<uint32_t>();
+		if (version != WORLD_PARTITION_VERSION)
+		{
+			LOG_ERROR("Unsupported world partition version %d (expected %d)", version, WORLD_PARTITION_VERSION);
+			Close();
+			return false;
+		}
+
+		m_CellSize = file.ReadAs<float>();
+		const uint64_t persistent_offset = file.ReadAs<uint64_t>();
+		const uint64_t persistent_size = file.ReadAs<uint64_t>();
+		const uint32_t cell_count = file.ReadAs<uint32_t>();
+
+		const auto in_bounds = [size](uint64_t offset, uint64_t length)
+		{
+			return offset <= size && length <= size - offset;
+		};
+
+		// ջ  ū 迭 Ҵ ʵ  ׸ ּ ũ  ȮѴ.
+		static constexpr uint64_t MIN_CELL_ENTRY_SIZE = sizeof(int32_t) * 2 + sizeof(uint64_t) * 2 + sizeof(uint32_t);
+		if (!(m_CellSize > 0.0f) || !in_bounds(persistent_offset, persistent_size) || static_cast<uint64_t>(cell_count) * MIN_CELL_ENTRY_SIZE > size)
+		{
+			Close();
+			return false;
+		}
+
+		m_vecCells.reserve(cell_count);
+
+		for (uint32_t i = 0; i < cell_count; i++)
+		{
+			shared_ptr<sWorldCell> cell = make_shared<sWorldCell>();
+			cell->x = file.ReadAs<int32_t>();
+			cell->z = file.ReadAs<int32_t>();
+			cell->offset = file.ReadAs<uint64_t>();
+			cell->size = file.ReadAs<uint64_t>();
+
+			const uint32_t resource_count = file.ReadAs<uint32_t>();
+			if (file.IsEof() || resource_count > size || !in_bounds(cell->offset, cell->size))
+			{
+				Close();
+				return false;
+			}
+
+			cell->resources.reserve(resource_count);
+			for (uint32_t j = 0; j < resource_count; j++)
+			{
+				const EResourceType type = static_cast<EResourceType>(file.ReadAs<uint32_t>());
+				cell->resources.emplace_back(type, file.ReadAs<string>());
+			}
+
+			cell->memory = cell->size;
+			m_vecCells.emplace_back(move(cell));
+		}
+
+		if (file.IsEof())
+		{
+			Close();
+			return false;
+		}
+
+		// ׻ εǴ ƼƼ (ī޶, , ȯ )
+		// Ϻθ ջǾ  Ƿ ϸ  ƼƼ .
+		vector<EntityHandle> persistent_roots;
+		if (!m_World->LoadSubtrees(data + persistent_offset, persistent_size, &persistent_roots))
+		{
+			for (const EntityHandle& handle : persistent_roots)
+			{
+				if (const shared_ptr<Entity>& entity = m_World->EntityGetByHandle(handle))
+					m_World->EntityRemove(entity);
+			}
+
+			m_World->Resolve();
+			Close();
+			return false;
+		}
+
+		// 带 ҷ   ҽ öǷ   ҽ ó ѹ Ѵ.
+		m_ReleaseDelay = RELEASE_DELAY_FRAMES;
+
+		LOG_INFO("World partition has %d cells of size %.1f", cell_count, m_CellSize);
+
+		return true;
+	}
+
+	void WorldPartition::Close()
+	{
+		// ۾ 尡      Ƿ ⸦ ٸ.
+		for (const shared_ptr<sWorldCell>& cell : m_vecCells)
+		{
+			if (cell->state.load(memory_order_acquire) == ECellState::Loading && m_Threading)
+				m_Threading->Wait(cell->task);
+		}
+
+		m_vecCells.clear();
+		m_File.reset();
+		m_ResidentMemory = 0;
+		m_ReleaseDelay = 0;
+	}
+
+	uint32_t WorldPartition::GetLoadedCellCount() const
+	{
+		uint32_t count = 0;
+
+		for (const shared_ptr<sWorldCell>& cell : m_vecCells)
+		{
+			if (cell->state.load(memory_order_relaxed) == ECellState::Loaded)
+				count++;
+		}
+
+		return count;
+	}
+
+	float WorldPartition::GetCellDistance(const sWorldCell& cell, const Vector3& position) const
+	{
+		//  簢    Ÿ
+		const float min_x = cell.x * m_CellSize;
+		const float min_z = cell.z * m_CellSize;
+
+		const float dx = max(max(min_x - position.x, 0.0f), position.x - (min_x + m_CellSize));
+		const float dz = max(max(min_z - position.z, 0.0f), position.z - (min_z + m_CellSize));
+
+		return sqrt(dx * dx + dz * dz);
+	}
+
+	void WorldPartition::Update(const Vector3& camera_position)
+	{
+		if (!m_File)
+			return;
+
+		//   (ѹ ϳ ҷ´.)
+		sWorldCell* pending = nullptr;
+
+		for (const shared_ptr<sWorldCell>& cell : m_vecCells)
+		{
+			const ECellState state = cell->state.load(memory_order_acquire);
+
+			if (state == ECellState::Loading || state == ECellState::Decoded)
+			{
+				pending = cell.get();
+				break;
+			}
+		}
+
+		// ־  .
+		const float unload_radius = m_StreamingRadius * UNLOAD_RADIUS_SCALE;
+
+		for (const shared_ptr<sWorldCell>& cell : m_vecCells)
+		{
+			const ECellState state = cell->state.load(memory_order_acquire);
+
+			if (state == ECellState::Unloaded || state == ECellState::Loading)
+				continue;
+
+			if (GetCellDistance(*cell, camera_position) > unload_radius)
+			{
+				if (cell.get() == pending)
+					pending = nullptr;
+
+				Unload(*cell);
+			}
+		}
+
+		//  Ѿٸ   .
+		while (m_ResidentMemory > m_MemoryBudget)
+		{
+			sWorldCell* farthest = nullptr;
+			float farthest_distance = -1.0f;
+
+			for (const shared_ptr<sWorldCell>& cell : m_vecCells)
+			{
+				if (cell->state.load(memory_order_relaxed) != ECellState::Loaded)
+					continue;
+
+				const float distance = GetCellDistance(*cell, camera_position);
+				if (distance > farthest_distance)
+				{
+					farthest = cell.get();
+					farthest_distance = distance;
+				}
+			}
+
+			if (!farthest)
+				break;
+
+			Unload(*farthest);
+		}
+
+		//    ҽ Ѵ.
+		if (m_ReleaseDelay > 0 && --m_ReleaseDelay == 0)
+			ReleaseUnusedResources();
+
+		// ؼ ҽ ε    ƼƼ .
+		if (pending)
+		{
+			if (pending->state.load(memory_order_acquire) == ECellState::Loading)
+				return;
+
+			for (const ResourceFuture<IResource>& load : pending->loads)
+			{
+				if (!load.IsReady())
+					return;
+			}
+
+			pending->loads.clear();
+
+			if (pending->corrupted)
+			{
+				LOG_ERROR("World cell (%d, %d) is corrupted", pending->x, pending->z);
+				pending->subtrees.clear();
+				pending->state.store(ECellState::Unloaded, memory_order_release);
+			}
+			else if (Commit(*pending, m_CommitBudgetMS))
+			{
+				// ε ҽ ũ ġ Ѵ.
+				uint64_t memory = pending->size;
+				for (const auto& [type, path] : pending->resources)
+				{
+					if (shared_ptr<IResource> resource = m_ResourceCache->GetByPath<IResource>(path))
+						memory += resource->GetObjectSizeCPU() + resource->GetObjectSizeGPU();
+				}
+
+				pending->memory = memory;
+				m_ResidentMemory += memory;
+				pending->state.store(ECellState::Loaded, memory_order_release);
+			}
+
+			return;
+		}
+
+		// ݰ ȿ     ȿ ҷ´.
+		shared_ptr<sWorldCell> nearest;
+		float nearest_distance = m_StreamingRadius;
+
+		for (const shared_ptr<sWorldCell>& cell : m_vecCells)
+		{
+			if (cell->corrupted || cell->state.load(memory_order_relaxed) != ECellState::Unloaded)
+				continue;
+
+			if (m_ResidentMemory + cell->memory > m_MemoryBudget)
+				continue;
+
+			const float distance = GetCellDistance(*cell, camera_position);
+			if (distance <= nearest_distance)
+			{
+				nearest = cell;
+				nearest_distance = distance;
+			}
+		}
+
+		if (nearest)
+			RequestLoad(nearest);
+	}
+
+	void WorldPartition::RequestLoad(const shared_ptr<sWorldCell>& cell)
+	{
+		cell->state.store(ECellState::Loading, memory_order_release);
+
+		//  鼭 ĳÿ  ҽ ٽ ûѴ. ƼƼ ε    忡 .
+		cell->loads.clear();
+		for (const auto& [type, path] : cell->resources)
+		{
+			if (m_ResourceCache->GetByPath<IResource>(path))
+				continue;
+
+			if (type == EResourceType::Model)
+				cell->loads.emplace_back(m_ResourceCache->LoadAsync<Model>(path));
+			else if (type == EResourceType::Material)
+				cell->loads.emplace_back(m_ResourceCache->LoadAsync<Material>(path));
+		}
+
+		// ۾   Ƽ    ֵ ؼ ѱ.
+		const auto load = [cell, file = m_File]()
+		{
+			// ̹ ۾ ̹Ƿ   Ʈ  ؼѴ.
+			cell->corrupted = !World::DecodeSubtrees(file->GetData() + cell->offset, cell->size, nullptr, &cell->subtrees);
+			cell->commit_subtree = 0;
+			cell->commit_entity = 0;
+
+			cell->state.store(ECellState::Decoded, memory_order_release);
+		};
+
+		if (m_Threading)
+			cell->task = m_Threading->AddTask(load);
+		else
+			load();
+	}
+
+	bool WorldPartition::Commit(sWorldCell& cell, float budget_ms)
+	{
+		const StopWatch timer;
+		const bool game_mode = m_Context->m_Engine->IsEngineModeSet(GameMode);
+
+		while (cell.commit_subtree < cell.subtrees.size())
+		{
+			vector<sEntityStaging>& subtree = cell.subtrees[cell.commit_subtree];
+			cell.created.resize(subtree.size());
+
+			while (cell.commit_entity < subtree.size())
+			{
+				const sEntityStaging& staging = subtree[cell.commit_entity];
+
+				//  ӿ  θ  ̿ Ǿ  ִ.
+				Transform* parent = nullptr;
+				if (staging.parent != UINT32_MAX)
+				{
+					if (const shared_ptr<Entity>& parent_entity = m_World->EntityGetByHandle(cell.created[staging.parent]))
+						parent = parent_entity->GetTransform();
+				}
+
+				shared_ptr<Entity> entity = m_World->EntityCreate();
+				entity->Deserialize(staging, parent);
+
+				//  ߿ ö ƼƼ ۽ش.
+				if (game_mode)
+					entity->OnStart();
+
+				cell.created[cell.commit_entity] = entity->GetHandle();
+				if (staging.parent == UINT32_MAX)
+					cell.roots.emplace_back(entity->GetHandle());
+
+				cell.commit_entity++;
+
+				//    ϳ     ӿ ̾ .
+				if (timer.GetElapsedTimeMS() > budget_ms)
+				{
+					m_World->Resolve();
+					return false;
+				}
+			}
+
+			vector<sEntityStaging>().swap(subtree);
+			cell.commit_subtree++;
+			cell.commit_entity = 0;
+		}
+
+		cell.subtrees.clear();
+		cell.created.clear();
+		m_World->Resolve();
+
+		return true;
+	}
+
+	void WorldPartition::Unload(sWorldCell& cell)
+	{
+		const ECellState state = cell.state.load(memory_order_acquire);
+
+		if (state == ECellState::Loaded)
+			m_ResidentMemory -= min(m_ResidentMemory, cell.memory);
+
+		// ڽ 尡  .
+		for (const EntityHandle& handle : cell.roots)
+		{
+			if (const shared_ptr<Entity>& entity = m_World->EntityGetByHandle(handle))
+				m_World->EntityRemove(entity);
+		}
+
+		cell.roots.clear();
+		cell.loads.clear();
+		cell.subtrees.clear();
+		cell.created.clear();
+		cell.commit_subtree = 0;
+		cell.commit_entity = 0;
+		cell.state.store(ECellState::Unloaded, memory_order_release);
+
+		m_ReleaseDelay = RELEASE_DELAY_FRAMES;
+	}
+
+	void WorldPartition::ReleaseUnusedResources()
+	{
+		// ε  忡 ִ   ҽ .
+		unordered_set<string> needed;
+
+		for (const shared_ptr<sWorldCell>& cell : m_vecCells)
+		{
+			if (cell->state.load(memory_order_relaxed) == ECellState::Unloaded)
+				continue;
+
+			for (const auto& [type, path] : cell->resources)
+			{
+				needed.insert(path);
+			}
+		}
+
+		m_World->Each<Renderable>([&needed](Renderable* renderable)
+		{
+			if (Model* model = renderable->GeometryModel())
+				needed.insert(model->GetResourceFilePathNative());
+
+			if (Material* material = renderable->GetMaterial())
+				needed.insert(material->GetResourceFilePathNative());
+		});
+
+		uint32_t released = 0;
+		vector<string> textures;
+
+		for (const shared_ptr<sWorldCell>& cell : m_vecCells)
+		{
+			if (cell->state.load(memory_order_relaxed) != ECellState::Unloaded)
+				continue;
+
+			for (const auto& [type, path] : cell->resources)
+			{
+				//  ҽ     Ƿ ѹ óѴ.
+				if (!needed.insert(path).second)
+					continue;
+
+				shared_ptr<IResource> resource = m_ResourceCache->GetByPath<IResource>(path);
+				if (!resource)
+					continue;
+
+				if (type == EResourceType::Material)
+				{
+					for (const string& texture_path : static_pointer_cast<Material>(resource)->GetTexturePaths())
+					{
+						textures.emplace_back(texture_path);
+					}
+				}
+
+				if (m_ResourceCache->Remove(resource))
+					released++;
+			}
+		}
+
+		// ִ   ʴ ؽó .
+		if (!textures.empty())
+		{
+			unordered_set<string> used_textures;
+
+			for (const shared_ptr<IResource>& resource : m_ResourceCache->GetByType(EResourceType::Material))
+			{
+				for (const string& texture_path : static_pointer_cast<Material>(resource)->GetTexturePaths())
+				{
+					used_textures.insert(texture_path);
+				}
+			}
+
+			for (const string& texture_path : textures)
+			{
+				if (!used_textures.insert(texture_path).second)
+					continue;
+
+				if (shared_ptr<IResource> texture = m_ResourceCache->GetByPath<IResource>(texture_path))
+				{
+					if (m_ResourceCache->Remove(texture))
+						released++;
+				}
+			}
+		}
+
+		if (released != 0)
+			LOG_INFO("Released %d resources of unloaded world cells", released);
+	}
+}
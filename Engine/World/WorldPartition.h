@@ -0,0 +1,83 @@
+#pragma once
+
+#include <vector>
+#include <memory>
+#include <string>
+#include <cstdint>
+#include "../Math/Vector3.h"
+
+namespace PlayGround
+{
+	class Context;
+	class World;
+	class Entity;
+	class Threading;
+	class ResourceCache;
+	class MappedFile;
+	struct sWorldCell;
+
+	// 带 XZ     ī޶ ֺ ޸𸮿 ÷δ Ʈ 
+	//  ִ Ʈ Ʈ Ʈ ġ , (ī޶, , ȯ ) ׻ εǴ  ȴ.
+	//  ؼ ҽ ε ۾ 忡 ϰ ƼƼ   忡 Ӵ ð  ȿ  Ѵ.
+	class WorldPartition
+	{
+	public:
+		WorldPartition(Context* context, World* world);
+		~WorldPartition();
+
+		//   պκ   ȮѴ.
+		static bool IsPartitionMagic(uint32_t magic);
+		//  Ʈ ƼƼ   Ѵ.
+		static bool Save(World* world, const std::string& file_path, float cell_size);
+
+		//   а ׻ εǴ ƼƼ .
+		//  ͸ о ϹǷ    صд.
+		bool Open(const std::string& file_path);
+		//  ۾ ٸ  ݴ´. (ƼƼ 尡 .)
+		void Close();
+
+		// ī޶ ġ   ø . ( )
+		void Update(const Math::Vector3& camera_position);
+
+		// ī޶󿡼  Ÿ ȿ ġ  εѴ.
+		inline void SetStreamingRadius(float radius) { m_StreamingRadius = radius; }
+		inline float GetStreamingRadius() const { return m_StreamingRadius; }
+		// ε    ִ ޸  (ġ, Ʈ)
+		inline void SetMemoryBudget(uint64_t budget) { m_MemoryBudget = budget; }
+		inline uint64_t GetMemoryBudget() const { return m_MemoryBudget; }
+		//  忡  ӿ ƼƼ    ִ ð
+		inline void SetCommitBudgetMS(float budget) { m_CommitBudgetMS = budget; }
+
+		inline float GetCellSize() const { return m_CellSize; }
+		inline uint32_t GetCellCount() const { return static_cast<uint32_t>(m_vecCells.size()); }
+		uint32_t GetLoadedCellCount() const;
+		inline uint64_t GetResidentMemory() const { return m_ResidentMemory; }
+
+	private:
+		//  ī޶  XZ  Ÿ
+		float GetCellDistance(const sWorldCell& cell, const Math::Vector3& position) const;
+		void RequestLoad(const std::shared_ptr<sWorldCell>& cell);
+		void Unload(sWorldCell& cell);
+		// ؼ   ƼƼ ð  ȿ .   ٸ true
+		bool Commit(sWorldCell& cell, float budget_ms);
+		//   ϴ , , ؽó ҽ ĳÿ .
+		void ReleaseUnusedResources();
+
+		Context* m_Context = nullptr;
+		World* m_World = nullptr;
+		Threading* m_Threading = nullptr;
+		ResourceCache* m_ResourceCache = nullptr;
+
+		// ۾ 尡 д   ʵ Ѵ.
+		std::shared_ptr<MappedFile> m_File;
+		std::vector<std::shared_ptr<sWorldCell>> m_vecCells;
+
+		float m_CellSize = 64.0f;
+		float m_StreamingRadius = 192.0f;
+		uint64_t m_MemoryBudget = 512ull * 1024 * 1024;
+		float m_CommitBudgetMS = 2.0f;
+		uint64_t m_ResidentMemory = 0;
+		// ƼƼ  ݿ ڿ ҽ ϱ  ٸ  
+		uint32_t m_ReleaseDelay = 0;
+	};
+}
@@ -0,0 +1,181 @@
+#include "Common.h"
+#include "Rendering/Animation.h"
+#include "Tests.h"
+#include <chrono>
+#include <cmath>
+
+using namespace std;
+using namespace PlayGround;
+using namespace PlayGround::Math;
+
+namespace
+{
+	// Ʈ ĳ Ŭ  ũ ( 60, 30fps 10    Ű)
+	constexpr uint32_t CHANNEL_COUNT = 60;
+	constexpr uint32_t KEY_COUNT = 301;
+	constexpr double TICKS_PER_SEC = 30.0;
+	// ø 60fps ϴ ó ð ݾ  .
+	constexpr uint32_t SAMPLE_FRAMES = 600;
+	constexpr uint32_t RANDOM_SAMPLES = 200000;
+
+	//  ļ ٸ ε巯 
+	// ġ Ʈ ũ ̰ ũ  ʴ Ϲ Ŭ 䳻.
+	AnimationNode create_channel(const uint32_t index)
+	{
+		AnimationNode channel;
+		channel.name = "joint_" + to_string(index);
+
+		const float phase = index * 0.37f;
+		const float speed = 1.0f + (index % 7) * 0.25f;
+		const float reach = index == 0 ? 5.0f : 0.05f;
+
+		channel.positionFrames.reserve(KEY_COUNT);
+		channel.rotationFrames.reserve(KEY_COUNT);
+		channel.scaleFrames.reserve(KEY_COUNT);
+
+		for (uint32_t k = 0; k < KEY_COUNT; k++)
+		{
+			const double time = static_cast<double>(k);
+			const float t = static_cast<float>(time / TICKS_PER_SEC);
+
+			const Vector3 position(reach * sinf(t * speed + phase), 1.0f + reach * 0.5f * cosf(t * speed * 0.5f), reach * sinf(t * 0.3f));
+			const Vector3 axis = Vector3(sinf(phase), 1.0f, cosf(phase)).Normalized();
+			const Quaternion rotation = Quaternion::FromAngleAxis(0.8f * sinf(t * speed + phase), axis);
+
+			channel.positionFrames.push_back({ time, position });
+			channel.rotationFrames.push_back({ time, rotation });
+			channel.scaleFrames.push_back({ time, Vector3(1.0f, 1.0f, 1.0f) });
+		}
+
+		return channel;
+	}
+
+	uint64_t raw_memory(const vector<AnimationNode>& channels)
+	{
+		uint64_t size = 0;
+		for (const AnimationNode& channel : channels)
+		{
+			size += sizeof(AnimationNode) + channel.name.capacity();
+			size += channel.positionFrames.capacity() * sizeof(KeyVector);
+			size += channel.rotationFrames.capacity() * sizeof(KeyQuaternion);
+			size += channel.scaleFrames.capacity() * sizeof(KeyVector);
+		}
+
+		return size;
+	}
+
+	double elapsed_ms(const chrono::high_resolution_clock::time_point& start)
+	{
+		return chrono::duration<double, milli>(chrono::high_resolution_clock::now() - start).count();
+	}
+}
+
+namespace Tests
+{
+	bool AnimationClipBenchmark()
+	{
+		vector<AnimationNode> channels;
+		for (uint32_t i = 0; i < CHANNEL_COUNT; i++)
+		{
+			channels.push_back(create_channel(i));
+		}
+
+		const uint64_t raw_size = raw_memory(channels);
+
+		//  ø   ʴ´.
+		Animation clip(nullptr);
+		clip.SetName("benchmark");
+		clip.SetTicksPerSec(TICKS_PER_SEC);
+		clip.SetDuration(KEY_COUNT - 1);
+		for (const AnimationNode& channel : channels)
+		{
+			clip.AddChannel(AnimationNode(channel));
+		}
+
+		auto start = chrono::high_resolution_clock::now();
+		clip.Compress();
+		const double compress_ms = elapsed_ms(start);
+
+		const uint64_t compressed_size = clip.GetObjectSizeCPU();
+
+		TEST_CHECK(clip.GetChannelCount() == CHANNEL_COUNT, "compressed clip has %u channels", clip.GetChannelCount());
+
+		//  Ű ð øؼ   .
+		//   ȭ  Ƿ     ȿ ; Ѵ.
+		const sAnimationCompression settings;
+		float position_error = 0.0f;
+		float rotation_error = 0.0f;
+		float scale_error = 0.0f;
+
+		for (uint32_t i = 0; i < CHANNEL_COUNT; i++)
+		{
+			sAnimationCursor cursor;
+			for (uint32_t k = 0; k < KEY_COUNT; k++)
+			{
+				Vector3 position(0.0f, 0.0f, 0.0f);
+				Quaternion rotation(0.0f, 0.0f, 0.0f, 1.0f);
+				Vector3 scale(1.0f, 1.0f, 1.0f);
+				clip.SampleChannel(i, k / TICKS_PER_SEC, &cursor, &position, &rotation, &scale);
+
+				const KeyVector& position_key = channels[i].positionFrames[k];
+				const KeyQuaternion& rotation_key = channels[i].rotationFrames[k];
+				const KeyVector& scale_key = channels[i].scaleFrames[k];
+
+				position_error = max(position_error, (position - position_key.value).Length());
+				scale_error = max(scale_error, (scale - scale_key.value).Length());
+
+				const float dot = min(fabsf(Quaternion::Dot(rotation.Normalized(), rotation_key.value.Normalized())), 1.0f);
+				rotation_error = max(rotation_error, 2.0f * acosf(dot));
+			}
+		}
+
+		printf("  %u channels, %u keys per track, compressed in %.2f ms\n", CHANNEL_COUNT, KEY_COUNT, compress_ms);
+		printf("  raw keys %llu bytes, compressed %llu bytes (%.1fx)\n", static_cast<unsigned long long>(raw_size), static_cast<unsigned long long>(compressed_size), static_cast<double>(raw_size) / compressed_size);
+		printf("  max error: position %.5f, rotation %.5f rad, scale %.5f\n", position_error, rotation_error, scale_error);
+
+		TEST_CHECK(position_error < settings.position_tolerance * 4.0f + 0.001f, "position error %f is too large", position_error);
+		TEST_CHECK(rotation_error < settings.rotation_tolerance * 4.0f, "rotation error %f is too large", rotation_error);
+		TEST_CHECK(scale_error < settings.scale_tolerance * 4.0f, "scale error %f is too large", scale_error);
+
+		// ϵ ð   Ŀ п  Ű ȮѴ.
+		vector<sAnimationCursor> cursors(CHANNEL_COUNT);
+		Vector3 position(0.0f, 0.0f, 0.0f);
+		Quaternion rotation(0.0f, 0.0f, 0.0f, 1.0f);
+		Vector3 scale(1.0f, 1.0f, 1.0f);
+		float checksum = 0.0f;
+
+		start = chrono::high_resolution_clock::now();
+		for (uint32_t frame = 0; frame < SAMPLE_FRAMES; frame++)
+		{
+			const double time = fmod(frame / 60.0, clip.GetDurationSec());
+			for (uint32_t i = 0; i < CHANNEL_COUNT; i++)
+			{
+				clip.SampleChannel(i, time, &cursors[i], &position, &rotation, &scale);
+				checksum += position.x + rotation.w;
+			}
+		}
+		const double sequential_ms = elapsed_ms(start);
+
+		//  ð  ȿ Ű ó ã´.
+		uint32_t seed = 12345;
+		start = chrono::high_resolution_clock::now();
+		for (uint32_t n = 0; n < RANDOM_SAMPLES; n++)
+		{
+			seed = seed * 1664525u + 1013904223u;
+			const double time = (seed >> 8) / static_cast<double>(1 << 24) * clip.GetDurationSec();
+
+			sAnimationCursor cursor;
+			clip.SampleChannel(n % CHANNEL_COUNT, time, &cursor, &position, &rotation, &scale);
+			checksum += position.x + rotation.w;
+		}
+		const double random_ms = elapsed_ms(start);
+
+		const double sequential_ns = sequential_ms * 1e6 / (static_cast<double>(SAMPLE_FRAMES) * CHANNEL_COUNT);
+		const double random_ns = random_ms * 1e6 / RANDOM_SAMPLES;
+
+		printf("  sampling: sequential %.1f ns/channel (%.2f us per pose), random %.1f ns/channel\n", sequential_ns, sequential_ns * CHANNEL_COUNT / 1000.0, random_ns);
+		printf("  checksum %.3f\n", checksum);
+
+		return true;
+	}
+}
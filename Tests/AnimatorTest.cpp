@@ -0,0 +1,379 @@
+#include "Common.h"
+#include "Rendering/Skinning.h"
+#include "Tests.h"
+#include "MathScalarReference.h"
+#include <chrono>
+#include <cmath>
+#include <random>
+
+using namespace std;
+using namespace PlayGround;
+using namespace PlayGround::Math;
+
+namespace
+{
+	constexpr double TICKS_PER_SEC = 30.0;
+	constexpr uint32_t KEY_COUNT = 61;
+	constexpr uint32_t VERTEX_COUNT = 4096;
+	constexpr uint32_t REPEAT = 200;
+	// Ű SIMD ο MATH_NO_SIMD  Į θ ϹǷ ݿø ̸ Ѵ.
+	constexpr float SKIN_TOLERANCE = 1e-4f;
+
+	const float* floats(const void* data) { return static_cast<const float*>(data); }
+	float* floats(void* data) { return static_cast<float*>(data); }
+
+	float rotation_angle(const Quaternion& a, const Quaternion& b)
+	{
+		const float dot = min(fabsf(Quaternion::Dot(a.Normalized(), b.Normalized())), 1.0f);
+		return 2.0f * acosf(dot);
+	}
+
+	//  4¥  (tip ä Ƿ ε  ´.)
+	Skeleton create_skeleton()
+	{
+		Skeleton skeleton;
+		skeleton.AddJoint("root", -1, Matrix(Vector3(0.0f, 0.0f, 0.0f), Quaternion::FromAngleAxis(0.3f, Vector3::Up), Vector3::One));
+		skeleton.AddJoint("spine", 0, Matrix(Vector3(0.0f, 1.0f, 0.0f), Quaternion::FromAngleAxis(0.1f, Vector3::Right), Vector3::One));
+		skeleton.AddJoint("arm", 1, Matrix(Vector3(0.5f, 0.5f, 0.0f), Quaternion::FromAngleAxis(0.5f, Vector3::Forward), Vector3(1.0f, 1.2f, 1.0f)));
+		skeleton.AddJoint("tip", 2, Matrix(Vector3(1.0f, 0.0f, 0.0f), Quaternion::Identity, Vector3::One));
+
+		// ޽ Ʈ   ִٰ  ε   ʵ  Ѵ.
+		for (uint32_t joint = 0; joint < skeleton.GetJointCount(); joint++)
+		{
+			skeleton.AddBone(joint, skeleton.GetBindGlobal(0) * skeleton.GetBindGlobalInverse(joint));
+		}
+
+		return skeleton;
+	}
+
+	AnimationNode create_channel(const string& name, const float speed, const float phase)
+	{
+		AnimationNode channel;
+		channel.name = name;
+
+		for (uint32_t k = 0; k < KEY_COUNT; k++)
+		{
+			const double time = static_cast<double>(k);
+			const float t = static_cast<float>(time / TICKS_PER_SEC);
+
+			const Vector3 position(0.2f * sinf(t * speed + phase), 1.0f + 0.1f * cosf(t * speed), 0.05f * sinf(t * 0.5f));
+			const Vector3 axis = Vector3(sinf(phase), 1.0f, cosf(phase)).Normalized();
+			const Quaternion rotation = Quaternion::FromAngleAxis(1.2f * sinf(t * speed + phase), axis);
+			const Vector3 scale(1.0f + 0.1f * sinf(t * speed), 1.0f, 1.0f - 0.05f * cosf(t));
+
+			channel.positionFrames.push_back({ time, position });
+			channel.rotationFrames.push_back({ time, rotation });
+			channel.scaleFrames.push_back({ time, scale });
+		}
+
+		return channel;
+	}
+
+	// ghost ̷濡   ä̴.
+	void create_clip(Animation* clip, vector<AnimationNode>* channels, const float speed)
+	{
+		channels->push_back(create_channel("spine", speed, 0.0f));
+		channels->push_back(create_channel("ghost", speed, 1.0f));
+		channels->push_back(create_channel("arm", speed * 1.5f, 2.0f));
+
+		clip->SetTicksPerSec(TICKS_PER_SEC);
+		clip->SetDuration(KEY_COUNT - 1);
+		for (const AnimationNode& channel : *channels)
+		{
+			clip->AddChannel(AnimationNode(channel));
+		}
+
+		clip->Compress();
+	}
+
+	//   Ű    
+	void sample_reference(const AnimationNode& channel, const double time, Vector3* position, Quaternion* rotation, Vector3* scale)
+	{
+		const double tick = Util::Clamp(0.0, static_cast<double>(KEY_COUNT - 1), time * TICKS_PER_SEC);
+		const uint32_t a = min(static_cast<uint32_t>(tick), KEY_COUNT - 2);
+		const float factor = static_cast<float>(tick - a);
+
+		*position = Vector3::Lerp(channel.positionFrames[a].value, channel.positionFrames[a + 1].value, factor);
+		*rotation = Quaternion::Slerp(channel.rotationFrames[a].value, channel.rotationFrames[a + 1].value, factor);
+		*scale = Vector3::Lerp(channel.scaleFrames[a].value, channel.scaleFrames[a + 1].value, factor);
+	}
+
+	struct sPose
+	{
+		vector<Vector3> positions;
+		vector<Quaternion> rotations;
+		vector<Vector3> scales;
+
+		explicit sPose(const uint32_t joint_count) : positions(joint_count), rotations(joint_count), scales(joint_count) {}
+	};
+
+	//  ĺ ؽ MATH_NO_SIMD  Matrix ٽ Ѵ.
+	// Ų   ʰ   ġ ´. (̹Ƿ  .)
+	void skin_reference(const Skeleton& skeleton, const sPose& pose, const uint32_t mesh_joint, const vector<sSkinWeight>& weights, const vector<RHI_Vertex_PosTexNorTan>& source, vector<Vector3>* positions, vector<Vector3>* normals)
+	{
+		const uint32_t joint_count = skeleton.GetJointCount();
+		vector<Matrix> local(joint_count);
+		vector<Matrix> global(joint_count);
+		Tests::ScalarMath::ComposeTRS(floats(pose.positions.data()), floats(pose.rotations.data()), floats(pose.scales.data()), joint_count, floats(local.data()));
+
+		for (uint32_t i = 0; i < joint_count; i++)
+		{
+			const int32_t parent = skeleton.GetJoints()[i].parent;
+			if (parent < 0)
+				global[i] = local[i];
+			else
+				Tests::ScalarMath::Multiply(floats(&local[i]), floats(&global[parent]), 1, floats(&global[i]));
+		}
+
+		Matrix mesh_inverse;
+		Tests::ScalarMath::Invert(floats(&skeleton.GetBindGlobal(mesh_joint)), 1, floats(&mesh_inverse));
+
+		const vector<sSkeletonBone>& bones = skeleton.GetBones();
+		vector<Matrix> skin(bones.size());
+		for (uint32_t i = 0; i < static_cast<uint32_t>(bones.size()); i++)
+		{
+			Matrix bone;
+			Tests::ScalarMath::Multiply(floats(&bones[i].offset), floats(&global[bones[i].joint]), 1, floats(&bone));
+			Tests::ScalarMath::Multiply(floats(&bone), floats(&mesh_inverse), 1, floats(&skin[i]));
+		}
+
+		positions->resize(source.size());
+		normals->resize(source.size());
+
+		for (size_t v = 0; v < source.size(); v++)
+		{
+			const Vector3 position(source[v].pos[0], source[v].pos[1], source[v].pos[2]);
+			const Vector3 normal(source[v].nor[0], source[v].nor[1], source[v].nor[2]);
+
+			if (Skinning::GetWeightSum(weights[v]) <= 0.0f)
+			{
+				(*positions)[v] = position;
+				(*normals)[v] = normal;
+				continue;
+			}
+
+			// 븻  Բ Űܼ ̵ .
+			const Vector3 points[3] = { position, normal, Vector3::Zero };
+			Vector3 skinned_position = Vector3::Zero;
+			Vector3 skinned_normal = Vector3::Zero;
+
+			for (uint32_t k = 0; k < 4; k++)
+			{
+				Vector3 moved[3];
+				Tests::ScalarMath::TransformPoints(floats(&skin[weights[v].bones[k]]), floats(points), 3, floats(moved));
+
+				skinned_position += moved[0] * weights[v].weights[k];
+				skinned_normal += (moved[1] - moved[2]) * weights[v].weights[k];
+			}
+
+			(*positions)[v] = skinned_position;
+			(*normals)[v] = skinned_normal.Normalized();
+		}
+	}
+
+	float max_position_error(const vector<RHI_Vertex_PosTexNorTan>& result, const vector<Vector3>& reference)
+	{
+		float error = 0.0f;
+		for (size_t v = 0; v < result.size(); v++)
+		{
+			const Vector3 position(result[v].pos[0], result[v].pos[1], result[v].pos[2]);
+			error = max(error, (position - reference[v]).Length() / max(1.0f, reference[v].Length()));
+		}
+
+		return error;
+	}
+
+	double elapsed_ms(const chrono::high_resolution_clock::time_point& start)
+	{
+		return chrono::duration<double, milli>(chrono::high_resolution_clock::now() - start).count();
+	}
+}
+
+namespace Tests
+{
+	bool AnimatorTest()
+	{
+		const Skeleton skeleton = create_skeleton();
+		const uint32_t joint_count = skeleton.GetJointCount();
+		const vector<sSkeletonJoint>& joints = skeleton.GetJoints();
+
+		// Ŭ   ʴ´.
+		Animation walk(nullptr);
+		Animation wave(nullptr);
+		vector<AnimationNode> walk_channels;
+		vector<AnimationNode> wave_channels;
+		create_clip(&walk, &walk_channels, 2.0f);
+		create_clip(&wave, &wave_channels, 5.0f);
+
+		vector<int32_t> channel_joints;
+		Skinning::BindChannels(skeleton, walk, &channel_joints);
+		TEST_CHECK(channel_joints.size() == 3 && channel_joints[0] == 1 && channel_joints[1] == -1 && channel_joints[2] == 2, "channels were bound to the wrong joints");
+
+		// ø    Ű Ѵ.
+		// 60fps ϵ  ٰ  ڷ ư Ŀ ٽ ã 쵵 ȮѴ.
+		const sAnimationCompression settings;
+		vector<sAnimationCursor> cursors(walk.GetChannelCount());
+		sPose pose(joint_count);
+		float position_error = 0.0f;
+		float rotation_error = 0.0f;
+		float scale_error = 0.0f;
+		mt19937 random(7);
+		uniform_real_distribution<double> random_time(0.0, walk.GetDurationSec());
+
+		for (uint32_t frame = 0; frame < 240; frame++)
+		{
+			const double time = frame % 50 == 49 ? random_time(random) : fmod(frame / 60.0, walk.GetDurationSec());
+			Skinning::SamplePose(skeleton, &walk, time, channel_joints, &cursors, &pose.positions, &pose.rotations, &pose.scales);
+
+			for (uint32_t channel = 0; channel < static_cast<uint32_t>(channel_joints.size()); channel++)
+			{
+				const int32_t joint = channel_joints[channel];
+				if (joint < 0)
+					continue;
+
+				Vector3 position, scale;
+				Quaternion rotation;
+				sample_reference(walk_channels[channel], time, &position, &rotation, &scale);
+
+				position_error = max(position_error, (pose.positions[joint] - position).Length());
+				rotation_error = max(rotation_error, rotation_angle(pose.rotations[joint], rotation));
+				scale_error = max(scale_error, (pose.scales[joint] - scale).Length());
+			}
+
+			// ä   ε  ״δ.
+			for (const uint32_t joint : { 0u, 3u })
+			{
+				TEST_CHECK(pose.positions[joint] == joints[joint].bind_position && pose.rotations[joint] == joints[joint].bind_rotation && pose.scales[joint] == joints[joint].bind_scale,
+					"joint %u without a channel left its bind pose", joint);
+			}
+		}
+
+		TEST_CHECK(position_error < settings.position_tolerance * 4.0f + 0.001f, "sampled position error %f is too large", position_error);
+		TEST_CHECK(rotation_error < settings.rotation_tolerance * 4.0f, "sampled rotation error %f is too large", rotation_error);
+		TEST_CHECK(scale_error < settings.scale_tolerance * 4.0f, "sampled scale error %f is too large", scale_error);
+
+		// : 0̸  , 1̸  ̰ ߰ ȸ ʿ  ŭ  ִ.
+		sPose from(joint_count);
+		sPose to(joint_count);
+		vector<sAnimationCursor> wave_cursors(wave.GetChannelCount());
+		Skinning::SamplePose(skeleton, &walk, 0.4, channel_joints, &cursors, &from.positions, &from.rotations, &from.scales);
+		Skinning::SamplePose(skeleton, &wave, 1.1, channel_joints, &wave_cursors, &to.positions, &to.rotations, &to.scales);
+
+		for (const float t : { 0.0f, 0.5f, 1.0f })
+		{
+			sPose blended = to;
+			Skinning::BlendPose(from.positions, from.rotations, from.scales, t, &blended.positions, &blended.rotations, &blended.scales);
+
+			for (uint32_t joint = 0; joint < joint_count; joint++)
+			{
+				const Vector3 expected_position = from.positions[joint] * (1.0f - t) + to.positions[joint] * t;
+				const Vector3 expected_scale = from.scales[joint] * (1.0f - t) + to.scales[joint] * t;
+				TEST_CHECK((blended.positions[joint] - expected_position).Length() < 1e-5f, "blended position of joint %u at %.1f is off", joint, t);
+				TEST_CHECK((blended.scales[joint] - expected_scale).Length() < 1e-5f, "blended scale of joint %u at %.1f is off", joint, t);
+				TEST_CHECK(fabsf(blended.rotations[joint].LengthSquared() - 1.0f) < 1e-4f, "blended rotation of joint %u at %.1f is not normalized", joint, t);
+
+				const float from_angle = rotation_angle(blended.rotations[joint], from.rotations[joint]);
+				const float to_angle = rotation_angle(blended.rotations[joint], to.rotations[joint]);
+				const float total_angle = rotation_angle(from.rotations[joint], to.rotations[joint]);
+				TEST_CHECK(fabsf(from_angle - total_angle * t) < 1e-3f && fabsf(to_angle - total_angle * (1.0f - t)) < 1e-3f,
+					"blended rotation of joint %u at %.1f is %f and %f rad from the ends of a %f rad arc", joint, t, from_angle, to_angle, total_angle);
+			}
+		}
+
+		// Ű ޽ (Ϻ ؽ  .)
+		vector<RHI_Vertex_PosTexNorTan> vertices(VERTEX_COUNT);
+		vector<sSkinWeight> weights(VERTEX_COUNT);
+		uniform_real_distribution<float> random_float(-1.0f, 1.0f);
+		uniform_int_distribution<uint32_t> random_bone(0, skeleton.GetBoneCount() - 1);
+
+		for (uint32_t v = 0; v < VERTEX_COUNT; v++)
+		{
+			const Vector3 position(random_float(random), 1.0f + random_float(random) * 1.5f, random_float(random) * 0.3f);
+			const Vector3 normal = Vector3(random_float(random), random_float(random), random_float(random) + 2.0f).Normalized();
+			const Vector3 tangent = Vector3::Cross(normal, Vector3::Up).Normalized();
+			vertices[v] = RHI_Vertex_PosTexNorTan(position, Vector2(random_float(random), random_float(random)), normal, tangent);
+
+			if (v % 16 == 0)
+				continue;
+
+			// ġ ū  ְ  1 ǰ Ѵ.
+			float weight[4] = { 1.0f, 0.5f * (random_float(random) + 1.0f), 0.25f * (random_float(random) + 1.0f), v % 3 == 0 ? 0.0f : 0.1f };
+			const float sum = weight[0] + weight[1] + weight[2] + weight[3];
+			for (uint32_t k = 0; k < 4; k++)
+			{
+				weights[v].bones[k] = static_cast<uint16_t>(random_bone(random));
+				weights[v].weights[k] = weight[k] / sum;
+			}
+		}
+
+		vector<Matrix> local(joint_count);
+		vector<Matrix> global(joint_count);
+		vector<Matrix> bone_matrices(skeleton.GetBoneCount());
+		vector<Matrix> skin_matrices(skeleton.GetBoneCount());
+		vector<RHI_Vertex_PosTexNorTan> skinned(VERTEX_COUNT);
+		vector<Vector3> reference_positions;
+		vector<Vector3> reference_normals;
+		BoundingBox aabb;
+
+		// ε  ؽ  ʴ´.
+		Skinning::SamplePose(skeleton, nullptr, 0.0, channel_joints, &cursors, &pose.positions, &pose.rotations, &pose.scales);
+		Skinning::ComputeBoneMatrices(skeleton, pose.positions, pose.rotations, pose.scales, &local, &global, &bone_matrices);
+		Skinning::ComputeSkinMatrices(skeleton, bone_matrices, 0, &skin_matrices);
+		Skinning::SkinVertices(skin_matrices.data(), weights.data(), vertices.data(), skinned.data(), VERTEX_COUNT, &aabb);
+
+		float bind_error = 0.0f;
+		for (uint32_t v = 0; v < VERTEX_COUNT; v++)
+		{
+			bind_error = max(bind_error, (Vector3(skinned[v].pos[0], skinned[v].pos[1], skinned[v].pos[2]) - Vector3(vertices[v].pos[0], vertices[v].pos[1], vertices[v].pos[2])).Length());
+		}
+
+		TEST_CHECK(bind_error < SKIN_TOLERANCE, "bind pose moved vertices by %f", bind_error);
+
+		//    ޽  ٲ㰡 Į ο Ѵ.
+		sPose blended = to;
+		Skinning::BlendPose(from.positions, from.rotations, from.scales, 0.3f, &blended.positions, &blended.rotations, &blended.scales);
+		Skinning::ComputeBoneMatrices(skeleton, blended.positions, blended.rotations, blended.scales, &local, &global, &bone_matrices);
+
+		float position_skin_error = 0.0f;
+		float normal_skin_error = 0.0f;
+		for (const uint32_t mesh_joint : { 0u, 1u })
+		{
+			Skinning::ComputeSkinMatrices(skeleton, bone_matrices, mesh_joint, &skin_matrices);
+			Skinning::SkinVertices(skin_matrices.data(), weights.data(), vertices.data(), skinned.data(), VERTEX_COUNT, &aabb);
+			skin_reference(skeleton, blended, mesh_joint, weights, vertices, &reference_positions, &reference_normals);
+
+			position_skin_error = max(position_skin_error, max_position_error(skinned, reference_positions));
+
+			Vector3 min = Vector3::Inf;
+			Vector3 max = Vector3::NegInf;
+			for (uint32_t v = 0; v < VERTEX_COUNT; v++)
+			{
+				const Vector3 normal(skinned[v].nor[0], skinned[v].nor[1], skinned[v].nor[2]);
+				normal_skin_error = std::max(normal_skin_error, (normal - reference_normals[v]).Length());
+
+				min = Vector3(std::min(min.x, reference_positions[v].x), std::min(min.y, reference_positions[v].y), std::min(min.z, reference_positions[v].z));
+				max = Vector3(std::max(max.x, reference_positions[v].x), std::max(max.y, reference_positions[v].y), std::max(max.z, reference_positions[v].z));
+
+				TEST_CHECK(skinned[v].tex[0] == vertices[v].tex[0] && skinned[v].tex[1] == vertices[v].tex[1], "skinning changed the uv of vertex %u", v);
+			}
+
+			TEST_CHECK((aabb.GetMin() - min).Length() < SKIN_TOLERANCE * 10.0f && (aabb.GetMax() - max).Length() < SKIN_TOLERANCE * 10.0f, "skinned bounding box doesn't match the reference for mesh joint %u", mesh_joint);
+		}
+
+		TEST_CHECK(position_skin_error < SKIN_TOLERANCE, "skinned position error %f is too large", position_skin_error);
+		TEST_CHECK(normal_skin_error < SKIN_TOLERANCE * 10.0f, "skinned normal error %f is too large", normal_skin_error);
+
+		// Ű ð (ؽ ϳ)
+		const auto start = chrono::high_resolution_clock::now();
+		for (uint32_t i = 0; i < REPEAT; i++)
+		{
+			Skinning::SkinVertices(skin_matrices.data(), weights.data(), vertices.data(), skinned.data(), VERTEX_COUNT, &aabb);
+		}
+		const double skin_ns = elapsed_ms(start) * 1e6 / (static_cast<double>(REPEAT) * VERTEX_COUNT);
+
+		printf("  pose error: position %.5f, rotation %.5f rad, scale %.5f\n", position_error, rotation_error, scale_error);
+		printf("  skinning error: position %.7f, normal %.7f, %.2f ns per vertex\n", position_skin_error, normal_skin_error, skin_ns);
+
+		return true;
+	}
+}
@@ -0,0 +1,130 @@
+#include "Common.h"
+#include "IO/FileStream.h"
+#include "Tests.h"
+#include <chrono>
+#include <filesystem>
+
+using namespace std;
+using namespace PlayGround;
+
+namespace
+{
+	constexpr uint32_t VALUE_COUNT = 4 * 1024 * 1024;
+	constexpr uint32_t BLOCK_SIZE = 3 * 1024 * 1024;
+	constexpr uint32_t SMALL_FILE_COUNT = 2000;
+
+	double elapsed_ms(const chrono::high_resolution_clock::time_point& start)
+	{
+		return chrono::duration<double, milli>(chrono::high_resolution_clock::now() - start).count();
+	}
+
+	double megabytes_per_sec(const uint64_t bytes, const double ms)
+	{
+		return bytes / (1024.0 * 1024.0) / (ms / 1000.0);
+	}
+}
+
+namespace Tests
+{
+	bool FileStreamBenchmark()
+	{
+		const filesystem::path directory = filesystem::temp_directory_path() / "PlayGroundFileStream";
+		filesystem::create_directories(directory);
+		const string path = (directory / "stream.bin").string();
+
+		vector<uint32_t> block(BLOCK_SIZE / sizeof(uint32_t));
+		for (uint32_t i = 0; i < static_cast<uint32_t>(block.size()); i++)
+		{
+			block[i] = i * 2654435761u;
+		}
+
+		//  , ۺ ū , ̹  ġ ⸦   ״  ȮѴ.
+		auto start = chrono::high_resolution_clock::now();
+		{
+			FileStream stream(path, FileStream_Write);
+			TEST_CHECK(stream.IsOpen(), "failed to open \"%s\" for writing", path.c_str());
+
+			stream.Write(0u);
+			for (uint32_t i = 1; i < VALUE_COUNT; i++)
+			{
+				stream.Write(i);
+			}
+
+			stream.Write(string("block"));
+			stream.Write(block);
+			stream.Write(VALUE_COUNT);
+
+			const uint32_t first = 7;
+			stream.WriteAt(0, &first, sizeof(first));
+		}
+		const double write_ms = elapsed_ms(start);
+
+		const uint64_t file_size = filesystem::file_size(path);
+
+		start = chrono::high_resolution_clock::now();
+		{
+			FileStream stream(path, FileStream_Read);
+			TEST_CHECK(stream.IsOpen(), "failed to open \"%s\" for reading", path.c_str());
+
+			uint32_t value = 0;
+			stream.Read(&value);
+			TEST_CHECK(value == 7, "WriteAt did not overwrite the first value");
+
+			bool values_match = true;
+			for (uint32_t i = 1; i < VALUE_COUNT; i++)
+			{
+				stream.Read(&value);
+				values_match &= value == i;
+			}
+			TEST_CHECK(values_match, "small values were not read back in order");
+
+			string name;
+			stream.Read(&name);
+			vector<uint32_t> block_read;
+			stream.Read(&block_read);
+			TEST_CHECK(name == "block" && block_read == block, "large block was not read back");
+
+			stream.Read(&value);
+			TEST_CHECK(value == VALUE_COUNT && !stream.IsEof(), "last value was not read back");
+
+			//   ä   ª Ƿ  ڿ ġ   ־ Ѵ. (fstream failbit)
+			TEST_CHECK(stream.GetPosition() == file_size, "position after the last value is %llu, expected %llu", static_cast<unsigned long long>(stream.GetPosition()), static_cast<unsigned long long>(file_size));
+
+			stream.Read(&value);
+			TEST_CHECK(stream.IsEof(), "reading past the end did not set EOF");
+		}
+		const double read_ms = elapsed_ms(start);
+
+		//       (۰  ũ⸸ŭ )
+		start = chrono::high_resolution_clock::now();
+		for (uint32_t i = 0; i < SMALL_FILE_COUNT; i++)
+		{
+			FileStream stream((directory / ("small_" + to_string(i % 16) + ".bin")).string(), FileStream_Write);
+			stream.Write(i);
+			stream.Write(string("small"));
+		}
+		const double small_write_ms = elapsed_ms(start);
+
+		start = chrono::high_resolution_clock::now();
+		for (uint32_t i = 0; i < SMALL_FILE_COUNT; i++)
+		{
+			FileStream stream((directory / ("small_" + to_string(i % 16) + ".bin")).string(), FileStream_Read);
+			uint32_t value = 0;
+			string name;
+			stream.Read(&value);
+			stream.Read(&name);
+			TEST_CHECK(name == "small", "small file was not read back");
+		}
+		const double small_read_ms = elapsed_ms(start);
+
+		filesystem::remove_all(directory);
+
+		printf("  %-36s %10s %10s\n", "", "ms", "MB/s");
+		printf("  %-36s %10.2f %10.1f\n", "write 4M values + 3 MB block", write_ms, megabytes_per_sec(file_size, write_ms));
+		printf("  %-36s %10.2f %10.1f\n", "read 4M values + 3 MB block", read_ms, megabytes_per_sec(file_size, read_ms));
+		printf("  %-36s %10.2f %10s (%.2f us per file)\n", "write small files", small_write_ms, "", small_write_ms * 1000.0 / SMALL_FILE_COUNT);
+		printf("  %-36s %10.2f %10s (%.2f us per file)\n", "read small files", small_read_ms, "", small_read_ms * 1000.0 / SMALL_FILE_COUNT);
+
+		return true;
+	}
+}
@@ -0,0 +1,165 @@
+#include "Common.h"
+#include "Core/FrameStages.h"
+#include "Threading/Threading.h"
+#include "Tests.h"
+#include <chrono>
+#include <cstring>
+
+using namespace std;
+using namespace PlayGround;
+
+namespace
+{
+	constexpr uint32_t FRAME_COUNT = 30;
+
+	//  Build    ߰Ǵ (Engine.cpp) Ѵ.
+	// ڿ    FrameStages .   䳻 ۾ ð(ms)̴.
+	// Settings, Threading, Profiler   ʰ Update Ƿ .
+	struct sStageDesc
+	{
+		sFrameStageDesc stage;
+		ETickType tick_group;
+		double cost_ms;
+	};
+
+	const sStageDesc engine_stages[] =
+	{
+		// RegisterFrameStages   ڿ   ȴ.
+		{ { "Timer", FrameStages::SUBMODULE_UPDATE.reads, FrameStages::SUBMODULE_UPDATE.writes, FrameStages::SUBMODULE_UPDATE.main_thread }, ETickType::Variable, 0.01 },
+		{ FrameStages::WINDOW, ETickType::Variable, 0.2 },
+		{ FrameStages::RESOURCE_CACHE, ETickType::Variable, 0.2 },
+		{ FrameStages::AUDIO_LISTENER_SYNC, ETickType::Variable, 0.05 },
+		{ FrameStages::AUDIO_UPDATE, ETickType::Variable, 2.0 },
+		{ FrameStages::PHYSICS, ETickType::Variable, 3.0 },
+		{ FrameStages::RENDERER, ETickType::Variable, 4.0 },
+		{ FrameStages::INPUT, ETickType::Smoothed, 0.1 },
+		{ FrameStages::WORLD, ETickType::Smoothed, 2.0 },
+		{ FrameStages::WORLD_TRANSFORMS, ETickType::Smoothed, 1.0 },
+	};
+
+	constexpr uint32_t STAGE_COUNT = static_cast<uint32_t>(size(engine_stages));
+
+	//  ȿ ۰   Ѵ.
+	struct sStageRecord
+	{
+		uint32_t begin = 0;
+		uint32_t end = 0;
+	};
+
+	void spin(const double ms)
+	{
+		const auto end = chrono::high_resolution_clock::now() + chrono::duration<double, milli>(ms);
+		while (chrono::high_resolution_clock::now() < end)
+		{
+		}
+	}
+
+	bool is_conflict(const sStageDesc& before, const sStageDesc& after)
+	{
+		return (before.stage.writes & (after.stage.reads | after.stage.writes)) || (before.stage.reads & after.stage.writes);
+	}
+
+	uint32_t find_stage(const char* name)
+	{
+		for (uint32_t i = 0; i < STAGE_COUNT; i++)
+		{
+			if (strcmp(engine_stages[i].stage.name, name) == 0)
+				return i;
+		}
+
+		return STAGE_COUNT;
+	}
+
+	bool is_overlapped(const sStageRecord& a, const sStageRecord& b)
+	{
+		return a.begin < b.end && b.begin < a.end;
+	}
+}
+
+namespace Tests
+{
+	bool FrameGraphTest()
+	{
+		Context context;
+		context.AddSubModule<Threading>();
+		const Threading* threading = context.GetSubModule<Threading>();
+
+		FrameGraph graph(&context);
+
+		atomic<uint32_t> sequence = 0;
+		sStageRecord records[STAGE_COUNT];
+
+		for (uint32_t i = 0; i < STAGE_COUNT; i++)
+		{
+			const sStageDesc& desc = engine_stages[i];
+			graph.AddStage(desc.stage, desc.tick_group, [&, i](double)
+			{
+				records[i].begin = sequence.fetch_add(1);
+				spin(engine_stages[i].cost_ms);
+				records[i].end = sequence.fetch_add(1);
+			});
+		}
+
+		double execution_ms = 0.0;
+		double critical_path_ms = 0.0;
+		double serial_ms = 0.0;
+		bool physics_overlapped = false;
+
+		const uint32_t physics = find_stage(FrameStages::PHYSICS.name);
+		const uint32_t audio_update = find_stage(FrameStages::AUDIO_UPDATE.name);
+		const uint32_t world = find_stage(FrameStages::WORLD.name);
+		const uint32_t world_transforms = find_stage(FrameStages::WORLD_TRANSFORMS.name);
+
+		for (uint32_t frame = 0; frame < FRAME_COUNT; frame++)
+		{
+			sequence = 0;
+			graph.Execute(1.0 / 60.0, 1.0 / 60.0);
+
+			// 浹ϴ  ߰   ؾ Ѵ.
+			for (uint32_t i = 0; i < STAGE_COUNT; i++)
+			{
+				for (uint32_t j = i + 1; j < STAGE_COUNT; j++)
+				{
+					if (is_conflict(engine_stages[i], engine_stages[j]))
+						TEST_CHECK(records[i].end < records[j].begin, "\"%s\" started before \"%s\" finished (frame %u)", engine_stages[j].stage.name, engine_stages[i].stage.name, frame);
+				}
+			}
+
+			physics_overlapped |= is_overlapped(records[physics], records[audio_update]);
+
+			execution_ms += graph.GetExecutionTimeMs();
+			critical_path_ms += graph.GetCriticalPathMs();
+		}
+
+		// Ʈ Ĵ ũƮ Ʈ ڿ ϰ   ٸ.
+		const vector<sFrameStage>& stages = graph.GetStages();
+		const auto depends_on = [&](uint32_t after, uint32_t before)
+		{
+			const vector<uint32_t>& dependents = stages[before].dependents;
+			return find(dependents.begin(), dependents.end(), after) != dependents.end();
+		};
+
+		TEST_CHECK(depends_on(world_transforms, world), "World_Transforms must run after World");
+		TEST_CHECK(depends_on(world_transforms, physics), "World_Transforms must wait for Physics");
+		TEST_CHECK(!depends_on(world_transforms, audio_update), "World_Transforms must not wait for Audio_Update");
+		TEST_CHECK(!depends_on(physics, audio_update), "Physics must not wait for Audio_Update");
+
+		// Ŀ  ̻̾  Ŀ  ÿ   ִ.
+		if (threading->GetThreadCount() >= 2)
+			TEST_CHECK(physics_overlapped, "Physics never overlapped Audio_Update");
+		else
+			printf("  %u worker thread(s), overlap check skipped\n", threading->GetThreadCount());
+
+		printf("  %-20s %10s %10s\n", "stage", "start ms", "cost ms");
+		for (const sFrameStage& stage : stages)
+		{
+			printf("  %-20s %10.3f %10.3f\n", stage.name.c_str(), stage.start_ms, stage.duration_ms);
+			serial_ms += stage.duration_ms;
+		}
+
+		printf("  workers %u, average over %u frames\n", threading->GetThreadCount(), FRAME_COUNT);
+		printf("  execution %.3f ms, critical path %.3f ms, serial sum (last frame) %.3f ms\n", execution_ms / FRAME_COUNT, critical_path_ms / FRAME_COUNT, serial_ms);
+
+		return true;
+	}
+}
@@ -0,0 +1,215 @@
+#include "Common.h"
+#include "Math/Frustum.h"
+#include "Tests.h"
+#include <chrono>
+#include <random>
+
+using namespace std;
+using namespace PlayGround;
+using namespace PlayGround::Math;
+
+namespace
+{
+	constexpr uint32_t BENCHMARK_COUNT = 100000;
+	constexpr uint32_t BENCHMARK_REPEAT = 20;
+
+	double elapsed_ms(const chrono::high_resolution_clock::time_point& start)
+	{
+		return chrono::duration<double, milli>(chrono::high_resolution_clock::now() - start).count();
+	}
+
+	//  ø Է°  SoA ڽ 迭
+	struct sBoxes
+	{
+		vector<float> center_x, center_y, center_z;
+		vector<float> extent_x, extent_y, extent_z;
+
+		void Resize(const uint32_t count)
+		{
+			for (vector<float>* values : { &center_x, &center_y, &center_z, &extent_x, &extent_y, &extent_z })
+				values->resize(count);
+		}
+
+		inline Vector3 Center(const uint32_t i) const { return Vector3(center_x[i], center_y[i], center_z[i]); }
+		inline Vector3 Extent(const uint32_t i) const { return Vector3(extent_x[i], extent_y[i], extent_z[i]); }
+	};
+
+	const Vector3 EYE = Vector3(0.0f, 0.0f, -1.0f);
+	const Vector3 TARGET = Vector3(0.3f, 0.1f, 1.0f);
+	constexpr float NEAR_PLANE = 0.3f;
+	constexpr float FAR_PLANE = 150.0f;
+
+	// ī޶ ֺ ڽ  , , ģ ڽ   Ѵ.
+	// Ϻδ ī޶ near plane ̿ ۰ ξ near plane ߸ Ѵ.
+	sBoxes make_boxes(const uint32_t count, mt19937& random)
+	{
+		uniform_real_distribution<float> position(-200.0f, 200.0f);
+		uniform_real_distribution<float> size(0.05f, 8.0f);
+		uniform_real_distribution<float> depth(0.02f, NEAR_PLANE * 1.5f);
+		uniform_real_distribution<float> jitter(-0.01f, 0.01f);
+		const Vector3 forward = (TARGET - EYE).Normalized();
+
+		sBoxes boxes;
+		boxes.Resize(count);
+
+		for (uint32_t i = 0; i < count; i++)
+		{
+			Vector3 center = Vector3(position(random), position(random), position(random));
+			Vector3 extent = Vector3(size(random), size(random), size(random));
+
+			if (i % 8 == 0)
+			{
+				center = EYE + forward * depth(random) + Vector3(jitter(random), jitter(random), jitter(random));
+				extent = Vector3(0.005f, 0.005f, 0.005f);
+			}
+
+			boxes.center_x[i] = center.x;
+			boxes.center_y[i] = center.y;
+			boxes.center_z[i] = center.z;
+			boxes.extent_x[i] = extent.x;
+			boxes.extent_y[i] = extent.y;
+			boxes.extent_z[i] = extent.z;
+		}
+
+		return boxes;
+	}
+
+	inline bool test_bit(const vector<uint64_t>& visibility, const uint32_t i)
+	{
+		return (visibility[i / 64] >> (i % 64)) & 1;
+	}
+
+	// 鿡   ڽ - ࿡     Ƿ ũ⸦  ٲ㼭 Ǵ ٲ .
+	bool is_on_boundary(const Frustum& frustum, const Vector3& center, const Vector3& extent, const bool ignore_near_plane)
+	{
+		const bool smaller = frustum.CheckAabb(center, extent * (1.0f - 1e-4f), ignore_near_plane) != Intersection::Outside;
+		const bool larger = frustum.CheckAabb(center, extent * (1.0f + 1e-4f) + Vector3(1e-4f, 1e-4f, 1e-4f), ignore_near_plane) != Intersection::Outside;
+
+		return smaller != larger;
+	}
+}
+
+namespace Tests
+{
+	bool FrustumBenchmark()
+	{
+#if defined(__AVX2__)
+		printf("  batch path: AVX2 8-wide, SSE 4-wide, scalar tail\n");
+#else
+		printf("  batch path: SSE 4-wide, scalar tail (build with -mavx2 for the 8-wide path)\n");
+#endif
+
+		const Matrix view = Matrix::CreateLookAtLH(EYE, TARGET, Vector3::Up);
+		const Matrix projection = Matrix::CreatePerspectiveFieldOfViewLH(1.0f, 16.0f / 9.0f, NEAR_PLANE, FAR_PLANE);
+		const Frustum frustum(view, projection, FAR_PLANE);
+
+		mt19937 random(11);
+
+		// 8, 4, 64  ƴ  8, 4, ϳ óϴ ο  踦   Ѵ.
+		uint32_t boundary_cases = 0;
+		for (const uint32_t count : { 0u, 1u, 3u, 4u, 5u, 7u, 8u, 9u, 12u, 13u, 63u, 64u, 65u, 71u, 127u, 129u, 1001u, 4099u })
+		{
+			const sBoxes boxes = make_boxes(count, random);
+
+			for (const bool ignore_near_plane : { false, true })
+			{
+				//  ʴ Ʈ   ̸ äд.
+				vector<uint64_t> visibility((count + 63) / 64 + 1, ~0ull);
+				frustum.IsVisibleBatch(
+					boxes.center_x.data(), boxes.center_y.data(), boxes.center_z.data(),
+					boxes.extent_x.data(), boxes.extent_y.data(), boxes.extent_z.data(),
+					count, visibility.data(), ignore_near_plane);
+
+				uint32_t visible = 0;
+				for (uint32_t i = 0; i < count; i++)
+				{
+					const bool expected = frustum.CheckAabb(boxes.Center(i), boxes.Extent(i), ignore_near_plane) != Intersection::Outside;
+					const bool actual = test_bit(visibility, i);
+					visible += actual ? 1 : 0;
+
+					if (expected == actual)
+						continue;
+
+					if (is_on_boundary(frustum, boxes.Center(i), boxes.Extent(i), ignore_near_plane))
+					{
+						boundary_cases++;
+						continue;
+					}
+
+					TEST_CHECK(false, "box %u of %u (ignore_near_plane %d): batch %d, CheckAabb %d", i, count, ignore_near_plane, actual, expected);
+				}
+
+				//    Ʈ 0̾ Ѵ.
+				if (count % 64 != 0)
+					TEST_CHECK((visibility[count / 64] >> (count % 64)) == 0, "bits past %u are set", count);
+
+				// 0 带 ǵ帮 ʴ´.
+				TEST_CHECK(visibility[(count + 63) / 64] == ~0ull, "IsVisibleBatch wrote past %u words", (count + 63) / 64);
+
+				if (count == 4099)
+					printf("  %u boxes, ignore_near_plane %d: %u visible\n", count, ignore_near_plane, visible);
+			}
+		}
+
+		// near plane ϸ    ϰ    .
+		{
+			const sBoxes boxes = make_boxes(4099, random);
+			uint32_t near_culled = 0;
+			for (uint32_t i = 0; i < 4099; i++)
+			{
+				const bool with_near = frustum.CheckAabb(boxes.Center(i), boxes.Extent(i), false) != Intersection::Outside;
+				const bool without_near = frustum.CheckAabb(boxes.Center(i), boxes.Extent(i), true) != Intersection::Outside;
+				TEST_CHECK(!with_near || without_near, "box %u is visible only with the near plane", i);
+				near_culled += with_near != without_near ? 1 : 0;
+			}
+
+			TEST_CHECK(near_culled > 0, "no box was culled by the near plane only, test data does not cover it");
+		}
+
+		//   ϳ ˻ϴ ο 
+		const sBoxes boxes = make_boxes(BENCHMARK_COUNT, random);
+		vector<uint64_t> visibility((BENCHMARK_COUNT + 63) / 64);
+		uint32_t checksum[3] = { 0, 0, 0 };
+
+		auto start = chrono::high_resolution_clock::now();
+		for (uint32_t repeat = 0; repeat < BENCHMARK_REPEAT; repeat++)
+		{
+			for (uint32_t i = 0; i < BENCHMARK_COUNT; i++)
+				checksum[0] += frustum.IsVisible(boxes.Center(i), boxes.Extent(i)) ? 1 : 0;
+		}
+		const double is_visible_ms = elapsed_ms(start);
+
+		start = chrono::high_resolution_clock::now();
+		for (uint32_t repeat = 0; repeat < BENCHMARK_REPEAT; repeat++)
+		{
+			for (uint32_t i = 0; i < BENCHMARK_COUNT; i++)
+				checksum[1] += frustum.CheckAabb(boxes.Center(i), boxes.Extent(i)) != Intersection::Outside ? 1 : 0;
+		}
+		const double check_aabb_ms = elapsed_ms(start);
+
+		start = chrono::high_resolution_clock::now();
+		for (uint32_t repeat = 0; repeat < BENCHMARK_REPEAT; repeat++)
+		{
+			frustum.IsVisibleBatch(
+				boxes.center_x.data(), boxes.center_y.data(), boxes.center_z.data(),
+				boxes.extent_x.data(), boxes.extent_y.data(), boxes.extent_z.data(),
+				BENCHMARK_COUNT, visibility.data());
+
+			for (const uint64_t word : visibility)
+				checksum[2] += static_cast<uint32_t>(popcount(word));
+		}
+		const double batch_ms = elapsed_ms(start);
+
+		const double boxes_total = static_cast<double>(BENCHMARK_COUNT) * BENCHMARK_REPEAT;
+		printf("  %-28s %12s %12s\n", "", "ns/box", "visible");
+		printf("  %-28s %12.2f %12u\n", "IsVisible (sphere + cube)", is_visible_ms * 1e6 / boxes_total, checksum[0] / BENCHMARK_REPEAT);
+		printf("  %-28s %12.2f %12u\n", "CheckAabb", check_aabb_ms * 1e6 / boxes_total, checksum[1] / BENCHMARK_REPEAT);
+		printf("  %-28s %12.2f %12u\n", "IsVisibleBatch", batch_ms * 1e6 / boxes_total, checksum[2] / BENCHMARK_REPEAT);
+		printf("  %u boxes, %u repeats, %u boundary cases tolerated\n", BENCHMARK_COUNT, BENCHMARK_REPEAT, boundary_cases);
+
+		// IsVisible ڽ δ  ü ˻ϹǷ     ־   ʴ´.
+		TEST_CHECK(checksum[0] >= checksum[1], "IsVisible culled boxes that CheckAabb keeps");
+
+		return true;
+	}
+}
@@ -0,0 +1,81 @@
+//   Ÿ MATH_NO_SIMD ٽ ؼ SIMD ο  Į θ .
+//    ȿ ζ Լ   SIMD ʰ ġ ʵ
+//   ȿ  ӽ̽ ̸ ٲٰ  ҽ  Ѵ.
+#define MATH_NO_SIMD
+#define PlayGround PlayGroundScalar
+#include "Common.h"
+#include "Math/Vector2.cpp"
+#include "Math/Vector3.cpp"
+#include "Math/Vector4.cpp"
+#include "Math/Quaternion.cpp"
+#include "Math/Matrix.cpp"
+#undef PlayGround
+
+#include "MathScalarReference.h"
+
+using namespace PlayGroundScalar::Math;
+
+namespace Tests::ScalarMath
+{
+	void Multiply(const float* lhs, const float* rhs, const size_t count, float* result)
+	{
+		const Matrix* a = reinterpret_cast<const Matrix*>(lhs);
+		const Matrix* b = reinterpret_cast<const Matrix*>(rhs);
+		Matrix* out = reinterpret_cast<Matrix*>(result);
+
+		for (size_t i = 0; i < count; i++)
+		{
+			out[i] = a[i] * b[i];
+		}
+	}
+
+	void Invert(const float* matrices, const size_t count, float* result)
+	{
+		const Matrix* in = reinterpret_cast<const Matrix*>(matrices);
+		Matrix* out = reinterpret_cast<Matrix*>(result);
+
+		for (size_t i = 0; i < count; i++)
+		{
+			out[i] = Matrix::Invert(in[i]);
+		}
+	}
+
+	void GetRotation(const float* matrices, const size_t count, float* rotations)
+	{
+		const Matrix* in = reinterpret_cast<const Matrix*>(matrices);
+		Quaternion* out = reinterpret_cast<Quaternion*>(rotations);
+
+		for (size_t i = 0; i < count; i++)
+		{
+			out[i] = in[i].GetRotation();
+		}
+	}
+
+	void GetScale(const float* matrices, const size_t count, float* scales)
+	{
+		const Matrix* in = reinterpret_cast<const Matrix*>(matrices);
+		Vector3* out = reinterpret_cast<Vector3*>(scales);
+
+		for (size_t i = 0; i < count; i++)
+		{
+			out[i] = in[i].GetScale();
+		}
+	}
+
+	void ComposeTRS(const float* translations, const float* rotations, const float* scales, const size_t count, float* result)
+	{
+		Matrix::ComposeTRS(
+			std::span<const Vector3>(reinterpret_cast<const Vector3*>(translations), count),
+			std::span<const Quaternion>(reinterpret_cast<const Quaternion*>(rotations), count),
+			std::span<const Vector3>(reinterpret_cast<const Vector3*>(scales), count),
+			std::span<Matrix>(reinterpret_cast<Matrix*>(result), count));
+	}
+
+	void TransformPoints(const float* matrix, const float* points, const size_t count, float* result)
+	{
+		Matrix::TransformPoints(
+			*reinterpret_cast<const Matrix*>(matrix),
+			std::span<const Vector3>(reinterpret_cast<const Vector3*>(points), count),
+			std::span<Vector3>(reinterpret_cast<Vector3*>(result), count));
+	}
+}
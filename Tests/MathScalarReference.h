@@ -0,0 +1,16 @@
+#pragma once
+
+#include <cstddef>
+
+// MATH_NO_SIMD   Matrix Į 
+//  Ÿ ״ ѱ  Ƿ float 迭 ְ޴´.
+//  Matrix  16, ʹϾ xyzw 4, ʹ xyz 3̴.
+namespace Tests::ScalarMath
+{
+	void Multiply(const float* lhs, const float* rhs, size_t count, float* result);
+	void Invert(const float* matrices, size_t count, float* result);
+	void GetRotation(const float* matrices, size_t count, float* rotations);
+	void GetScale(const float* matrices, size_t count, float* scales);
+	void ComposeTRS(const float* translations, const float* rotations, const float* scales, size_t count, float* result);
+	void TransformPoints(const float* matrix, const float* points, size_t count, float* result);
+}
@@ -0,0 +1,188 @@
+#include "Common.h"
+#include "Tests.h"
+#include "MathScalarReference.h"
+#include <chrono>
+#include <cmath>
+#include <random>
+
+using namespace std;
+using namespace PlayGround;
+using namespace PlayGround::Math;
+
+namespace
+{
+	constexpr uint32_t COUNT = 4096;
+	constexpr uint32_t REPEAT = 200;
+
+	double elapsed_ms(const chrono::high_resolution_clock::time_point& start)
+	{
+		return chrono::duration<double, milli>(chrono::high_resolution_clock::now() - start).count();
+	}
+
+	// REPEAT   ( ϳ ns)
+	template <typename Function>
+	double time_ns(Function&& function)
+	{
+		const auto start = chrono::high_resolution_clock::now();
+		for (uint32_t i = 0; i < REPEAT; i++)
+		{
+			function();
+		}
+
+		return elapsed_ms(start) * 1e6 / (static_cast<double>(REPEAT) * COUNT);
+	}
+
+	const float* floats(const void* data) { return static_cast<const float*>(data); }
+	float* floats(void* data) { return static_cast<float*>(data); }
+
+	//  float 迭  ū   (1    )
+	float max_error(const float* a, const float* b, const size_t count)
+	{
+		float error = 0.0f;
+		for (size_t i = 0; i < count; i++)
+		{
+			error = max(error, fabsf(a[i] - b[i]) / max(1.0f, fabsf(b[i])));
+		}
+
+		return error;
+	}
+
+	// q -q  ȸ̴.
+	float max_rotation_error(const vector<Quaternion>& a, const vector<Quaternion>& b)
+	{
+		float error = 0.0f;
+		for (size_t i = 0; i < a.size(); i++)
+		{
+			error = max(error, 1.0f - fabsf(Quaternion::Dot(a[i].Normalized(), b[i].Normalized())));
+		}
+
+		return error;
+	}
+
+	// -mfmaó -     ݿø ޶Ƿ Ʈ   ʴ´.
+	constexpr float TOLERANCE = 1e-4f;
+	constexpr float ROTATION_TOLERANCE = 1e-5f;
+
+	struct sResult
+	{
+		const char* name;
+		double scalar_ns;
+		double simd_ns;
+		float error;
+		float tolerance;
+	};
+}
+
+namespace Tests
+{
+	bool MathSimdBenchmark()
+	{
+#if defined(MATH_SIMD_AVX2)
+		printf("  simd path: SSE + AVX2\n");
+#elif defined(MATH_SIMD_SSE)
+		printf("  simd path: SSE\n");
+#else
+		printf("  simd path: none (MATH_NO_SIMD), both columns are scalar\n");
+#endif
+
+		mt19937 random(7);
+		uniform_real_distribution<float> unit(-1.0f, 1.0f);
+		uniform_real_distribution<float> positive(0.5f, 2.0f);
+
+		vector<Vector3> translations(COUNT);
+		vector<Quaternion> rotations(COUNT);
+		vector<Vector3> scales(COUNT);
+		vector<Vector3> points(COUNT);
+		//  °  ä   (ó w  0 ƴ )
+		vector<Matrix> general(COUNT);
+
+		for (uint32_t i = 0; i < COUNT; i++)
+		{
+			translations[i] = Vector3(unit(random), unit(random), unit(random)) * 100.0f;
+			rotations[i] = Quaternion(unit(random), unit(random), unit(random), unit(random)).Normalized();
+			scales[i] = Vector3(positive(random), positive(random), positive(random));
+			points[i] = Vector3(unit(random), unit(random), unit(random)) * 50.0f;
+
+			float* m = &general[i].m00;
+			for (uint32_t k = 0; k < 16; k++)
+			{
+				m[k] = unit(random) * 2.0f;
+			}
+		}
+
+		vector<Matrix> trs(COUNT);
+		for (uint32_t i = 0; i < COUNT; i++)
+		{
+			trs[i] = Matrix(translations[i], rotations[i], scales[i]);
+		}
+
+		vector<Matrix> simd_matrices(COUNT);
+		vector<Matrix> scalar_matrices(COUNT);
+		vector<Quaternion> simd_rotations(COUNT);
+		vector<Quaternion> scalar_rotations(COUNT);
+		vector<Vector3> simd_vectors(COUNT);
+		vector<Vector3> scalar_vectors(COUNT);
+		vector<sResult> results;
+
+		// operator*
+		{
+			const double simd_ns = time_ns([&] { for (uint32_t i = 0; i < COUNT; i++) simd_matrices[i] = trs[i] * general[i]; });
+			const double scalar_ns = time_ns([&] { ScalarMath::Multiply(floats(trs.data()), floats(general.data()), COUNT, floats(scalar_matrices.data())); });
+			results.push_back({ "operator*", scalar_ns, simd_ns, max_error(floats(simd_matrices.data()), floats(scalar_matrices.data()), COUNT * 16), TOLERANCE });
+		}
+
+		// Invert (TRS  Ǽ Ƿ   ۾ƾ Ѵ.)
+		{
+			const double simd_ns = time_ns([&] { for (uint32_t i = 0; i < COUNT; i++) simd_matrices[i] = Matrix::Invert(trs[i]); });
+			const double scalar_ns = time_ns([&] { ScalarMath::Invert(floats(trs.data()), COUNT, floats(scalar_matrices.data())); });
+			results.push_back({ "Invert", scalar_ns, simd_ns, max_error(floats(simd_matrices.data()), floats(scalar_matrices.data()), COUNT * 16), TOLERANCE });
+		}
+
+		// GetRotation, GetScale (TRS İ w  ִ  )
+		for (const vector<Matrix>* matrices : { &trs, &general })
+		{
+			const bool is_trs = matrices == &trs;
+
+			const double rotation_simd_ns = time_ns([&] { for (uint32_t i = 0; i < COUNT; i++) simd_rotations[i] = (*matrices)[i].GetRotation(); });
+			const double rotation_scalar_ns = time_ns([&] { ScalarMath::GetRotation(floats(matrices->data()), COUNT, floats(scalar_rotations.data())); });
+			results.push_back({ is_trs ? "GetRotation (TRS)" : "GetRotation (w column)", rotation_scalar_ns, rotation_simd_ns, max_rotation_error(simd_rotations, scalar_rotations), ROTATION_TOLERANCE });
+
+			if (is_trs)
+				TEST_CHECK(max_rotation_error(simd_rotations, rotations) < ROTATION_TOLERANCE, "GetRotation does not recover the composed rotation");
+
+			const double scale_simd_ns = time_ns([&] { for (uint32_t i = 0; i < COUNT; i++) simd_vectors[i] = (*matrices)[i].GetScale(); });
+			const double scale_scalar_ns = time_ns([&] { ScalarMath::GetScale(floats(matrices->data()), COUNT, floats(scalar_vectors.data())); });
+			results.push_back({ is_trs ? "GetScale (TRS)" : "GetScale (w column)", scale_scalar_ns, scale_simd_ns, max_error(floats(simd_vectors.data()), floats(scalar_vectors.data()), COUNT * 3), TOLERANCE });
+		}
+
+		// ComposeTRS (4 óϰ   ⵵  ϳ δ.)
+		{
+			const size_t count = COUNT - 1;
+			const double simd_ns = time_ns([&] { Matrix::ComposeTRS(span<const Vector3>(translations.data(), count), span<const Quaternion>(rotations.data(), count), span<const Vector3>(scales.data(), count), span<Matrix>(simd_matrices.data(), count)); });
+			const double scalar_ns = time_ns([&] { ScalarMath::ComposeTRS(floats(translations.data()), floats(rotations.data()), floats(scales.data()), count, floats(scalar_matrices.data())); });
+			results.push_back({ "ComposeTRS", scalar_ns, simd_ns, max_error(floats(simd_matrices.data()), floats(scalar_matrices.data()), count * 16), TOLERANCE });
+		}
+
+		// TransformPoints
+		{
+			const Matrix& matrix = trs[0];
+			const double simd_ns = time_ns([&] { Matrix::TransformPoints(matrix, points, simd_vectors); });
+			const double scalar_ns = time_ns([&] { ScalarMath::TransformPoints(floats(&matrix), floats(points.data()), COUNT, floats(scalar_vectors.data())); });
+			results.push_back({ "TransformPoints", scalar_ns, simd_ns, max_error(floats(simd_vectors.data()), floats(scalar_vectors.data()), COUNT * 3), TOLERANCE });
+		}
+
+		printf("  %-24s %12s %12s %9s %12s\n", "", "scalar ns", "simd ns", "speedup", "max error");
+		for (const sResult& result : results)
+		{
+			printf("  %-24s %12.2f %12.2f %8.2fx %12.3g\n", result.name, result.scalar_ns, result.simd_ns, result.scalar_ns / result.simd_ns, result.error);
+		}
+		printf("  %u elements, %u repeats\n", COUNT, REPEAT);
+
+		for (const sResult& result : results)
+		{
+			TEST_CHECK(result.error <= result.tolerance, "%s differs from the scalar path by %g (tolerance %g)", result.name, result.error, result.tolerance);
+		}
+
+		return true;
+	}
+}
@@ -0,0 +1,152 @@
+#include "Common.h"
+#include "Resource/ResourceCache.h"
+#include "Rendering/Animation.h"
+#include "Threading/Threading.h"
+#include "Tests.h"
+#include <filesystem>
+#include <cmath>
+
+using namespace std;
+using namespace PlayGround;
+using namespace PlayGround::Math;
+
+namespace
+{
+	constexpr uint32_t CLIP_COUNT = 4;
+	constexpr uint32_t CHANNEL_COUNT = 8;
+	constexpr uint32_t KEY_COUNT = 31;
+	//  Ȯ ֱ(30) ּ  (120)   Ѵ.
+	constexpr uint64_t IDLE_FRAMES = 150;
+
+	//   ĳ  ְ ũⰡ ִ ü  ҽ
+	shared_ptr<Animation> create_clip(Context* context, const string& path)
+	{
+		auto clip = make_shared<Animation>(context);
+		clip->SetResourceFilePath(path);
+		clip->SetTicksPerSec(30.0);
+		clip->SetDuration(KEY_COUNT - 1);
+
+		for (uint32_t i = 0; i < CHANNEL_COUNT; i++)
+		{
+			AnimationNode channel;
+			channel.name = "joint_" + to_string(i);
+
+			for (uint32_t k = 0; k < KEY_COUNT; k++)
+			{
+				const float t = k / 30.0f;
+				channel.positionFrames.push_back({ static_cast<double>(k), Vector3(sinf(t + i), cosf(t * 0.5f), 0.0f) });
+				channel.rotationFrames.push_back({ static_cast<double>(k), Quaternion::FromAngleAxis(sinf(t * (i + 1)), Vector3(0.0f, 1.0f, 0.0f)) });
+				channel.scaleFrames.push_back({ static_cast<double>(k), Vector3(1.0f, 1.0f, 1.0f) });
+			}
+
+			clip->AddChannel(move(channel));
+		}
+
+		return clip;
+	}
+
+	//  ȣ frame   ĳø ƮѴ. ( Ȯΰ ε ݹ ⼭ ȴ.)
+	void advance_to(ResourceCache* cache, uint64_t frame)
+	{
+		while (cache->GetFrame() < frame)
+		{
+			cache->Update(0.0);
+		}
+	}
+}
+
+namespace Tests
+{
+	bool ResourceBudgetTest()
+	{
+		const filesystem::path directory = filesystem::temp_directory_path() / "PlayGroundResourceBudget";
+		filesystem::create_directories(directory);
+
+		//    ε 꿡 ʿ ⸸ д.
+		Context context;
+		context.AddSubModule<Threading>();
+		context.AddSubModule<ResourceCache>();
+		ResourceCache* cache = context.GetSubModule<ResourceCache>();
+
+		vector<shared_ptr<Animation>> clips;
+		vector<string> names;
+		vector<string> paths;
+		uint64_t total_size = 0;
+		uint64_t min_size = UINT64_MAX;
+
+		for (uint32_t i = 0; i < CLIP_COUNT; i++)
+		{
+			const string path = (directory / ("budget_" + to_string(i) + EXTENSION_ANIMATION)).string();
+			shared_ptr<Animation> clip = cache->Cache(create_clip(&context, path));
+			TEST_CHECK(clip != nullptr, "failed to cache \"%s\"", path.c_str());
+
+			names.push_back(clip->GetResourceName());
+			paths.push_back(clip->GetResourceFilePathNative());
+			total_size += clip->GetObjectSizeCPU();
+			min_size = min(min_size, clip->GetObjectSizeCPU());
+			clips.push_back(clip);
+		}
+
+		TEST_CHECK(min_size != 0, "cached clips report no memory usage");
+
+		// 1  ͷ, 2 ó  ͷ ؼ  ִ´.
+		//     ȸ ʾ  ̹Ƿ   ȴ.
+		shared_ptr<Animation> held = clips[1];
+		Animation* pinned = clips[2].get();
+		pinned->Pin();
+		clips.clear();
+
+		// 3 0  ȸϹǷ  ʴ ҽ ߿ 3  Ǿ.
+		advance_to(cache, 5);
+		TEST_CHECK(cache->GetByName(names[3], EResourceType::Animation) != nullptr, "\"%s\" is not cached", names[3].c_str());
+		advance_to(cache, 10);
+		TEST_CHECK(cache->GetByName(names[0], EResourceType::Animation) != nullptr, "\"%s\" is not cached", names[0].c_str());
+
+		// ҽ ϳ  Ǵ 
+		cache->SetMemoryBudget(EResourceType::Animation, total_size - min_size / 2, 0);
+		advance_to(cache, 10 + IDLE_FRAMES);
+
+		sResourceResidency residency = cache->GetResidency(EResourceType::Animation);
+		TEST_CHECK(residency.evicted_count == 1 && residency.resident_count == CLIP_COUNT - 1, "expected one eviction, %u resident and %u evicted", residency.resident_count, residency.evicted_count);
+		TEST_CHECK(cache->GetByPath(paths[3], EResourceType::Animation) == nullptr, "the least recently used unused clip was not evicted");
+		TEST_CHECK(cache->GetByPath(paths[0], EResourceType::Animation) != nullptr, "a more recently used clip was evicted first");
+		TEST_CHECK(cache->GetByPath(paths[1], EResourceType::Animation) == held, "a clip held by a shared pointer was evicted");
+		TEST_CHECK(cache->GetByPath(paths[2], EResourceType::Animation).get() == pinned, "a pinned clip was evicted");
+
+		//  ҽ ̸ ȸϸ ٽ ҷ´.
+		{
+			shared_ptr<IResource> reloaded = cache->GetByName(names[3], EResourceType::Animation);
+			TEST_CHECK(reloaded != nullptr, "\"%s\" was not reloaded", names[3].c_str());
+			TEST_CHECK(reloaded->GetResourceType() == EResourceType::Animation, "reloaded resource has the wrong type");
+			TEST_CHECK(static_pointer_cast<Animation>(reloaded)->GetChannelCount() == CHANNEL_COUNT, "reloaded clip has %u channels", static_pointer_cast<Animation>(reloaded)->GetChannelCount());
+
+			residency = cache->GetResidency(EResourceType::Animation);
+			TEST_CHECK(residency.evicted_count == 0 && residency.resident_count == CLIP_COUNT, "after reload %u resident and %u evicted", residency.resident_count, residency.evicted_count);
+		}
+
+		TEST_CHECK(cache->GetByName("budget_missing", EResourceType::Animation) == nullptr, "an unknown name returned a resource");
+
+		//  ƹ ۾Ƶ   ҽ ´.
+		cache->SetMemoryBudget(EResourceType::Animation, 1, 0);
+		advance_to(cache, cache->GetFrame() + IDLE_FRAMES);
+
+		residency = cache->GetResidency(EResourceType::Animation);
+		TEST_CHECK(residency.resident_count == 2, "expected only the held and pinned clips to stay, %u resident", residency.resident_count);
+
+		//  Ǯ   ִ.
+		pinned->Unpin();
+		pinned = nullptr;
+		advance_to(cache, cache->GetFrame() + IDLE_FRAMES);
+
+		residency = cache->GetResidency(EResourceType::Animation);
+		TEST_CHECK(residency.resident_count == 1 && cache->GetByPath(paths[1], EResourceType::Animation) == held, "expected only the held clip to stay, %u resident", residency.resident_count);
+
+		printf("  %u clips of %llu bytes, evicted in LRU order and reloaded by name\n", CLIP_COUNT, static_cast<unsigned long long>(min_size));
+
+		held.reset();
+		cache->SetMemoryBudget(EResourceType::Animation, 0, 0);
+		filesystem::remove_all(directory);
+
+		return true;
+	}
+}
@@ -0,0 +1,201 @@
+#include "Common.h"
+#include "Threading/Threading.h"
+#include "Utils/Geometry.h"
+#include "Tests.h"
+#include <chrono>
+#include <cmath>
+
+using namespace std;
+using namespace PlayGround;
+using namespace PlayGround::Math;
+
+namespace
+{
+	// Terrain ⺻
+	constexpr uint32_t CHUNK_SIZE = 128;
+	constexpr float MIN_Y = 0.0f;
+	constexpr float MAX_Y = 30.0f;
+
+	//  ļ ĸ   
+	vector<uint8_t> create_height_map(const uint32_t size)
+	{
+		vector<uint8_t> height_map(static_cast<size_t>(size) * size);
+
+		for (uint32_t y = 0; y < size; y++)
+		{
+			for (uint32_t x = 0; x < size; x++)
+			{
+				const float value = sinf(x * 0.031f) * cosf(y * 0.027f) * 0.6f + sinf((x + y) * 0.11f) * 0.3f + sinf(x * 0.53f + y * 0.71f) * 0.1f;
+				height_map[static_cast<size_t>(y) * size + x] = static_cast<uint8_t>((value * 0.5f + 0.5f) * 255.0f);
+			}
+		}
+
+		return height_map;
+	}
+
+	// Terrain::GenerateChunk   ûũ  ؽ .
+	//  ؽ  ȯѴ.
+	uint64_t generate_chunks(Threading* threading, const vector<uint8_t>& height_map, const uint32_t size, vector<vector<RHI_Vertex_PosTexNorTan>>* result)
+	{
+		const auto height = [&height_map, size](const uint32_t x, const uint32_t y)
+		{
+			return Util::Lerp(MIN_Y, MAX_Y, static_cast<float>(height_map[static_cast<size_t>(y) * size + x]) / 255.0f);
+		};
+
+		const uint32_t chunk_count_x = (size - 2) / CHUNK_SIZE + 1;
+		const uint32_t chunk_count = chunk_count_x * chunk_count_x;
+		atomic<uint64_t> vertex_count = 0;
+
+		const auto generate = [&](uint32_t begin, uint32_t end)
+		{
+			vector<RHI_Vertex_PosTexNorTan> vertices;
+
+			for (uint32_t i = begin; i < end; i++)
+			{
+				const uint32_t x_begin = (i % chunk_count_x) * CHUNK_SIZE;
+				const uint32_t y_begin = (i / chunk_count_x) * CHUNK_SIZE;
+				const uint32_t quad_count_x = min(CHUNK_SIZE, size - 1 - x_begin);
+				const uint32_t quad_count_y = min(CHUNK_SIZE, size - 1 - y_begin);
+
+				vector<RHI_Vertex_PosTexNorTan>& output = result ? (*result)[i] : vertices;
+				output.clear();
+				output.reserve(static_cast<size_t>(quad_count_x + 1) * (quad_count_y + 1));
+
+				Utility::Geometry::CreateTerrainGrid(size, size, x_begin, y_begin, quad_count_x, quad_count_y, height, &output);
+				vertex_count += output.size();
+			}
+		};
+
+		if (result)
+			result->assign(chunk_count, vector<RHI_Vertex_PosTexNorTan>());
+
+		if (threading)
+			threading->ParallelFor(0, chunk_count, 1, generate);
+		else
+			generate(0, chunk_count);
+
+		return vertex_count;
+	}
+
+	// 鸶 븻 źƮ ؼ  ؽ ϴ  
+	void reference_normals(const vector<uint8_t>& height_map, const uint32_t size, vector<Vector3>* normals, vector<Vector3>* tangents)
+	{
+		const auto position = [&](const uint32_t x, const uint32_t y)
+		{
+			return Vector3(static_cast<float>(x), Util::Lerp(MIN_Y, MAX_Y, height_map[static_cast<size_t>(y) * size + x] / 255.0f), static_cast<float>(y));
+		};
+
+		normals->assign(static_cast<size_t>(size) * size, Vector3(0.0f, 0.0f, 0.0f));
+		tangents->assign(static_cast<size_t>(size) * size, Vector3(0.0f, 0.0f, 0.0f));
+
+		const auto add_face = [&](const uint32_t a, const uint32_t b, const uint32_t c, const Vector3& pa, const Vector3& pb, const Vector3& pc, const Vector3& tangent)
+		{
+			Vector3 normal = Vector3::Cross(pb - pa, pc - pa);
+			normal = normal.y < 0.0f ? -normal : normal;
+
+			for (const uint32_t index : { a, b, c })
+			{
+				(*normals)[index] += normal;
+				(*tangents)[index] += tangent;
+			}
+		};
+
+		for (uint32_t y = 0; y + 1 < size; y++)
+		{
+			for (uint32_t x = 0; x + 1 < size; x++)
+			{
+				const uint32_t bottom_left = y * size + x;
+				const uint32_t bottom_right = bottom_left + 1;
+				const uint32_t top_left = bottom_left + size;
+				const uint32_t top_right = top_left + 1;
+
+				const Vector3 p_bl = position(x, y);
+				const Vector3 p_br = position(x + 1, y);
+				const Vector3 p_tl = position(x, y + 1);
+				const Vector3 p_tr = position(x + 1, y + 1);
+
+				// u x  1 þǷ źƮ  x  ȭ̴.
+				add_face(bottom_right, bottom_left, top_left, p_br, p_bl, p_tl, Vector3(1.0f, p_br.y - p_bl.y, 0.0f));
+				add_face(bottom_right, top_left, top_right, p_br, p_tl, p_tr, Vector3(1.0f, p_tr.y - p_tl.y, 0.0f));
+			}
+		}
+
+		for (size_t i = 0; i < normals->size(); i++)
+		{
+			(*normals)[i].Normalize();
+			(*tangents)[i].Normalize();
+		}
+	}
+
+	double elapsed_ms(const chrono::high_resolution_clock::time_point& start)
+	{
+		return chrono::duration<double, milli>(chrono::high_resolution_clock::now() - start).count();
+	}
+}
+
+namespace Tests
+{
+	bool TerrainGridBenchmark()
+	{
+		Context context;
+		context.AddSubModule<Threading>();
+		Threading* threading = context.GetSubModule<Threading>();
+
+		//   ʿ  ؽ ϴ    븻, źƮ  ȮѴ.
+		{
+			constexpr uint32_t size = 256;
+			const vector<uint8_t> height_map = create_height_map(size);
+
+			vector<vector<RHI_Vertex_PosTexNorTan>> chunks;
+			generate_chunks(threading, height_map, size, &chunks);
+
+			vector<Vector3> normals;
+			vector<Vector3> tangents;
+			reference_normals(height_map, size, &normals, &tangents);
+
+			const uint32_t chunk_count_x = (size - 2) / CHUNK_SIZE + 1;
+			float worst = 1.0f;
+
+			for (uint32_t i = 0; i < static_cast<uint32_t>(chunks.size()); i++)
+			{
+				const uint32_t x_begin = (i % chunk_count_x) * CHUNK_SIZE;
+				const uint32_t y_begin = (i / chunk_count_x) * CHUNK_SIZE;
+				const uint32_t row = min(CHUNK_SIZE, size - 1 - x_begin) + 1;
+
+				for (uint32_t v = 0; v < static_cast<uint32_t>(chunks[i].size()); v++)
+				{
+					const RHI_Vertex_PosTexNorTan& vertex = chunks[i][v];
+					const uint32_t index = (y_begin + v / row) * size + x_begin + v % row;
+
+					const Vector3 normal = Vector3(vertex.nor[0], vertex.nor[1], vertex.nor[2]);
+					const Vector3 tangent = Vector3(vertex.tan[0], vertex.tan[1], vertex.tan[2]);
+					worst = min(worst, min(Vector3::Dot(normal, normals[index]), Vector3::Dot(tangent, tangents[index])));
+				}
+			}
+
+			printf("  %ux%u matches face accumulation, worst cosine %.7f\n", size, size, worst);
+			TEST_CHECK(worst > 0.99999f, "normals or tangents differ from the face accumulation reference");
+		}
+
+		printf("  %-10s %12s %14s %14s %14s\n", "height map", "vertices", "1 thread ms", "parallel ms", "Mvertices/s");
+
+		for (const uint32_t size : { 256u, 1024u, 4096u })
+		{
+			const vector<uint8_t> height_map = create_height_map(size);
+
+			auto start = chrono::high_resolution_clock::now();
+			const uint64_t vertex_count = generate_chunks(nullptr, height_map, size, nullptr);
+			const double serial_ms = elapsed_ms(start);
+
+			start = chrono::high_resolution_clock::now();
+			generate_chunks(threading, height_map, size, nullptr);
+			const double parallel_ms = elapsed_ms(start);
+
+			printf("  %4ux%-5u %12llu %14.2f %14.2f %14.1f\n", size, size, static_cast<unsigned long long>(vertex_count), serial_ms, parallel_ms, vertex_count / (min(serial_ms, parallel_ms) * 1000.0));
+		}
+
+		printf("  workers %u, chunk size %u\n", threading->GetThreadCount(), CHUNK_SIZE);
+
+		return true;
+	}
+}
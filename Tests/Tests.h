@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstdio>
+
+// ׽Ʈ ġũ Լ
+// ϸ false ȯϰ  ǥ  Ѵ.
+namespace Tests
+{
+	bool FrameGraphTest();
+	bool ThreadingBenchmark();
+	bool FileStreamBenchmark();
+	bool TerrainGridBenchmark();
+	bool AnimationClipBenchmark();
+	bool MathSimdBenchmark();
+	bool FrustumBenchmark();
+	bool ResourceBudgetTest();
+	bool AnimatorTest();
+}
+
+#define TEST_CHECK(condition, ...) \
+	do \
+	{ \
+		if (!(condition)) \
+		{ \
+			printf("  FAILED: "); \
+			printf(__VA_ARGS__); \
+			printf("\n"); \
+			return false; \
+		} \
+	} while (false)
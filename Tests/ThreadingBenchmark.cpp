@@ -0,0 +1,297 @@
+#include "Common.h"
+#include "Threading/Threading.h"
+#include "Tests.h"
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+
+using namespace std;
+using namespace PlayGround;
+
+namespace
+{
+	constexpr uint32_t TASK_COUNT = 100000;
+	constexpr uint32_t ITERATIONS = 20;
+
+	double elapsed_ms(const chrono::high_resolution_clock::time_point& start)
+	{
+		return chrono::duration<double, milli>(chrono::high_resolution_clock::now() - start).count();
+	}
+
+	// ½ũ ϳ ϴ   (ȭ  ʵ  Ѵ.)
+	uint64_t work(const uint32_t seed, const uint32_t count)
+	{
+		uint64_t value = seed;
+		for (uint32_t i = 0; i < count; i++)
+		{
+			value = value * 6364136223846793005ull + 1442695040888963407ull;
+		}
+
+		return value >> 33;
+	}
+
+	// ۾ ġ   Ǯ (ϳ ؽ ȣǴ  +  )
+	//  θ ϸ ½ũ shared_ptr<std::function> Ҵϴ ͵ ״ .
+	class MutexDequePool
+	{
+	public:
+		MutexDequePool(const uint32_t thread_count)
+		{
+			for (uint32_t i = 0; i < thread_count; i++)
+			{
+				m_vecThreads.emplace_back(&MutexDequePool::ThreadLoop, this);
+			}
+		}
+
+		~MutexDequePool()
+		{
+			{
+				lock_guard<mutex> lock(m_Mutex);
+				m_Stopping = true;
+			}
+
+			m_Condition_var.notify_all();
+
+			for (auto& thread : m_vecThreads)
+			{
+				thread.join();
+			}
+		}
+
+		template <typename Function>
+		void AddTask(Function&& task)
+		{
+			m_Remaining.fetch_add(1);
+
+			// Ŀ ٸ  忡 Ѵ.
+			if (m_vecThreads.empty())
+			{
+				task();
+				m_Remaining.fetch_sub(1);
+				return;
+			}
+
+			unique_lock<mutex> lock(m_Mutex);
+			m_Tasks.push_back(make_shared<function<void()>>(std::forward<Function>(task)));
+			lock.unlock();
+
+			m_Condition_var.notify_one();
+		}
+
+		// ߰ ½ũ   ٸ.
+		void Wait()
+		{
+			while (m_Remaining.load() > 0)
+			{
+				this_thread::yield();
+			}
+		}
+
+	private:
+		void ThreadLoop()
+		{
+			while (true)
+			{
+				unique_lock<mutex> lock(m_Mutex);
+				m_Condition_var.wait(lock, [this] { return !m_Tasks.empty() || m_Stopping; });
+
+				if (m_Stopping && m_Tasks.empty())
+					return;
+
+				shared_ptr<function<void()>> task = m_Tasks.front();
+				m_Tasks.pop_front();
+				lock.unlock();
+
+				(*task)();
+				m_Remaining.fetch_sub(1);
+			}
+		}
+
+		vector<thread> m_vecThreads;
+		deque<shared_ptr<function<void()>>> m_Tasks;
+		mutex m_Mutex;
+		condition_variable m_Condition_var;
+		atomic<uint32_t> m_Remaining = 0;
+		bool m_Stopping = false;
+	};
+}
+
+namespace Tests
+{
+	bool ThreadingBenchmark()
+	{
+		Context context;
+		context.AddSubModule<Threading>();
+		Threading* threading = context.GetSubModule<Threading>();
+
+		// ׷쿡  ڽ ½ũ   ׷쵵 .
+		{
+			atomic<uint32_t> executed = 0;
+			const JobHandle group = threading->CreateTaskGroup();
+
+			for (uint32_t i = 0; i < TASK_COUNT; i++)
+			{
+				threading->AddTask([&executed] { executed.fetch_add(1, memory_order_relaxed); }, group);
+			}
+
+			threading->Submit(group);
+			threading->Wait(group);
+
+			TEST_CHECK(threading->IsDone(group), "task group is not done after Wait");
+			TEST_CHECK(executed == TASK_COUNT, "%u of %u tasks executed", executed.load(), TASK_COUNT);
+		}
+
+		//  θ ڽ ٿ īƮ  ʾƾ Ѵ.
+		//   ڽ θ  ǰ  ڽ θ ٸ.
+		{
+			atomic<uint32_t> executed = 0;
+			constexpr uint32_t PAIRS = 20000;
+
+			for (uint32_t i = 0; i < PAIRS; i++)
+			{
+				const JobHandle parent = threading->AddTask([] {});
+				threading->AddTask([&executed] { executed.fetch_add(1, memory_order_relaxed); }, parent);
+				threading->Wait(parent);
+			}
+
+			threading->Flush();
+			TEST_CHECK(executed == PAIRS, "%u of %u children executed", executed.load(), PAIRS);
+
+			// ̹  θ  ڽ θ ǻ츮 ʴ´.
+			const JobHandle finished = threading->CreateTaskGroup();
+			threading->Submit(finished);
+			threading->Wait(finished);
+			const JobHandle orphan = threading->AddTask([] {}, finished);
+			TEST_CHECK(threading->IsDone(finished), "a finished parent became unfinished again");
+			threading->Wait(orphan);
+		}
+
+		// ûũ ġų  ʰ  Ȯ  Ѵ. (32Ʈ    )
+		for (const uint32_t begin : { 0u, UINT32_MAX - 1000000u })
+		{
+			for (const uint32_t grain : { 0u, 1u, 7u, 4096u, UINT32_MAX })
+			{
+				const uint32_t end = begin + 1000000u;
+				atomic<uint64_t> covered = 0;
+				atomic<uint64_t> index_sum = 0;
+
+				threading->ParallelFor(begin, end, grain, [&](uint32_t chunk_begin, uint32_t chunk_end)
+				{
+					uint64_t sum = 0;
+					for (uint32_t i = chunk_begin; i < chunk_end; i++)
+					{
+						sum += i - begin;
+					}
+
+					covered.fetch_add(chunk_end - chunk_begin, memory_order_relaxed);
+					index_sum.fetch_add(sum, memory_order_relaxed);
+				});
+
+				const uint64_t count = end - begin;
+				TEST_CHECK(covered == count && index_sum == count * (count - 1) / 2, "ParallelFor(%u, %u, %u) did not cover the range exactly", begin, end, grain);
+			}
+		}
+
+		// ½ũ ϳ   
+		printf("  %-28s %12s %12s\n", "", "total ms", "ns/task");
+
+		for (const uint32_t cost : { 0u, 64u, 1024u })
+		{
+			atomic<uint64_t> checksum = 0;
+
+			const auto start = chrono::high_resolution_clock::now();
+			for (uint32_t iteration = 0; iteration < ITERATIONS; iteration++)
+			{
+				const JobHandle group = threading->CreateTaskGroup();
+				for (uint32_t i = 0; i < TASK_COUNT / ITERATIONS; i++)
+				{
+					threading->AddTask([&checksum, i, cost] { checksum.fetch_add(work(i, cost), memory_order_relaxed); }, group);
+				}
+
+				threading->Submit(group);
+				threading->Wait(group);
+			}
+			const double task_ms = elapsed_ms(start);
+
+			char label[64];
+			snprintf(label, sizeof(label), "tasks, %u steps each", cost);
+			printf("  %-28s %12.2f %12.1f\n", label, task_ms, task_ms * 1e6 / TASK_COUNT);
+		}
+
+		//    1~100 ѹ     Ǯ 
+		// 100  Ǯ Ƿ AllocateJob ڸ ٸ ε .
+		{
+			MutexDequePool baseline(threading->GetThreadCount());
+
+			printf("  %-28s %12s %12s\n", "tiny jobs", "jobs ns/task", "deque ns/task");
+
+			for (const uint32_t count : { 10000u, 100000u, 1000000u })
+			{
+				atomic<uint64_t> checksum = 0;
+				auto start = chrono::high_resolution_clock::now();
+				const JobHandle group = threading->CreateTaskGroup();
+				for (uint32_t i = 0; i < count; i++)
+				{
+					threading->AddTask([&checksum, i] { checksum.fetch_add(work(i, 16), memory_order_relaxed); }, group);
+				}
+				threading->Submit(group);
+				threading->Wait(group);
+				const double job_ms = elapsed_ms(start);
+
+				atomic<uint64_t> baseline_checksum = 0;
+				start = chrono::high_resolution_clock::now();
+				for (uint32_t i = 0; i < count; i++)
+				{
+					baseline.AddTask([&baseline_checksum, i] { baseline_checksum.fetch_add(work(i, 16), memory_order_relaxed); });
+				}
+				baseline.Wait();
+				const double baseline_ms = elapsed_ms(start);
+
+				TEST_CHECK(checksum == baseline_checksum, "%u jobs: job system and baseline results differ", count);
+
+				char label[64];
+				snprintf(label, sizeof(label), "%u jobs", count);
+				printf("  %-28s %12.1f %12.1f\n", label, job_ms * 1e6 / count, baseline_ms * 1e6 / count);
+			}
+		}
+
+		//   ParallelFor    忡  
+		for (const uint32_t cost : { 64u, 1024u })
+		{
+			uint64_t serial_checksum = 0;
+			auto start = chrono::high_resolution_clock::now();
+			for (uint32_t i = 0; i < TASK_COUNT; i++)
+			{
+				serial_checksum += work(i, cost);
+			}
+			const double serial_ms = elapsed_ms(start);
+
+			atomic<uint64_t> parallel_checksum = 0;
+			start = chrono::high_resolution_clock::now();
+			threading->ParallelFor(0, TASK_COUNT, 0, [&parallel_checksum, cost](uint32_t begin, uint32_t end)
+			{
+				uint64_t sum = 0;
+				for (uint32_t i = begin; i < end; i++)
+				{
+					sum += work(i, cost);
+				}
+
+				parallel_checksum.fetch_add(sum, memory_order_relaxed);
+			});
+			const double parallel_ms = elapsed_ms(start);
+
+			TEST_CHECK(serial_checksum == parallel_checksum, "ParallelFor result differs from the serial loop");
+
+			char label[64];
+			snprintf(label, sizeof(label), "%u steps: serial ms", cost);
+			printf("  %-28s %12.2f\n", label, serial_ms);
+			snprintf(label, sizeof(label), "%u steps: ParallelFor ms", cost);
+			printf("  %-28s %12.2f\n", label, parallel_ms);
+		}
+
+		printf("  workers %u, %u tasks\n", threading->GetThreadCount(), TASK_COUNT);
+
+		return true;
+	}
+}
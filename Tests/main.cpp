@@ -0,0 +1,66 @@
+// â̳ GPU    ϴ ܼ ׽Ʈ ġũ
+// : Tests [̸...] (̸    Ѵ.)
+//
+// 쿡 Tests Ʈ  ̺귯 ũѴ.
+//   ü   Ƿ ׽Ʈ ϴ ҽ  Ѵ.
+//  Ʈ
+// g++ -std=c++20 -O2 -pthread -IEngine Tests/main.cpp Tests/FrameGraphTest.cpp Tests/ThreadingBenchmark.cpp Tests/FileStreamBenchmark.cpp Tests/TerrainGridBenchmark.cpp Tests/MathSimdBenchmark.cpp Tests/MathScalarReference.cpp Tests/FrustumBenchmark.cpp Tests/AnimationClipBenchmark.cpp Tests/AnimatorTest.cpp Engine/Core/FrameGraph.cpp Engine/Core/FileSystem.cpp Engine/Core/EngineObject.cpp Engine/Threading/Threading.cpp Engine/IO/FileStream.cpp Engine/IO/AssetContainer.cpp Engine/Resource/IResource.cpp Engine/Rendering/Animation.cpp Engine/Rendering/Skinning.cpp Engine/Math/Vector2.cpp Engine/Math/Vector3.cpp Engine/Math/Vector4.cpp Engine/Math/Quaternion.cpp Engine/Math/Matrix.cpp Engine/Math/Plane.cpp Engine/Math/Frustum.cpp Engine/Math/BoundingBox.cpp -o EngineTests
+// -mavx2 -mfma ؼ ѹ  ϸ Frustum  ̺귯 AVX2 ε ˻Ѵ.
+// ResourceBudget ҽ ĳð Ϳ  ũϹǷ 쿡 Ѵ.
+
+#include <cstring>
+#include "Tests.h"
+
+namespace
+{
+	struct sTest
+	{
+		const char* name;
+		bool(*function)();
+	};
+
+	const sTest tests[] =
+	{
+		{ "FrameGraph", Tests::FrameGraphTest },
+		{ "Threading", Tests::ThreadingBenchmark },
+		{ "FileStream", Tests::FileStreamBenchmark },
+		{ "TerrainGrid", Tests::TerrainGridBenchmark },
+		{ "MathSimd", Tests::MathSimdBenchmark },
+		{ "Frustum", Tests::FrustumBenchmark },
+		{ "AnimationClip", Tests::AnimationClipBenchmark },
+		{ "Animator", Tests::AnimatorTest },
+#ifdef _WIN32
+		{ "ResourceBudget", Tests::ResourceBudgetTest },
+#endif
+	};
+}
+
+int main(int argc, char** argv)
+{
+	int failed = 0;
+	int executed = 0;
+
+	for (const sTest& test : tests)
+	{
+		// ̸ ־ٸ  ׽Ʈ Ѵ.
+		bool selected = argc <= 1;
+		for (int i = 1; i < argc && !selected; i++)
+		{
+			selected = strcmp(argv[i], test.name) == 0;
+		}
+
+		if (!selected)
+			continue;
+
+		printf("[%s]\n", test.name);
+		const bool success = test.function();
+		printf("[%s] %s\n", test.name, success ? "passed" : "failed");
+
+		failed += success ? 0 : 1;
+		executed++;
+	}
+
+	printf("%d of %d passed\n", executed - failed, executed);
+
+	return failed == 0 ? 0 : 1;
+}